@@ -0,0 +1 @@
+/root/repo/src/core/model/attribute-construction-list.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/helper/binary-trace-writer.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/stats/model/boolean-probe.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/model/buffer.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/callback.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/model/channel.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/config-store/model/config-store.h
\ No newline at end of file
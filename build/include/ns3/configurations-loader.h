@@ -0,0 +1 @@
+/root/repo/src/protobuf-loader/helper/configurations-loader.h
\ No newline at end of file
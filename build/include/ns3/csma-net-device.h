@@ -0,0 +1 @@
+/root/repo/src/csma/model/csma-net-device.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/helper/csv-writer.h
\ No newline at end of file
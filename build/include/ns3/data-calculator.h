@@ -0,0 +1 @@
+/root/repo/src/stats/model/data-calculator.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dc-env/helper/dc-routing-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dc-env/model/dc-topology.h
\ No newline at end of file
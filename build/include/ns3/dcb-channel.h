@@ -0,0 +1 @@
+/root/repo/src/dcb/model/dcb-channel.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/helper/dcb-fc-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/model/dcb-flow-control-port.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/helper/dcb-host-stack-helper.h
\ No newline at end of file
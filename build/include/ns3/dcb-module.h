@@ -0,0 +1,36 @@
+#ifdef NS3_MODULE_COMPILATION 
+    error "Do not include ns3 module aggregator headers from other modules these are meant only for end user scripts." 
+#endif 
+#ifndef NS3_MODULE_DCB
+    // Module headers: 
+    #include <ns3/dcb-remote-channel.h>
+    #include <ns3/dcb-net-device-helper.h>
+    #include <ns3/dcb-host-stack-helper.h>
+    #include <ns3/dcb-switch-stack-helper.h>
+    #include <ns3/dcb-fc-helper.h>
+    #include <ns3/dcb-trace-application-helper.h>
+    #include <ns3/csv-writer.h>
+    #include <ns3/binary-trace-writer.h>
+    #include <ns3/fct-statistics.h>
+    #include <ns3/tracer-extension.h>
+    #include <ns3/dcb-traffic-control.h>
+    #include <ns3/dcb-net-device.h>
+    #include <ns3/dcb-channel.h>
+    #include <ns3/pausable-queue-disc.h>
+    #include <ns3/fifo-queue-disc-ecn.h>
+    #include <ns3/dcb-trace-application.h>
+    #include <ns3/dcb-flow-control-port.h>
+    #include <ns3/dcb-pfc-port.h>
+    #include <ns3/udp-based-l4-protocol.h>
+    #include <ns3/udp-based-socket.h>
+    #include <ns3/rocev2-l4-protocol.h>
+    #include <ns3/rocev2-socket.h>
+    #include <ns3/rocev2-congestion-ops.h>
+    #include <ns3/dcqcn.h>
+    #include <ns3/int-trailer.h>
+    #include <ns3/pfc-watchdog.h>
+    #include <ns3/hpcc.h>
+    #include <ns3/timely.h>
+    #include <ns3/swift.h>
+    #include <ns3/pfc-frame.h>
+#endif 
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/helper/dcb-net-device-helper.h
\ No newline at end of file
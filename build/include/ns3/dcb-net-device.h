@@ -0,0 +1 @@
+/root/repo/src/dcb/model/dcb-net-device.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/model/dcb-pfc-port.h
\ No newline at end of file
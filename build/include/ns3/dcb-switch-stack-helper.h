@@ -0,0 +1 @@
+/root/repo/src/dcb/helper/dcb-switch-stack-helper.h
\ No newline at end of file
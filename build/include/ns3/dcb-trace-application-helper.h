@@ -0,0 +1 @@
+/root/repo/src/dcb/helper/dcb-trace-application-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/model/dcb-trace-application.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/model/dcb-traffic-control.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/model/dcqcn.h
\ No newline at end of file
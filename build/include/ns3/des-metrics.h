@@ -0,0 +1 @@
+/root/repo/src/core/model/des-metrics.h
\ No newline at end of file
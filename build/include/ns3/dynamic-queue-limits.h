@@ -0,0 +1 @@
+/root/repo/src/network/utils/dynamic-queue-limits.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/empty.h
\ No newline at end of file
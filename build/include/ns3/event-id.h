@@ -0,0 +1 @@
+/root/repo/src/core/model/event-id.h
\ No newline at end of file
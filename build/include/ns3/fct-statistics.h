@@ -0,0 +1 @@
+/root/repo/src/dcb/helper/fct-statistics.h
\ No newline at end of file
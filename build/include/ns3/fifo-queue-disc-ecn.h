@@ -0,0 +1 @@
+/root/repo/src/dcb/model/fifo-queue-disc-ecn.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/protobuf-loader/helper/flow-replayer.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/protobuf-loader/model/flows.pb.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/model/header.h
\ No newline at end of file
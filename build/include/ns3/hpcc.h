@@ -0,0 +1 @@
+/root/repo/src/dcb/model/hpcc.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/icmpv4.h
\ No newline at end of file
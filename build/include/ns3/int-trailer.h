@@ -0,0 +1 @@
+/root/repo/src/dcb/model/int-trailer.h
\ No newline at end of file
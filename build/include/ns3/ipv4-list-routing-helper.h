@@ -0,0 +1 @@
+/root/repo/src/internet/helper/ipv4-list-routing-helper.h
\ No newline at end of file
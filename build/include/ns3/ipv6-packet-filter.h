@@ -0,0 +1 @@
+/root/repo/src/internet/model/ipv6-packet-filter.h
\ No newline at end of file
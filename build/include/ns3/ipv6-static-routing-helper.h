@@ -0,0 +1 @@
+/root/repo/src/internet/helper/ipv6-static-routing-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/ladder-scheduler.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/map-scheduler.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/mpi/model/mpi-interface.h
\ No newline at end of file
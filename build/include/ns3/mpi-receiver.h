@@ -0,0 +1 @@
+/root/repo/src/mpi/model/mpi-receiver.h
\ No newline at end of file
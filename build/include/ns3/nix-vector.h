@@ -0,0 +1 @@
+/root/repo/src/network/model/nix-vector.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/applications/model/onoff-application.h
\ No newline at end of file
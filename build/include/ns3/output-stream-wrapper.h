@@ -0,0 +1 @@
+/root/repo/src/network/utils/output-stream-wrapper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/mpi/model/parallel-communication-interface.h
\ No newline at end of file
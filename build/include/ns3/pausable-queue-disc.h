@@ -0,0 +1 @@
+/root/repo/src/dcb/model/pausable-queue-disc.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/utils/pcap-file.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/utils/pfc-frame.h
\ No newline at end of file
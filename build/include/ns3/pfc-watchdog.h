@@ -0,0 +1 @@
+/root/repo/src/dcb/model/pfc-watchdog.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/point-to-point/model/point-to-point-remote-channel.h
\ No newline at end of file
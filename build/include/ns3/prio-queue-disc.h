@@ -0,0 +1 @@
+/root/repo/src/traffic-control/model/prio-queue-disc.h
\ No newline at end of file
@@ -0,0 +1,12 @@
+#ifdef NS3_MODULE_COMPILATION 
+    error "Do not include ns3 module aggregator headers from other modules these are meant only for end user scripts." 
+#endif 
+#ifndef NS3_MODULE_PROTOBUF_LOADER
+    // Module headers: 
+    #include <ns3/protobuf-topology-loader.h>
+    #include <ns3/configurations-loader.h>
+    #include <ns3/sweep-runner.h>
+    #include <ns3/flow-replayer.h>
+    #include <ns3/configurations.pb.h>
+    #include <ns3/flows.pb.h>
+#endif 
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/protobuf-loader/helper/protobuf-topology-loader.h
\ No newline at end of file
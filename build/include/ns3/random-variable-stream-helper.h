@@ -0,0 +1 @@
+/root/repo/src/core/helper/random-variable-stream-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/model/rocev2-congestion-ops.h
\ No newline at end of file
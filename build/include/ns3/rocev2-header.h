@@ -0,0 +1 @@
+/root/repo/src/internet/model/rocev2-header.h
\ No newline at end of file
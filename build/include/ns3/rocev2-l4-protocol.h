@@ -0,0 +1 @@
+/root/repo/src/dcb/model/rocev2-l4-protocol.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/model/rocev2-socket.h
\ No newline at end of file
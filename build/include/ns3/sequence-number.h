@@ -0,0 +1 @@
+/root/repo/src/network/utils/sequence-number.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/simulator-impl.h
\ No newline at end of file
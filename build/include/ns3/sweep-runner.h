@@ -0,0 +1 @@
+/root/repo/src/protobuf-loader/helper/sweep-runner.h
\ No newline at end of file
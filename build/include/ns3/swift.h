@@ -0,0 +1 @@
+/root/repo/src/dcb/model/swift.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/system-path.h
\ No newline at end of file
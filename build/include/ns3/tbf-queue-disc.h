@@ -0,0 +1 @@
+/root/repo/src/traffic-control/model/tbf-queue-disc.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/tcp-congestion-ops.h
\ No newline at end of file
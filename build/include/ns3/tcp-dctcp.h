@@ -0,0 +1 @@
+/root/repo/src/internet/model/tcp-dctcp.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/tcp-ledbat.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/tcp-socket-base.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/tcp-tx-item.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/applications/model/three-gpp-http-client.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/applications/model/three-gpp-http-server.h
\ No newline at end of file
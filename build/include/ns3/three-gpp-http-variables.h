@@ -0,0 +1 @@
+/root/repo/src/applications/model/three-gpp-http-variables.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/model/timely.h
\ No newline at end of file
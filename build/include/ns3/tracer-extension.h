@@ -0,0 +1 @@
+/root/repo/src/dcb/helper/tracer-extension.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/model/udp-based-l4-protocol.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dcb/model/udp-based-socket.h
\ No newline at end of file
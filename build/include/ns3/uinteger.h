@@ -0,0 +1 @@
+/root/repo/src/core/model/uinteger.h
\ No newline at end of file
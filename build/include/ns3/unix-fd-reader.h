@@ -0,0 +1 @@
+/root/repo/src/core/model/unix-fd-reader.h
\ No newline at end of file
@@ -1,5 +1,7 @@
 from configurations_pb2 import GlobalConfig, HostPortConfig, HostGroup, PortQueueConfig, \
-    SwitchPortConfig, SwitchGroup, AllNodes, Link, Topology, Application, Configurations
+    SwitchPortConfig, SharedBufferConfig, LoadBalanceConfig, SwitchGroup, AllNodes, Link, Topology, Application, Configurations, \
+    SweepParameter, Sweep
+from flows_pb2 import Flow, Flows
 from collections.abc import Iterable
 from typing import List, Tuple
 import re
@@ -123,15 +125,25 @@ class NodesGenerator:
 
     def addSwitchGroup(self, num: int,
                        pfcDynamic: bool, bufferSize: str,
-                       queueNum: int, ports: List[dict]):
+                       queueNum: int, ports: List[dict], sharedBuffer: dict=None,
+                       loadBalance: dict=None, intEnabled: bool=False):
+        '''`loadBalance` is like {"mode": "FLOWLET", "flowletGap": "50us"}, the mode
+        is one of ECMP, PACKET_SPRAY, FLOWLET and CONGESTION_AWARE.
+        `intEnabled` lets the switches write INT hops, e.g., for HPCC.'''
         if not isinstance(ports, list):
             raise TypeError("parameter `ports` should be a list")
         self.state = self.State.ADDING_SWITCH
         group = SwitchGroup()
-        # if pfcDynamic:
-        #     group.pfcDynamicShift = 2
+        if sharedBuffer is not None:
+            group.sharedBuffer.CopyFrom(_setValuesToMessage(SharedBufferConfig, sharedBuffer))
+        if loadBalance is not None:
+            loadBalance = dict(loadBalance)
+            if isinstance(loadBalance.get("mode"), str):
+                loadBalance["mode"] = LoadBalanceConfig.Mode.Value(loadBalance["mode"])
+            group.loadBalance.CopyFrom(_setValuesToMessage(LoadBalanceConfig, loadBalance))
         group.bufferSize = bufferSize.replace(" ", "")
         group.queueNum = queueNum
+        group.intEnabled = intEnabled
         group.ports.extend([switchPortGenerate(queueNum, **port) for port in ports])
         return self.addToGroup(self.switchGroups, group, num)
 
@@ -487,6 +499,41 @@ class Configure:
     def serializeToDefault(self):
         self.serializeTo(self.outputFile)
 
+    def serializeSweepTo(self, parameters: dict, stopTime: str, runs=1,
+                         outputDir="data/sweep", fname="config/sweep.bin", **kwargs):
+        """Serialize a sweep of these configurations to be run by scratch/sweep.cc
+
+        :param parameters: values of each swept parameter, e.g., {"load": [0.3, 0.5]}
+        :param stopTime: the stop time of each run
+        :param runs: number of runs of each combination of values, each with its own RngRun
+        :param outputDir: directory of the results
+        :param kwargs: other fields of Sweep, i.e., lineRate, baseRtt and fctSizeBins
+        :returns: None
+
+        """
+        sweep = _setValuesToMessage(Sweep, dict(stopTime=stopTime, runs=runs,
+                                                outputDir=outputDir, **kwargs))
+        sweep.base.CopyFrom(self.getConfigurations())
+        for name, values in parameters.items():
+            sweep.parameters.append(
+                SweepParameter(name=name, values=[str(v).replace(" ", "") for v in values]))
+        Utils.serialize(sweep, fname)
+
+
+def serializeFlows(flows: Iterable[dict], fname="config/flows.bin"):
+    """Serialize pre-generated flows replayed by PreGeneratedApplication
+
+    :param flows: flows of Flow fields, e.g., {"srcNode": 0, "dstNode": 2,
+                  "size": 8192, "arriveTime": 10000}, with arriveTime in ns
+    :param fname: output file name, set as "fileName" of the application
+    :returns: None
+
+    """
+    flowsMsg = Flows()
+    flowsMsg.flows.extend(sorted((_setValuesToMessage(Flow, f) for f in flows),
+                                 key=lambda f: f.arriveTime))
+    Utils.serialize(flowsMsg, fname)
+
 
 class Units:
 
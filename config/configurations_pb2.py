@@ -13,7 +13,7 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x14\x63onfigurations.proto\x12\tns3_proto\"4\n\x0cGlobalConfig\x12\x16\n\toutputFct\x18\x01 \x01(\tH\x00\x88\x01\x01\x42\x0c\n\n_outputFct\"$\n\x0eHostPortConfig\x12\x12\n\npfcEnabled\x18\x01 \x01(\x08\"Z\n\tHostGroup\x12\x10\n\x08nodesNum\x18\x01 \x01(\r\x12\x11\n\tbaseIndex\x18\x02 \x01(\r\x12(\n\x05ports\x18\x03 \x03(\x0b\x32\x19.ns3_proto.HostPortConfig\"\xbf\x01\n\x0fPortQueueConfig\x12\x17\n\npfcReserve\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x13\n\x06pfcXon\x18\x02 \x01(\tH\x01\x88\x01\x01\x12\x14\n\x07\x65\x63nKMin\x18\x04 \x01(\tH\x02\x88\x01\x01\x12\x14\n\x07\x65\x63nKMax\x18\x05 \x01(\tH\x03\x88\x01\x01\x12\x14\n\x07\x65\x63nPMax\x18\x06 \x01(\x01H\x04\x88\x01\x01\x42\r\n\x0b_pfcReserveB\t\n\x07_pfcXonB\n\n\x08_ecnKMinB\n\n\x08_ecnKMaxB\n\n\x08_ecnPMax\"f\n\x10SwitchPortConfig\x12\x12\n\npfcEnabled\x18\x01 \x01(\x08\x12\x12\n\necnEnabled\x18\x02 \x01(\x08\x12*\n\x06queues\x18\x03 \x03(\x0b\x32\x1a.ns3_proto.PortQueueConfig\"\x84\x01\n\x0bSwitchGroup\x12\x10\n\x08nodesNum\x18\x01 \x01(\r\x12\x11\n\tbaseIndex\x18\x02 \x01(\r\x12\x12\n\nbufferSize\x18\x03 \x01(\t\x12\x10\n\x08queueNum\x18\x04 \x01(\r\x12*\n\x05ports\x18\x05 \x03(\x0b\x32\x1b.ns3_proto.SwitchPortConfig\"o\n\x08\x41llNodes\x12\x0b\n\x03num\x18\x01 \x01(\r\x12(\n\nhostGroups\x18\x02 \x03(\x0b\x32\x14.ns3_proto.HostGroup\x12,\n\x0cswitchGroups\x18\x03 \x03(\x0b\x32\x16.ns3_proto.SwitchGroup\"_\n\x04Link\x12\r\n\x05node1\x18\x01 \x01(\r\x12\r\n\x05node2\x18\x02 \x01(\r\x12\r\n\x05port1\x18\x03 \x01(\r\x12\r\n\x05port2\x18\x04 \x01(\r\x12\x0c\n\x04rate\x18\x05 \x01(\t\x12\r\n\x05\x64\x65lay\x18\x06 \x01(\t\"\xd8\x01\n\x0b\x41pplication\x12\x13\n\x0bnodeIndices\x18\x01 \x03(\r\x12\x0f\n\x07\x61ppName\x18\x02 \x01(\t\x12\x1a\n\rprotocolGroup\x18\x03 \x01(\tH\x00\x88\x01\x01\x12\x10\n\x03\x61rg\x18\x04 \x01(\tH\x01\x88\x01\x01\x12\x11\n\x04load\x18\x05 \x01(\x01H\x02\x88\x01\x01\x12\x11\n\tstartTime\x18\x06 \x01(\t\x12\x10\n\x08stopTime\x18\x07 \x01(\t\x12\x11\n\x04\x64\x65st\x18\x08 \x01(\rH\x03\x88\x01\x01\x42\x10\n\x0e_protocolGroupB\x06\n\x04_argB\x07\n\x05_loadB\x07\n\x05_dest\"N\n\x08Topology\x12\"\n\x05nodes\x18\x01 \x01(\x0b\x32\x13.ns3_proto.AllNodes\x12\x1e\n\x05links\x18\x02 \x03(\x0b\x32\x0f.ns3_proto.Link\"\x94\x01\n\x0e\x43onfigurations\x12-\n\x0cglobalConfig\x18\x01 \x01(\x0b\x32\x17.ns3_proto.GlobalConfig\x12%\n\x08topology\x18\x02 \x01(\x0b\x32\x13.ns3_proto.Topology\x12,\n\x0c\x61pplications\x18\x03 \x03(\x0b\x32\x16.ns3_proto.Applicationb\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x14\x63onfigurations.proto\x12\tns3_proto\"^\n\x0cGlobalConfig\x12\x16\n\toutputFct\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x18\n\x0b\x62inaryTrace\x18\x02 \x01(\tH\x01\x88\x01\x01\x42\x0c\n\n_outputFctB\x0e\n\x0c_binaryTrace\"$\n\x0eHostPortConfig\x12\x12\n\npfcEnabled\x18\x01 \x01(\x08\"Z\n\tHostGroup\x12\x10\n\x08nodesNum\x18\x01 \x01(\r\x12\x11\n\tbaseIndex\x18\x02 \x01(\r\x12(\n\x05ports\x18\x03 \x03(\x0b\x32\x19.ns3_proto.HostPortConfig\"\xe5\x01\n\x0fPortQueueConfig\x12\x17\n\npfcReserve\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x13\n\x06pfcXon\x18\x02 \x01(\tH\x01\x88\x01\x01\x12\x14\n\x07\x65\x63nKMin\x18\x04 \x01(\tH\x02\x88\x01\x01\x12\x14\n\x07\x65\x63nKMax\x18\x05 \x01(\tH\x03\x88\x01\x01\x12\x14\n\x07\x65\x63nPMax\x18\x06 \x01(\x01H\x04\x88\x01\x01\x12\x16\n\tetsWeight\x18\x07 \x01(\rH\x05\x88\x01\x01\x42\r\n\x0b_pfcReserveB\t\n\x07_pfcXonB\n\n\x08_ecnKMinB\n\n\x08_ecnKMaxB\n\n\x08_ecnPMaxB\x0c\n\n_etsWeight\"f\n\x10SwitchPortConfig\x12\x12\n\npfcEnabled\x18\x01 \x01(\x08\x12\x12\n\necnEnabled\x18\x02 \x01(\x08\x12*\n\x06queues\x18\x03 \x03(\x0b\x32\x1a.ns3_proto.PortQueueConfig\"\x80\x01\n\x12SharedBufferConfig\x12\x0f\n\x07reserve\x18\x01 \x01(\t\x12\x10\n\x08headroom\x18\x02 \x01(\t\x12\x10\n\x08pfcAlpha\x18\x03 \x01(\x01\x12\x11\n\txonOffset\x18\x04 \x01(\t\x12\x15\n\x08\x65\x63nAlpha\x18\x05 \x01(\x01H\x00\x88\x01\x01\x42\x0b\n\t_ecnAlpha\"\x9f\x01\n\x11LoadBalanceConfig\x12/\n\x04mode\x18\x01 \x01(\x0e\x32!.ns3_proto.LoadBalanceConfig.Mode\x12\x12\n\nflowletGap\x18\x02 \x01(\t\"E\n\x04Mode\x12\x08\n\x04\x45\x43MP\x10\x00\x12\x10\n\x0cPACKET_SPRAY\x10\x01\x12\x0b\n\x07\x46LOWLET\x10\x02\x12\x14\n\x10\x43ONGESTION_AWARE\x10\x03\"\x80\x02\n\x0bSwitchGroup\x12\x10\n\x08nodesNum\x18\x01 \x01(\r\x12\x11\n\tbaseIndex\x18\x02 \x01(\r\x12\x12\n\nbufferSize\x18\x03 \x01(\t\x12\x10\n\x08queueNum\x18\x04 \x01(\r\x12*\n\x05ports\x18\x05 \x03(\x0b\x32\x1b.ns3_proto.SwitchPortConfig\x12\x33\n\x0csharedBuffer\x18\x06 \x01(\x0b\x32\x1d.ns3_proto.SharedBufferConfig\x12\x31\n\x0bloadBalance\x18\x07 \x01(\x0b\x32\x1c.ns3_proto.LoadBalanceConfig\x12\x12\n\nintEnabled\x18\x08 \x01(\x08\"\x82\x01\n\x08\x41llNodes\x12\x0b\n\x03num\x18\x01 \x01(\r\x12(\n\nhostGroups\x18\x02 \x03(\x0b\x32\x14.ns3_proto.HostGroup\x12,\n\x0cswitchGroups\x18\x03 \x03(\x0b\x32\x16.ns3_proto.SwitchGroup\x12\x11\n\tsystemIds\x18\x04 \x03(\r\"_\n\x04Link\x12\r\n\x05node1\x18\x01 \x01(\r\x12\r\n\x05node2\x18\x02 \x01(\r\x12\r\n\x05port1\x18\x03 \x01(\r\x12\r\n\x05port2\x18\x04 \x01(\r\x12\x0c\n\x04rate\x18\x05 \x01(\t\x12\r\n\x05\x64\x65lay\x18\x06 \x01(\t\"\xfc\x01\n\x0b\x41pplication\x12\x13\n\x0bnodeIndices\x18\x01 \x03(\r\x12\x0f\n\x07\x61ppName\x18\x02 \x01(\t\x12\x1a\n\rprotocolGroup\x18\x03 \x01(\tH\x00\x88\x01\x01\x12\x10\n\x03\x61rg\x18\x04 \x01(\tH\x01\x88\x01\x01\x12\x11\n\x04load\x18\x05 \x01(\x01H\x02\x88\x01\x01\x12\x11\n\tstartTime\x18\x06 \x01(\t\x12\x10\n\x08stopTime\x18\x07 \x01(\t\x12\x11\n\x04\x64\x65st\x18\x08 \x01(\rH\x03\x88\x01\x01\x12\x15\n\x08\x66ileName\x18\t \x01(\tH\x04\x88\x01\x01\x42\x10\n\x0e_protocolGroupB\x06\n\x04_argB\x07\n\x05_loadB\x07\n\x05_destB\x0b\n\t_fileName\"N\n\x08Topology\x12\"\n\x05nodes\x18\x01 \x01(\x0b\x32\x13.ns3_proto.AllNodes\x12\x1e\n\x05links\x18\x02 \x03(\x0b\x32\x0f.ns3_proto.Link\"\x94\x01\n\x0e\x43onfigurations\x12-\n\x0cglobalConfig\x18\x01 \x01(\x0b\x32\x17.ns3_proto.GlobalConfig\x12%\n\x08topology\x18\x02 \x01(\x0b\x32\x13.ns3_proto.Topology\x12,\n\x0c\x61pplications\x18\x03 \x03(\x0b\x32\x16.ns3_proto.Application\".\n\x0eSweepParameter\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06values\x18\x02 \x03(\t\"\xed\x01\n\x05Sweep\x12\'\n\x04\x62\x61se\x18\x01 \x01(\x0b\x32\x19.ns3_proto.Configurations\x12-\n\nparameters\x18\x02 \x03(\x0b\x32\x19.ns3_proto.SweepParameter\x12\x0c\n\x04runs\x18\x03 \x01(\r\x12\x11\n\toutputDir\x18\x04 \x01(\t\x12\x10\n\x08stopTime\x18\x05 \x01(\t\x12\x15\n\x08lineRate\x18\x06 \x01(\tH\x00\x88\x01\x01\x12\x14\n\x07\x62\x61seRtt\x18\x07 \x01(\tH\x01\x88\x01\x01\x12\x13\n\x0b\x66\x63tSizeBins\x18\x08 \x03(\x04\x42\x0b\n\t_lineRateB\n\n\x08_baseRttb\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'configurations_pb2', globals())
@@ -21,25 +21,35 @@ if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
   _GLOBALCONFIG._serialized_start=35
-  _GLOBALCONFIG._serialized_end=87
-  _HOSTPORTCONFIG._serialized_start=89
-  _HOSTPORTCONFIG._serialized_end=125
-  _HOSTGROUP._serialized_start=127
-  _HOSTGROUP._serialized_end=217
-  _PORTQUEUECONFIG._serialized_start=220
-  _PORTQUEUECONFIG._serialized_end=411
-  _SWITCHPORTCONFIG._serialized_start=413
-  _SWITCHPORTCONFIG._serialized_end=515
-  _SWITCHGROUP._serialized_start=518
-  _SWITCHGROUP._serialized_end=650
-  _ALLNODES._serialized_start=652
-  _ALLNODES._serialized_end=763
-  _LINK._serialized_start=765
-  _LINK._serialized_end=860
-  _APPLICATION._serialized_start=863
-  _APPLICATION._serialized_end=1079
-  _TOPOLOGY._serialized_start=1081
-  _TOPOLOGY._serialized_end=1159
-  _CONFIGURATIONS._serialized_start=1162
-  _CONFIGURATIONS._serialized_end=1310
+  _GLOBALCONFIG._serialized_end=129
+  _HOSTPORTCONFIG._serialized_start=131
+  _HOSTPORTCONFIG._serialized_end=167
+  _HOSTGROUP._serialized_start=169
+  _HOSTGROUP._serialized_end=259
+  _PORTQUEUECONFIG._serialized_start=262
+  _PORTQUEUECONFIG._serialized_end=491
+  _SWITCHPORTCONFIG._serialized_start=493
+  _SWITCHPORTCONFIG._serialized_end=595
+  _SHAREDBUFFERCONFIG._serialized_start=598
+  _SHAREDBUFFERCONFIG._serialized_end=726
+  _LOADBALANCECONFIG._serialized_start=729
+  _LOADBALANCECONFIG._serialized_end=888
+  _LOADBALANCECONFIG_MODE._serialized_start=819
+  _LOADBALANCECONFIG_MODE._serialized_end=888
+  _SWITCHGROUP._serialized_start=891
+  _SWITCHGROUP._serialized_end=1147
+  _ALLNODES._serialized_start=1150
+  _ALLNODES._serialized_end=1280
+  _LINK._serialized_start=1282
+  _LINK._serialized_end=1377
+  _APPLICATION._serialized_start=1380
+  _APPLICATION._serialized_end=1632
+  _TOPOLOGY._serialized_start=1634
+  _TOPOLOGY._serialized_end=1712
+  _CONFIGURATIONS._serialized_start=1715
+  _CONFIGURATIONS._serialized_end=1863
+  _SWEEPPARAMETER._serialized_start=1865
+  _SWEEPPARAMETER._serialized_end=1911
+  _SWEEP._serialized_start=1914
+  _SWEEP._serialized_end=2151
 # @@protoc_insertion_point(module_scope)
@@ -12,7 +12,9 @@ from config_helper import Configure
 
 globalConfig = {
     "outputDir": "data/", # all files below will be stored in `outputDir`
-    "outputFct": "fct.csv"
+    "outputFct": "fct.csv",
+    # "binaryTrace": "trace.bin", # rate, queue and buffer overflow traces in one file,
+    #                             # see utils/dcb-trace-convert.py
 }
 
 hostPortConfig = {
@@ -13,7 +13,7 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0b\x66lows.proto\x12\tns3_proto\"\x90\x01\n\x04\x46low\x12\x0f\n\x07srcNode\x18\x01 \x01(\r\x12\x0f\n\x07srcPort\x18\x02 \x01(\r\x12\x0f\n\x07\x64stNode\x18\x03 \x01(\r\x12\x0f\n\x07\x64stPort\x18\x04 \x01(\r\x12\x0c\n\x04size\x18\x05 \x01(\r\x12\x12\n\narriveTime\x18\x06 \x01(\r\x12\x15\n\x08priority\x18\x07 \x01(\rH\x00\x88\x01\x01\x42\x0b\n\t_priority\"\'\n\x05\x46lows\x12\x1e\n\x05\x66lows\x18\x01 \x03(\x0b\x32\x0f.ns3_proto.Flowb\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0b\x66lows.proto\x12\tns3_proto\"\x90\x01\n\x04\x46low\x12\x0f\n\x07srcNode\x18\x01 \x01(\r\x12\x0f\n\x07srcPort\x18\x02 \x01(\r\x12\x0f\n\x07\x64stNode\x18\x03 \x01(\r\x12\x0f\n\x07\x64stPort\x18\x04 \x01(\r\x12\x0c\n\x04size\x18\x05 \x01(\r\x12\x12\n\narriveTime\x18\x06 \x01(\x04\x12\x15\n\x08priority\x18\x07 \x01(\rH\x00\x88\x01\x01\x42\x0b\n\t_priority\"\'\n\x05\x46lows\x12\x1e\n\x05\x66lows\x18\x01 \x03(\x0b\x32\x0f.ns3_proto.Flowb\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'flows_pb2', globals())
@@ -50,8 +50,7 @@ main ()
   LogComponentEnableAll (LOG_PREFIX_LEVEL);
   LogComponentEnableAll (LOG_PREFIX_NODE);
 
-  tracer_extension::ConfigOutputDirectory ("data");
-  tracer_extension::ConfigTraceFCT (tracer_extension::Protocol::RoCEv2, "fct.csv");
+  configurations::ConfigTracers (config);
   tracer_extension::ConfigStopTime (MilliSeconds(6));
 
   // capture packet at host-0
@@ -0,0 +1,41 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg (pavin0702@gmail.com)
+ */
+
+// Run a parameter sweep generated by Configure.serializeSweepTo in
+// config/config_helper.py, see configurations::RunSweep.
+// Sample usage:  ./ns3 run 'sweep --sweep=config/sweep.bin --processes=16'
+
+#include "ns3/command-line.h"
+#include "ns3/sweep-runner.h"
+
+using namespace ns3;
+
+int
+main (int argc, char *argv[])
+{
+  std::string sweepFile = configurations::sweepBinaryName;
+  uint32_t processes = 0;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("sweep", "the Protobuf binary of the sweep", sweepFile);
+  cmd.AddValue ("processes", "the number of runs at a time, 0 for all cores", processes);
+  cmd.Parse (argc, argv);
+
+  const ns3_proto::Sweep sweep = configurations::LoadSweep (sweepFile);
+  return configurations::RunSweep (sweep, processes) ? 1 : 0;
+}
@@ -0,0 +1,355 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#include "ladder-scheduler.h"
+#include "event-impl.h"
+#include "assert.h"
+#include "log.h"
+#include <algorithm>
+#include <limits>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::LadderScheduler class implementation.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LadderScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED (LadderScheduler);
+
+namespace {
+
+/** A bucket with more events than this is split into a new rung. */
+const uint32_t THRESHOLD = 50;
+/** The maximum number of rungs. */
+const uint32_t MAX_RUNGS = 8;
+/** The maximum number of buckets of a rung. */
+const uint32_t MAX_BUCKETS = 1 << 16;
+/** The number of nodes the pool grows by. */
+const std::size_t CHUNK_SIZE = 1024;
+/** Bottom drops the events it dequeued when it holds more than this. */
+const std::size_t BOTTOM_COMPACT = 1024;
+
+} // unnamed namespace
+
+TypeId
+LadderScheduler::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LadderScheduler")
+    .SetParent<Scheduler> ()
+    .SetGroupName ("Core")
+    .AddConstructor<LadderScheduler> ()
+  ;
+  return tid;
+}
+
+LadderScheduler::LadderScheduler ()
+  : m_top (0),
+    m_topCount (0),
+    m_topMin (std::numeric_limits<uint64_t>::max ()),
+    m_topMax (0),
+    m_topStart (0),
+    m_nRungs (0),
+    m_bottomHead (0),
+    m_freeNodes (0),
+    m_qSize (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+LadderScheduler::~LadderScheduler ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+LadderScheduler::Node *
+LadderScheduler::AllocateNode (const Scheduler::Event &ev)
+{
+  if (m_freeNodes == 0)
+    {
+      std::unique_ptr<Node[]> chunk (new Node[CHUNK_SIZE]);
+      for (std::size_t i = 0; i < CHUNK_SIZE; i++)
+        {
+          chunk[i].next = m_freeNodes;
+          m_freeNodes = &chunk[i];
+        }
+      m_chunks.push_back (std::move (chunk));
+    }
+  Node *node = m_freeNodes;
+  m_freeNodes = node->next;
+  node->ev = ev;
+  node->next = 0;
+  return node;
+}
+
+void
+LadderScheduler::FreeNode (Node *node)
+{
+  node->next = m_freeNodes;
+  m_freeNodes = node;
+}
+
+void
+LadderScheduler::Insert (const Scheduler::Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  m_qSize++;
+  const uint64_t ts = ev.key.m_ts;
+  if (ts >= m_topStart)
+    {
+      Node *node = AllocateNode (ev);
+      node->next = m_top;
+      m_top = node;
+      m_topCount++;
+      m_topMin = std::min (m_topMin, ts);
+      m_topMax = std::max (m_topMax, ts);
+      return;
+    }
+  for (uint32_t i = 0; i < m_nRungs; i++)
+    {
+      Rung &rung = m_rungs[i];
+      if (ts >= rung.start + rung.current * rung.width)
+        {
+          InsertRung (rung, AllocateNode (ev));
+          return;
+        }
+    }
+  InsertBottom (ev);
+}
+
+void
+LadderScheduler::InsertRung (Rung &rung, Node *node)
+{
+  const uint64_t i = (node->ev.key.m_ts - rung.start) / rung.width;
+  NS_ASSERT (i >= rung.current && i < rung.buckets.size ());
+  node->next = rung.buckets[i];
+  rung.buckets[i] = node;
+  rung.counts[i]++;
+  rung.nEvents++;
+}
+
+void
+LadderScheduler::InsertBottom (const Scheduler::Event &ev)
+{
+  if (m_bottomHead == m_bottom.size ())
+    {
+      m_bottom.clear ();
+      m_bottomHead = 0;
+    }
+  else if (m_bottomHead > BOTTOM_COMPACT && m_bottomHead * 2 > m_bottom.size ())
+    {
+      m_bottom.erase (m_bottom.begin (), m_bottom.begin () + m_bottomHead);
+      m_bottomHead = 0;
+    }
+  // new events are usually later than most of Bottom, so few are moved
+  m_bottom.insert (std::upper_bound (m_bottom.begin () + m_bottomHead, m_bottom.end (), ev), ev);
+}
+
+LadderScheduler::Rung &
+LadderScheduler::PushRung (uint64_t start, uint64_t span, uint32_t nEvents)
+{
+  if (m_nRungs == m_rungs.size ())
+    {
+      m_rungs.emplace_back ();
+    }
+  Rung &rung = m_rungs[m_nRungs++];
+  uint64_t nBuckets = std::min (std::max (nEvents, 1u), MAX_BUCKETS);
+  rung.width = (span + nBuckets - 1) / nBuckets;
+  nBuckets = (span + rung.width - 1) / rung.width;
+  rung.buckets.assign (nBuckets, 0);
+  rung.counts.assign (nBuckets, 0);
+  rung.start = start;
+  rung.current = 0;
+  rung.nEvents = 0;
+  NS_LOG_LOGIC ("rung " << m_nRungs - 1 << " of " << nBuckets << " buckets from " << start
+                << " width " << rung.width << " for " << nEvents << " events");
+  return rung;
+}
+
+void
+LadderScheduler::FillBottom (Node *list)
+{
+  m_bottom.clear ();
+  m_bottomHead = 0;
+  while (list != 0)
+    {
+      Node *next = list->next;
+      m_bottom.push_back (list->ev);
+      FreeNode (list);
+      list = next;
+    }
+  std::sort (m_bottom.begin (), m_bottom.end ());
+}
+
+void
+LadderScheduler::Settle (void)
+{
+  if (m_bottomHead < m_bottom.size ())
+    {
+      return;
+    }
+  NS_ASSERT (m_qSize > 0);
+  while (true)
+    {
+      if (m_nRungs == 0)
+        {
+          NS_ASSERT (m_topCount > 0);
+          Node *list = m_top;
+          const uint32_t count = m_topCount;
+          const uint64_t min = m_topMin;
+          const uint64_t max = m_topMax;
+          m_top = 0;
+          m_topCount = 0;
+          m_topMin = std::numeric_limits<uint64_t>::max ();
+          m_topMax = 0;
+          if (count <= THRESHOLD)
+            {
+              m_topStart = max + 1;
+              FillBottom (list);
+              return;
+            }
+          Rung &rung = PushRung (min, max - min + 1, count);
+          m_topStart = rung.start + rung.buckets.size () * rung.width;
+          while (list != 0)
+            {
+              Node *next = list->next;
+              InsertRung (rung, list);
+              list = next;
+            }
+          continue;
+        }
+
+      Rung &rung = m_rungs[m_nRungs - 1];
+      if (rung.nEvents == 0)
+        {
+          m_nRungs--;
+          continue;
+        }
+      uint32_t i = rung.current;
+      while (rung.buckets[i] == 0)
+        {
+          i++;
+        }
+      Node *list = rung.buckets[i];
+      const uint32_t count = rung.counts[i];
+      rung.buckets[i] = 0;
+      rung.counts[i] = 0;
+      rung.current = i + 1;
+      rung.nEvents -= count;
+      if (count > THRESHOLD && rung.width > 1 && m_nRungs < MAX_RUNGS)
+        {
+          const uint64_t start = rung.start + i * rung.width;
+          Rung &child = PushRung (start, rung.width, count); // rung is invalid now
+          while (list != 0)
+            {
+              Node *next = list->next;
+              InsertRung (child, list);
+              list = next;
+            }
+          continue;
+        }
+      FillBottom (list);
+      return;
+    }
+}
+
+bool
+LadderScheduler::IsEmpty (void) const
+{
+  return m_qSize == 0;
+}
+
+Scheduler::Event
+LadderScheduler::PeekNext (void) const
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+  // moving events between the tiers does not change their order
+  const_cast<LadderScheduler *> (this)->Settle ();
+  return m_bottom[m_bottomHead];
+}
+
+Scheduler::Event
+LadderScheduler::RemoveNext (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+  Settle ();
+  m_qSize--;
+  return m_bottom[m_bottomHead++];
+}
+
+bool
+LadderScheduler::RemoveFromList (Node **list, const Scheduler::Event &ev)
+{
+  for (Node **prev = list; *prev != 0; prev = &(*prev)->next)
+    {
+      if ((*prev)->ev == ev)
+        {
+          Node *node = *prev;
+          *prev = node->next;
+          FreeNode (node);
+          return true;
+        }
+    }
+  return false;
+}
+
+void
+LadderScheduler::Remove (const Scheduler::Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  NS_ASSERT (!IsEmpty ());
+  m_qSize--;
+  const uint64_t ts = ev.key.m_ts;
+  if (ts >= m_topStart)
+    {
+      bool found = RemoveFromList (&m_top, ev);
+      NS_ASSERT_MSG (found, "Event " << ev.key.m_uid << " not in Top");
+      m_topCount--;
+      if (m_topCount == 0)
+        {
+          m_topMin = std::numeric_limits<uint64_t>::max ();
+          m_topMax = 0;
+        }
+      return;
+    }
+  for (uint32_t i = 0; i < m_nRungs; i++)
+    {
+      Rung &rung = m_rungs[i];
+      if (ts >= rung.start + rung.current * rung.width)
+        {
+          const uint64_t b = (ts - rung.start) / rung.width;
+          bool found = RemoveFromList (&rung.buckets[b], ev);
+          NS_ASSERT_MSG (found, "Event " << ev.key.m_uid << " not in rung " << i);
+          rung.counts[b]--;
+          rung.nEvents--;
+          return;
+        }
+    }
+  std::vector<Scheduler::Event>::iterator it =
+    std::lower_bound (m_bottom.begin () + m_bottomHead, m_bottom.end (), ev);
+  NS_ASSERT_MSG (it != m_bottom.end () && *it == ev,
+                 "Event " << ev.key.m_uid << " not in Bottom");
+  m_bottom.erase (it);
+}
+
+} // namespace ns3
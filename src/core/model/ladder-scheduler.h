@@ -0,0 +1,205 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#ifndef LADDER_SCHEDULER_H
+#define LADDER_SCHEDULER_H
+
+#include "scheduler.h"
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::LadderScheduler class declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup scheduler
+ * \brief a ladder queue event scheduler
+ *
+ * This event scheduler implements the ladder queue of
+ * ["Ladder Queue: An O(1) Priority Queue Structure for Large-Scale
+ * Discrete Event Simulation" by Tang, Goh and Thng][Tang].
+ *
+ * [Tang]: https://doi.org/10.1145/1103323.1103324 "Tang"
+ *
+ * Events are kept in three tiers:
+ *
+ * - Top: an unsorted list of the events later than the ladder.
+ * - Ladder: rungs of buckets, each bucket an unsorted list covering a
+ *   uniform time span.  The first rung is built from Top when the
+ *   ladder runs out of events, with about one bucket per event.  A
+ *   bucket with more than a few events is split into a finer rung
+ *   before it is dequeued.
+ * - Bottom: a sorted `std::vector` of the earliest events, filled from
+ *   one bucket at a time.
+ *
+ * The spans adapt to the events present, so events clustered within
+ * nanoseconds of now, as in packet-level data center simulations, are
+ * sorted a few at a time whatever the time scale.
+ *
+ * The events of Top and the ladder are kept in nodes taken from a pool,
+ * which grows by chunks and never shrinks, so that scheduling an event
+ * does not allocate memory in the steady state.
+ *
+ * \par Time Complexity
+ *
+ * Operation    | Amortized %Time | Reason
+ * :----------- | :-------------- | :-----
+ * Insert()     | ~Constant       | Append to Top or a bucket
+ * IsEmpty()    | Constant        | Explicit queue size
+ * PeekNext()   | ~Constant       | Sort the events of a bucket
+ * Remove()     | ~Constant       | Search within bucket
+ * RemoveNext() | ~Constant       | Sort the events of a bucket
+ *
+ * \par Memory Complexity
+ *
+ * Category  | Memory                           | Reason
+ * :-------- | :------------------------------- | :-----
+ * Overhead  | Bucket arrays of the rungs       | One pointer and count per bucket
+ * Per Event | 8 bytes                          | `next` pointer of the pooled node
+ */
+class LadderScheduler : public Scheduler
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  LadderScheduler ();
+  /** Destructor. */
+  virtual ~LadderScheduler ();
+
+  // Inherited
+  virtual void Insert (const Scheduler::Event &ev);
+  virtual bool IsEmpty (void) const;
+  virtual Scheduler::Event PeekNext (void) const;
+  virtual Scheduler::Event RemoveNext (void);
+  virtual void Remove (const Scheduler::Event &ev);
+
+private:
+  /** An event in Top or a bucket. */
+  struct Node
+  {
+    Scheduler::Event ev;  /**< The event. */
+    Node *next;           /**< The next node of the list. */
+  };
+
+  /** A rung of the ladder. */
+  struct Rung
+  {
+    std::vector<Node *> buckets;    /**< The list of events of each bucket. */
+    std::vector<uint32_t> counts;   /**< The number of events of each bucket. */
+    uint64_t start;                 /**< The time of the first bucket. */
+    uint64_t width;                 /**< The time span of a bucket. */
+    uint32_t current;               /**< The first bucket not dequeued. */
+    uint32_t nEvents;               /**< The number of events in the rung. */
+  };
+
+  /**
+   * Get a node from the pool.
+   *
+   * \param [in] ev The event of the node.
+   * \returns The node.
+   */
+  Node * AllocateNode (const Scheduler::Event &ev);
+  /**
+   * Return a node to the pool.
+   *
+   * \param [in] node The node.
+   */
+  void FreeNode (Node *node);
+  /**
+   * Insert an event into Bottom, keeping it sorted.
+   *
+   * \param [in] ev The event.
+   */
+  void InsertBottom (const Scheduler::Event &ev);
+  /**
+   * Insert an event into a bucket of a rung.
+   *
+   * \param [in] rung The rung, which covers the event.
+   * \param [in] node The node of the event.
+   */
+  void InsertRung (Rung &rung, Node *node);
+  /**
+   * Start a new rung covering a time span.
+   *
+   * \param [in] start The start of the span.
+   * \param [in] span The length of the span.
+   * \param [in] nEvents The number of events to distribute.
+   * \returns The new rung.
+   */
+  Rung & PushRung (uint64_t start, uint64_t span, uint32_t nEvents);
+  /**
+   * Move the events of a list into Bottom and sort it.
+   *
+   * \param [in] list The list of events.
+   */
+  void FillBottom (Node *list);
+  /** Fill Bottom with the earliest events if it is empty. */
+  void Settle (void);
+  /**
+   * Remove an event from a list.
+   *
+   * \param [in,out] list The list of events.
+   * \param [in] ev The event to remove.
+   * \returns \c true if the event was in the list.
+   */
+  bool RemoveFromList (Node **list, const Scheduler::Event &ev);
+
+  /** The events later than the ladder. */
+  Node *m_top;
+  /** Number of events in Top. */
+  uint32_t m_topCount;
+  /** The earliest time of the events in Top. */
+  uint64_t m_topMin;
+  /** The latest time of the events in Top. */
+  uint64_t m_topMax;
+  /** Events at or after this time go to Top. */
+  uint64_t m_topStart;
+
+  /** The rungs, of which the first m_nRungs are in use. */
+  std::vector<Rung> m_rungs;
+  /** Number of rungs in use. */
+  uint32_t m_nRungs;
+
+  /** The earliest events, sorted, from m_bottomHead on. */
+  std::vector<Scheduler::Event> m_bottom;
+  /** The index of the first event in m_bottom. */
+  std::size_t m_bottomHead;
+
+  /** Nodes that are not in use. */
+  Node *m_freeNodes;
+  /** The chunks of nodes of the pool. */
+  std::vector<std::unique_ptr<Node[]> > m_chunks;
+
+  /** Number of events in queue. */
+  uint32_t m_qSize;
+};
+
+} // namespace ns3
+
+#endif /* LADDER_SCHEDULER_H */
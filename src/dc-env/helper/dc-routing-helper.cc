@@ -0,0 +1,228 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg (pavin0702@gmail.com)
+ */
+
+#include "dc-routing-helper.h"
+#include "ns3/channel.h"
+#include "ns3/fatal-error.h"
+#include "ns3/global-router-interface.h"
+#include "ns3/ipv4-global-routing.h"
+#include "ns3/ipv4.h"
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include <limits>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup dc-env
+ * ns3::DcRoutingHelper implementation
+ */
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("DcRoutingHelper");
+
+namespace {
+
+/// One link of a node as seen by the routing
+struct Adjacency
+{
+  uint32_t peer; //!< topology index of the node at the other end
+  uint32_t interface; //!< local Ipv4 interface of the link
+  Ipv4Address gateway; //!< address of the peer on the link
+};
+
+const uint32_t UNREACHABLE = std::numeric_limits<uint32_t>::max ();
+
+} // namespace
+
+void
+DcRoutingHelper::PopulateRoutingTables (Ptr<const DcTopology> topology)
+{
+  NS_LOG_FUNCTION (topology);
+
+  const uint32_t n = topology->GetNNodes ();
+  std::unordered_map<uint32_t, uint32_t> indexOfNode; // node ID -> topology index
+  for (uint32_t u = 0; u < n; u++)
+    {
+      indexOfNode[topology->GetNode (u)->GetId ()] = u;
+    }
+
+  // Collect the links from the channels of the devices
+  std::vector<std::vector<Adjacency>> adj (n);
+  std::vector<Ptr<Ipv4GlobalRouting>> routing (n);
+  for (uint32_t u = 0; u < n; u++)
+    {
+      Ptr<Node> node = topology->GetNode (u).nodePtr;
+      Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
+      Ptr<GlobalRouter> router = node->GetObject<GlobalRouter> ();
+      if (ipv4 == nullptr || router == nullptr || router->GetRoutingProtocol () == nullptr)
+        {
+          NS_FATAL_ERROR ("Node " << u << " has no Ipv4GlobalRouting to populate");
+        }
+      routing[u] = router->GetRoutingProtocol ();
+      for (uint32_t d = 0; d < node->GetNDevices (); d++)
+        {
+          Ptr<NetDevice> dev = node->GetDevice (d);
+          Ptr<Channel> channel = dev->GetChannel ();
+          int32_t interface = ipv4->GetInterfaceForDevice (dev);
+          if (channel == nullptr || interface < 0 || !ipv4->IsUp (interface))
+            {
+              continue;
+            }
+          for (std::size_t j = 0; j < channel->GetNDevices (); j++)
+            {
+              Ptr<NetDevice> peerDev = channel->GetDevice (j);
+              auto peer = indexOfNode.find (peerDev->GetNode ()->GetId ());
+              if (peerDev == dev || peer == indexOfNode.end ())
+                {
+                  continue;
+                }
+              Ptr<Ipv4> peerIpv4 = peerDev->GetNode ()->GetObject<Ipv4> ();
+              int32_t peerInterface = peerIpv4->GetInterfaceForDevice (peerDev);
+              if (peerInterface < 0 || peerIpv4->GetNAddresses (peerInterface) == 0)
+                {
+                  continue;
+                }
+              adj[u].push_back (Adjacency{peer->second, static_cast<uint32_t> (interface),
+                                          peerIpv4->GetAddress (peerInterface, 0).GetLocal ()});
+            }
+        }
+    }
+
+  // A single-homed host is routed through the BFS of its switch, a multi-homed
+  // one is a BFS source itself.
+  std::map<uint32_t, std::vector<uint32_t>> hostsBehind; // BFS source -> hosts
+  std::vector<bool> singleHomed (n, false);
+  for (uint32_t u = 0; u < n; u++)
+    {
+      if (!topology->IsHost (u) || adj[u].empty ())
+        {
+          continue;
+        }
+      if (adj[u].size () == 1)
+        {
+          singleHomed[u] = true;
+          hostsBehind[adj[u][0].peer].push_back (u);
+          routing[u]->AddNetworkRouteTo (Ipv4Address::GetZero (), Ipv4Mask::GetZero (),
+                                         adj[u][0].gateway, adj[u][0].interface);
+        }
+      else
+        {
+          hostsBehind[u].push_back (u);
+        }
+    }
+
+  std::vector<uint32_t> dist (n);
+  std::vector<uint32_t> queue;
+  queue.reserve (n);
+  std::vector<const Adjacency *> group;
+  for (const auto &behind : hostsBehind)
+    {
+      const uint32_t src = behind.first;
+      // BFS from src, where hosts other than src do not forward
+      std::fill (dist.begin (), dist.end (), UNREACHABLE);
+      queue.clear ();
+      dist[src] = 0;
+      queue.push_back (src);
+      for (std::size_t head = 0; head < queue.size (); head++)
+        {
+          const uint32_t u = queue[head];
+          if (u != src && topology->IsHost (u))
+            {
+              continue;
+            }
+          for (const Adjacency &a : adj[u])
+            {
+              if (dist[a.peer] == UNREACHABLE)
+                {
+                  dist[a.peer] = dist[u] + 1;
+                  queue.push_back (a.peer);
+                }
+            }
+        }
+
+      // the addresses of the hosts behind src
+      std::vector<std::vector<Ipv4Address>> addresses;
+      for (uint32_t host : behind.second)
+        {
+          addresses.emplace_back ();
+          Ptr<Ipv4> ipv4 = topology->GetNode (host)->GetObject<Ipv4> ();
+          for (uint32_t i = 0; i < ipv4->GetNInterfaces (); i++)
+            {
+              for (uint32_t j = 0; j < ipv4->GetNAddresses (i); j++)
+                {
+                  Ipv4Address addr = ipv4->GetAddress (i, j).GetLocal ();
+                  if (!addr.IsLocalhost ())
+                    {
+                      addresses.back ().push_back (addr);
+                    }
+                }
+            }
+        }
+
+      for (uint32_t u : queue)
+        {
+          if (singleHomed[u] || (u == src && topology->IsHost (u)))
+            {
+              continue;
+            }
+          if (u == src)
+            {
+              // the last hop of a switch towards the hosts behind it
+              for (std::size_t h = 0; h < behind.second.size (); h++)
+                {
+                  for (const Adjacency &a : adj[u])
+                    {
+                      if (a.peer != behind.second[h])
+                        {
+                          continue;
+                        }
+                      for (const Ipv4Address &addr : addresses[h])
+                        {
+                          routing[u]->AddHostRouteTo (addr, a.gateway, a.interface);
+                        }
+                    }
+                }
+              continue;
+            }
+          // the ECMP group of u towards src: the neighbors one hop closer that forward
+          group.clear ();
+          for (const Adjacency &a : adj[u])
+            {
+              if (dist[a.peer] + 1 == dist[u] && (a.peer == src || !topology->IsHost (a.peer)))
+                {
+                  group.push_back (&a);
+                }
+            }
+          for (const std::vector<Ipv4Address> &hostAddresses : addresses)
+            {
+              for (const Ipv4Address &addr : hostAddresses)
+                {
+                  for (const Adjacency *a : group)
+                    {
+                      routing[u]->AddHostRouteTo (addr, a->gateway, a->interface);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace ns3
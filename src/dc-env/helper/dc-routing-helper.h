@@ -0,0 +1,62 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg (pavin0702@gmail.com)
+ */
+
+#ifndef DC_ROUTING_HELPER_H
+#define DC_ROUTING_HELPER_H
+
+#include "ns3/dc-topology.h"
+
+/**
+ * \file
+ * \ingroup dc-env
+ * ns3::DcRoutingHelper declaration
+ */
+namespace ns3 {
+
+/**
+ * \brief Populate Ipv4GlobalRouting tables of a datacenter topology by BFS.
+ *
+ * Ipv4GlobalRoutingHelper::PopulateRoutingTables builds LSAs for every node and
+ * runs an SPF per node, which dominates the startup of large fat-trees.  In a
+ * datacenter every link has the same cost and hosts never forward, so the
+ * equal-cost next hops towards a host are the neighbors one hop closer to it
+ * in a BFS from that host.  A single-homed host is one hop behind its switch,
+ * so one BFS from each such switch gives the ECMP groups towards all the hosts
+ * behind it.
+ *
+ * Only host addresses are routed: switches get a host route per host address
+ * with all equal-cost next hops, multi-homed hosts do as well, and single-homed
+ * hosts get a default route through their only interface.  Switch addresses are
+ * not reachable, which is fine since no traffic is sent to switches.
+ *
+ * Every node must have an Ipv4GlobalRouting (through Ipv4GlobalRoutingHelper),
+ * and the routes should be populated only once.
+ */
+class DcRoutingHelper
+{
+public:
+  /**
+   * \brief Install the ECMP routes to every host on all nodes of the topology.
+   * \param topology the topology whose links are all installed
+   */
+  static void PopulateRoutingTables (Ptr<const DcTopology> topology);
+};
+
+} // namespace ns3
+
+#endif // DC_ROUTING_HELPER_H
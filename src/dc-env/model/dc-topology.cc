@@ -84,6 +84,12 @@ DcTopology::InstallLink (const uint32_t node1, const uint32_t node2)
   m_links[node2].push_back (node1);
 }
 
+void
+DcTopology::ReserveLinks (const uint32_t index, const uint32_t nLinks)
+{
+  m_links.at (index).reserve (nLinks);
+}
+
 const DcTopology::TopoNode &
 DcTopology::GetNode (const uint32_t index) const
 {
@@ -95,6 +101,12 @@ DcTopology::GetNode (const uint32_t index) const
   return m_nodes[index];
 }
 
+uint32_t
+DcTopology::GetNNodes () const
+{
+  return m_nodes.size ();
+}
+
 const Ptr<NetDevice>
 DcTopology::GetNetDeviceOfNode (const uint32_t nodei, const uint32_t devi) const
 {
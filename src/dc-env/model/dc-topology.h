@@ -72,8 +72,16 @@ public:
 
   void InstallLink (const uint32_t node1, const uint32_t node2);
 
+  /**
+   * \brief Preallocate the links of a node, e.g., by its number of ports,
+   * before installing them.
+   */
+  void ReserveLinks (const uint32_t index, const uint32_t nLinks);
+
   const TopoNode &GetNode (const uint32_t index) const;
 
+  uint32_t GetNNodes () const;
+
   const Ptr<NetDevice> GetNetDeviceOfNode (const uint32_t nodei, const uint32_t devi) const;
 
   const Ipv4InterfaceAddress GetInterfaceOfNode(const uint32_t nodei, uint32_t intfi) const;
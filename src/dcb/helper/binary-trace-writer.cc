@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#include "binary-trace-writer.h"
+#include "ns3/fatal-error.h"
+
+namespace ns3 {
+
+BinaryTraceWriter::BinaryTraceWriter (const std::string &fileName, std::size_t bufferSize)
+    : m_fileStream (fileName, std::ios::binary | std::ios::trunc),
+      m_buffer (bufferSize),
+      m_used (0),
+      m_nStreams (0)
+{
+  if (!m_fileStream.good ())
+    {
+      NS_FATAL_ERROR ("Cannot open file \"" << fileName << "\"");
+    }
+  if (bufferSize < 64)
+    {
+      NS_FATAL_ERROR ("The buffer of BinaryTraceWriter is too small: " << bufferSize);
+    }
+  static const char magic[] = "DCBTRACE";
+  for (std::size_t i = 0; i < sizeof (magic) - 1; i++)
+    {
+      Append (magic[i]);
+    }
+  Append (VERSION);
+}
+
+BinaryTraceWriter::~BinaryTraceWriter ()
+{
+  Flush ();
+  m_fileStream.close ();
+}
+
+uint32_t
+BinaryTraceWriter::AddStream (const std::string &name, const std::vector<Column> &columns)
+{
+  const uint32_t id = ++m_nStreams;
+  Append<uint32_t> (0);
+  Append (id);
+  WriteString (name);
+  Append (static_cast<uint32_t> (columns.size ()));
+  for (const Column &column : columns)
+    {
+      Append (column.type);
+      WriteString (column.name);
+    }
+  return id;
+}
+
+void
+BinaryTraceWriter::Flush ()
+{
+  m_fileStream.write (m_buffer.data (), m_used);
+  m_used = 0;
+}
+
+void
+BinaryTraceWriter::WriteString (const std::string &str)
+{
+  Append (static_cast<uint32_t> (str.size ()));
+  for (char c : str)
+    {
+      Append (c);
+    }
+}
+
+} // namespace ns3
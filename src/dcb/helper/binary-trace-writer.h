@@ -0,0 +1,162 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#ifndef BINARY_TRACE_WRITER_H
+#define BINARY_TRACE_WRITER_H
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \brief One buffered binary file shared by many trace streams.
+ *
+ * Each tracer declares a stream with typed columns and then appends rows of
+ * fixed width.  Rows are packed into a large in-memory buffer which is written
+ * out in one call when it is full, so tracing thousands of ports costs one
+ * file and few system calls instead of one formatted text file per port.
+ *
+ * The file layout, in host byte order:
+ *  - the magic "DCBTRACE" and a uint32 version;
+ *  - records, each starting with a uint32 stream ID:
+ *    - ID 0 declares a stream: uint32 ID, string name, uint32 column number,
+ *      and for each column a uint8 ColumnType and a string name;
+ *    - any other ID is one row of that stream, its columns one after another.
+ *  Strings are a uint32 length followed by the characters.
+ *
+ * utils/dcb-trace-convert.py turns the file into one CSV or Parquet file per
+ * stream.
+ */
+class BinaryTraceWriter
+{
+public:
+  enum ColumnType : uint8_t {
+    U32 = 0,
+    U64 = 1,
+    I64 = 2,
+    F64 = 3,
+  };
+
+  struct Column
+  {
+    std::string name;
+    ColumnType type;
+  };
+
+  constexpr static const uint32_t VERSION = 1;
+
+  /**
+   * \param fileName the file to write, truncated
+   * \param bufferSize the bytes buffered before writing to the file
+   */
+  explicit BinaryTraceWriter (const std::string &fileName, std::size_t bufferSize = 4 << 20);
+  ~BinaryTraceWriter ();
+
+  BinaryTraceWriter (const BinaryTraceWriter &) = delete;
+  BinaryTraceWriter &operator= (const BinaryTraceWriter &) = delete;
+
+  /**
+   * \brief Declare a stream.
+   * \param name the name of the stream, e.g., the CSV file name it replaces
+   * \param columns the columns of each row
+   * \return the ID of the stream, never 0
+   */
+  uint32_t AddStream (const std::string &name, const std::vector<Column> &columns);
+
+  /**
+   * \brief Start a row of a stream.  The columns must then be written in
+   * order with the Write overload of their type.
+   */
+  void BeginRow (uint32_t stream);
+
+  void Write (uint32_t value);
+  void Write (uint64_t value);
+  void Write (int64_t value);
+  void Write (double value);
+
+  /**
+   * \brief Write the buffered records to the file.
+   */
+  void Flush ();
+
+private:
+  void WriteString (const std::string &str);
+
+  template <class T>
+  void Append (T value);
+
+  std::ofstream m_fileStream;
+  std::vector<char> m_buffer;
+  std::size_t m_used; //!< bytes of m_buffer in use
+  uint32_t m_nStreams;
+
+}; // class BinaryTraceWriter
+
+/****************************************************
+ *      Inline and template implementations.
+ ***************************************************/
+
+template <class T>
+inline void
+BinaryTraceWriter::Append (T value)
+{
+  if (m_used + sizeof (T) > m_buffer.size ())
+    {
+      Flush ();
+    }
+  std::memcpy (m_buffer.data () + m_used, &value, sizeof (T));
+  m_used += sizeof (T);
+}
+
+inline void
+BinaryTraceWriter::BeginRow (uint32_t stream)
+{
+  Append (stream);
+}
+
+inline void
+BinaryTraceWriter::Write (uint32_t value)
+{
+  Append (value);
+}
+
+inline void
+BinaryTraceWriter::Write (uint64_t value)
+{
+  Append (value);
+}
+
+inline void
+BinaryTraceWriter::Write (int64_t value)
+{
+  Append (value);
+}
+
+inline void
+BinaryTraceWriter::Write (double value)
+{
+  Append (value);
+}
+
+} // namespace ns3
+
+#endif // BINARY_TRACE_WRITER_H
@@ -28,6 +28,7 @@
 #include "ns3/packet-socket-factory.h"
 #include "ns3/simulator.h"
 #include "ns3/names.h"
+#include "ns3/enum.h"
 #include "ns3/config.h"
 #include "ns3/string.h"
 #include "ns3/net-device.h"
@@ -128,6 +129,8 @@ DcbSwitchStackHelper::Initialize ()
   m_tcFactory.SetTypeId (DcbTrafficControl::GetTypeId ());
   m_bufferSize = QueueSize ("32MiB"); // 32 MB
   m_fcEnabled = true;
+  m_ecmpMode = Ipv4GlobalRouting::EcmpMode::PER_FLOW_ECMP;
+  m_intEnabled = false;
 }
 
 DcbSwitchStackHelper::~DcbSwitchStackHelper ()
@@ -174,6 +177,21 @@ DcbSwitchStackHelper::SetFCEnabled (bool enable)
   m_fcEnabled = enable;
 }
 
+void
+DcbSwitchStackHelper::SetLoadBalancing (DcbTrafficControl::LoadBalancing mode, Time flowletGap)
+{
+  m_tcFactory.Set ("LoadBalancing", EnumValue (mode));
+  m_tcFactory.Set ("FlowletGap", TimeValue (flowletGap));
+  m_ecmpMode = mode == DcbTrafficControl::PACKET_SPRAY ? Ipv4GlobalRouting::EcmpMode::PER_PACKET_ECMP
+                                                       : Ipv4GlobalRouting::EcmpMode::PER_FLOW_ECMP;
+}
+
+void
+DcbSwitchStackHelper::SetIntEnabled (bool enable)
+{
+  m_intEnabled = enable;
+}
+
 void
 DcbSwitchStackHelper::SetBufferSize (QueueSize bufSize)
 {
@@ -285,8 +303,7 @@ DcbSwitchStackHelper::Install (Ptr<Node> node) const
   int16_t priority;
   Ptr<Ipv4ListRouting> routing = DynamicCast<Ipv4ListRouting> (ipv4Routing);
   DynamicCast<Ipv4GlobalRouting> (routing->GetRoutingProtocol (0, priority))
-      ->SetAttribute ("RandomEcmpRouting",
-                      UintegerValue (Ipv4GlobalRouting::EcmpMode::PER_FLOW_ECMP));
+      ->SetAttribute ("RandomEcmpRouting", UintegerValue (m_ecmpMode));
   // paramenter 0 should be consistent with Initialize()
 
   if (m_ipv6Enabled)
@@ -351,6 +368,7 @@ DcbSwitchStackHelper::Install (Ptr<Node> node) const
           qDisc->RegisterTrafficControlCallback (tcCallback);
           qDisc->SetQueueSize (m_bufferSize);
           qDisc->SetFCEnabled (true);
+          qDisc->SetIntEnabled (m_intEnabled);
           dcbTc->SetRootQueueDiscOnDevice (dcbDev, qDisc);
           dcbDev->SetFcEnabled (true); // all NetDevices should support FC
         }
@@ -365,9 +383,11 @@ DcbSwitchStackHelper::Install (Ptr<Node> node) const
           Ptr<NetDevice> dev = node->GetDevice (i);
           Ptr<PausableQueueDisc> qDisc = qDiscFactory.Create<PausableQueueDisc> ();
           qDisc->SetFCEnabled (false);
+          qDisc->SetIntEnabled (m_intEnabled);
           tc->SetRootQueueDiscOnDevice (dev, qDisc);
           Ptr<DcbNetDevice> dcbDev = DynamicCast<DcbNetDevice> (dev);
           dcbDev->SetFcEnabled (false); // all NetDevices should support FC
+          dcbDev->SetQueueDisc (qDisc); // for the line rate of INT
         }
     }
 }
@@ -34,6 +34,9 @@
 #include "ns3/ipv6-routing-helper.h"
 #include "ns3/pausable-queue-disc.h"
 #include "ns3/fifo-queue-disc-ecn.h"
+#include "ns3/dcb-traffic-control.h"
+#include "ns3/ipv4-global-routing.h"
+#include "ns3/nstime.h"
 
 
 namespace ns3 {
@@ -112,6 +115,25 @@ public:
 
   void SetFCEnabled (bool enable);
 
+  /**
+   * \brief Set how the switches spread packets over equal-cost ports.
+   *
+   * The mode is used by the fast path of DcbTrafficControl.  Packets that go
+   * through Ipv4GlobalRouting are sprayed per packet in PACKET_SPRAY mode and
+   * hashed per flow otherwise.
+   *
+   * \param mode the load balancing mode
+   * \param flowletGap idle time that starts a new flowlet, used by the flowlet modes
+   */
+  void SetLoadBalancing (DcbTrafficControl::LoadBalancing mode,
+                         Time flowletGap = MicroSeconds (50));
+
+  /**
+   * \brief Let the ports append an INT hop to the RoCEv2 data packets that
+   * carry an IntTrailer.
+   */
+  void SetIntEnabled (bool enable);
+
   /**
    * \brief Enable/disable IPv6 stack install.
    * \param enable enable state
@@ -262,6 +284,10 @@ private:
   
   bool m_fcEnabled;
 
+  Ipv4GlobalRouting::EcmpMode m_ecmpMode; //!< ECMP mode of Ipv4GlobalRouting
+
+  bool m_intEnabled; //!< whether the ports write INT hops
+
 };
 
 } // namespace ns3
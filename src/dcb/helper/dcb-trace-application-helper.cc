@@ -29,7 +29,8 @@
 namespace ns3 {
 
 TraceApplicationHelper::TraceApplicationHelper (Ptr<DcTopology> topo)
-    : m_topology (topo), m_cdf (nullptr), m_flowMeanInterval (0.), m_dest (-1), m_sendEnabled (true)
+    : m_topology (topo), m_cdf (nullptr), m_flowMeanInterval (0.), m_dest (-1), m_sendEnabled (true),
+      m_randomFlows (true)
 {
 }
 
@@ -68,11 +69,18 @@ TraceApplicationHelper::SetDestination (int32_t dest)
   m_dest = dest;
 }
 
+void
+TraceApplicationHelper::SetRandomFlowsEnabled (bool enabled)
+{
+  m_randomFlows = enabled;
+}
+
 ApplicationContainer
 TraceApplicationHelper::Install (Ptr<Node> node) const
 {
-  NS_ASSERT_MSG (m_cdf, "[TraceApplicationHelper] CDF not set, please call SetCdf ().");
-  NS_ASSERT_MSG (m_flowMeanInterval > 0 || !m_sendEnabled,
+  NS_ASSERT_MSG (m_cdf || !m_randomFlows,
+                 "[TraceApplicationHelper] CDF not set, please call SetCdf ().");
+  NS_ASSERT_MSG (m_flowMeanInterval > 0 || !m_sendEnabled || !m_randomFlows,
                  "[TraceApplicationHelper] Load not set, please call SetLoad ().");
   return ApplicationContainer (InstallPriv (node));
 }
@@ -90,7 +98,11 @@ TraceApplicationHelper::InstallPriv (Ptr<Node> node) const
       app = CreateObject<TraceApplication> (m_topology, node->GetId (), m_dest);
     }
 
-  if (m_sendEnabled)
+  if (!m_randomFlows)
+    {
+      app->SetRandomFlowsEnabled (false);
+    }
+  else if (m_sendEnabled)
     {
       app->SetFlowCdf (*m_cdf);
       app->SetFlowMeanArriveInterval (m_flowMeanInterval);
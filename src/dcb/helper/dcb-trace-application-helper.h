@@ -44,6 +44,13 @@ public:
   void SetLoad (Ptr<const DcbNetDevice> dev, double load);
   void SetDestination (int32_t dest);
 
+  /**
+   * Whether the applications generate random flows by the CDF and the load.
+   * If not, CDF and load are not needed and flows are given by
+   * TraceApplication::StartFlow, e.g., by a FlowReplayer.
+   */
+  void SetRandomFlowsEnabled (bool enabled);
+
   /**
    * Record an attribute to be set in each Application after it is is created.
    *
@@ -71,6 +78,7 @@ private:
   double m_flowMeanInterval;
   int32_t m_dest;
   bool m_sendEnabled;
+  bool m_randomFlows;
 
 }; // class TraceApplicationHelper
 
@@ -0,0 +1,228 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#include "fct-statistics.h"
+#include "ns3/fatal-error.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ns3 {
+
+/////////////////////////
+/// LogHistogram
+/////////////////////////
+
+LogHistogram::LogHistogram (uint32_t precision)
+    : m_precision (precision), m_count (0), m_max (0), m_sum (0.)
+{
+  if (precision == 0 || precision > 16)
+    {
+      NS_FATAL_ERROR ("The precision of LogHistogram should be in [1, 16]: " << precision);
+    }
+}
+
+void
+LogHistogram::Add (uint64_t value)
+{
+  const std::size_t index = GetIndex (value);
+  if (index >= m_counts.size ())
+    {
+      m_counts.resize (index + 1, 0);
+    }
+  m_counts[index]++;
+  m_count++;
+  m_max = std::max (m_max, value);
+  m_sum += value;
+}
+
+uint64_t
+LogHistogram::GetCount () const
+{
+  return m_count;
+}
+
+double
+LogHistogram::GetMean () const
+{
+  return m_count ? m_sum / m_count : 0.;
+}
+
+uint64_t
+LogHistogram::GetMax () const
+{
+  return m_max;
+}
+
+uint64_t
+LogHistogram::GetQuantile (double q) const
+{
+  if (m_count == 0)
+    {
+      return 0;
+    }
+  const uint64_t rank =
+      std::max<uint64_t> (1, static_cast<uint64_t> (std::ceil (q * m_count)));
+  uint64_t seen = 0;
+  for (std::size_t i = 0; i < m_counts.size (); i++)
+    {
+      seen += m_counts[i];
+      if (seen >= rank)
+        {
+          return std::min (GetValue (i), m_max);
+        }
+    }
+  return m_max;
+}
+
+std::size_t
+LogHistogram::GetIndex (uint64_t value) const
+{
+  // Values below 2^(precision+1) are exact.  Beyond, a value of highest bit e
+  // keeps its precision+1 highest bits, the mantissa in [2^p, 2^(p+1)), and
+  // the buckets of each shift follow those of the previous one.
+  const uint64_t subBuckets = uint64_t (1) << m_precision;
+  if (value < (subBuckets << 1))
+    {
+      return value;
+    }
+  const uint32_t shift = 63 - __builtin_clzll (value) - m_precision;
+  return shift * subBuckets + (value >> shift);
+}
+
+uint64_t
+LogHistogram::GetValue (std::size_t index) const
+{
+  const uint64_t subBuckets = uint64_t (1) << m_precision;
+  if (index < (subBuckets << 1))
+    {
+      return index;
+    }
+  const uint32_t shift = index / subBuckets - 1;
+  const uint64_t mantissa = index - shift * subBuckets;
+  return (mantissa << shift) + ((uint64_t (1) << shift) >> 1); // the middle of the bucket
+}
+
+/////////////////////////
+/// FctStatistics
+/////////////////////////
+
+FctStatistics::FctStatistics (const std::vector<uint64_t> &sizeBins, DataRate lineRate,
+                              BaseRttCallback baseRtt)
+    : m_all (std::numeric_limits<uint64_t>::max ()),
+      m_lineRate (lineRate),
+      m_baseRtt (baseRtt)
+{
+  for (uint64_t size : sizeBins)
+    {
+      if (!m_bins.empty () && size <= m_bins.back ().maxSize)
+        {
+          NS_FATAL_ERROR ("FCT size bins should be ascending, got " << size << " after "
+                                                                    << m_bins.back ().maxSize);
+        }
+      m_bins.emplace_back (size);
+    }
+  m_bins.emplace_back (std::numeric_limits<uint64_t>::max ());
+}
+
+static Time
+ConstantBaseRtt (Time baseRtt, uint32_t srcNode, uint32_t dstNode)
+{
+  return baseRtt;
+}
+
+FctStatistics::FctStatistics (const std::vector<uint64_t> &sizeBins, DataRate lineRate,
+                              Time baseRtt)
+    : FctStatistics (sizeBins, lineRate, MakeBoundCallback (&ConstantBaseRtt, baseRtt))
+{
+}
+
+Time
+FctStatistics::GetIdealFct (uint32_t srcNode, uint32_t dstNode, uint64_t flowSize) const
+{
+  return m_baseRtt (srcNode, dstNode) + m_lineRate.CalculateBytesTxTime (flowSize);
+}
+
+void
+FctStatistics::Record (uint32_t srcNode, uint32_t dstNode, uint64_t flowSize, Time fct)
+{
+  const uint64_t fctNs = std::max<int64_t> (fct.GetNanoSeconds (), 0);
+  const double ideal =
+      std::max<int64_t> (GetIdealFct (srcNode, dstNode, flowSize).GetNanoSeconds (), 1);
+  // a slowdown below 1 only means the base RTT is overestimated
+  const uint64_t slowdown = std::max (1000., std::round (fctNs * 1000. / ideal));
+
+  Bin &bin = *std::lower_bound (
+      m_bins.begin (), m_bins.end (), flowSize,
+      [] (const Bin &b, uint64_t size) { return b.maxSize < size; });
+  bin.fctNs.Add (fctNs);
+  bin.slowdown.Add (slowdown);
+  m_all.fctNs.Add (fctNs);
+  m_all.slowdown.Add (slowdown);
+}
+
+void
+FctStatistics::WriteSummary (std::ostream &os) const
+{
+  os << "max_size,flows,fct_mean_ns,fct_p50_ns,fct_p95_ns,fct_p99_ns,fct_p999_ns,"
+        "slowdown_mean,slowdown_p50,slowdown_p95,slowdown_p99,slowdown_p999\n";
+  for (const Bin &bin : m_bins)
+    {
+      if (bin.fctNs.GetCount ())
+        {
+          const bool last = bin.maxSize == std::numeric_limits<uint64_t>::max ();
+          WriteBin (os, last ? "inf" : std::to_string (bin.maxSize), bin);
+        }
+    }
+  WriteBin (os, "all", m_all);
+  os.flush ();
+}
+
+void
+FctStatistics::WriteBin (std::ostream &os, const std::string &name, const Bin &bin)
+{
+  static const double quantiles[] = {0.5, 0.95, 0.99, 0.999};
+  os << name << "," << bin.fctNs.GetCount () << "," << std::llround (bin.fctNs.GetMean ());
+  for (double q : quantiles)
+    {
+      os << "," << bin.fctNs.GetQuantile (q);
+    }
+  os << "," << bin.slowdown.GetMean () / 1000.;
+  for (double q : quantiles)
+    {
+      os << "," << bin.slowdown.GetQuantile (q) / 1000.;
+    }
+  os << "\n";
+}
+
+std::vector<uint64_t>
+FctStatistics::GetSizeBins (const std::vector<std::pair<double, double>> &cdf)
+{
+  std::vector<uint64_t> bins;
+  for (const auto &point : cdf)
+    {
+      const uint64_t size = static_cast<uint64_t> (point.first);
+      if (size > 0 && (bins.empty () || size > bins.back ()))
+        {
+          bins.push_back (size);
+        }
+    }
+  return bins;
+}
+
+} // namespace ns3
@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#ifndef FCT_STATISTICS_H
+#define FCT_STATISTICS_H
+
+#include "ns3/callback.h"
+#include "ns3/data-rate.h"
+#include "ns3/nstime.h"
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \brief A histogram of non-negative integers with log-linear buckets, as in
+ * HDR histograms.
+ *
+ * Values below 2^(precision+1) have their own buckets; beyond, each power of
+ * two is split into 2^precision buckets, so a quantile is within a relative error
+ * of 2^-(precision+1) with a memory that only grows with the log of the
+ * largest value.
+ */
+class LogHistogram
+{
+public:
+  explicit LogHistogram (uint32_t precision = 7);
+
+  void Add (uint64_t value);
+
+  uint64_t GetCount () const;
+  double GetMean () const;
+  uint64_t GetMax () const;
+
+  /**
+   * \param q the quantile in [0, 1]
+   * \return the middle of the bucket holding the value of rank ceil(q * count),
+   * or 0 if the histogram is empty
+   */
+  uint64_t GetQuantile (double q) const;
+
+private:
+  std::size_t GetIndex (uint64_t value) const;
+  uint64_t GetValue (std::size_t index) const;
+
+  uint32_t m_precision;
+  std::vector<uint64_t> m_counts; //!< grown to the largest index added
+  uint64_t m_count;
+  uint64_t m_max;
+  double m_sum;
+
+}; // class LogHistogram
+
+/**
+ * \brief Streaming FCT statistics of flows bucketed by size.
+ *
+ * The slowdown of a flow is its FCT divided by the ideal FCT of its size on
+ * an empty network, i.e., the base RTT between its source and destination
+ * plus the serialization of the flow at the line rate.  The flows are only
+ * aggregated, not kept: the summary has one row per size bin and a last row
+ * of all flows, each with the mean and the p50/p95/p99/p99.9 FCT and
+ * slowdown.
+ */
+class FctStatistics
+{
+public:
+  /**
+   * Callback signature for the RTT without queuing between two nodes.
+   * \param [in] srcNode the ID of the source node
+   * \param [in] dstNode the ID of the destination node
+   * \return the base RTT
+   */
+  typedef Callback<Time, uint32_t, uint32_t> BaseRttCallback;
+
+  /**
+   * \param sizeBins the upper bounds (inclusive) of the size bins in bytes,
+   * ascending, e.g., the size points of a TraceApplication CDF; flows larger
+   * than the last bound go to a last bin without bound
+   * \param lineRate the line rate of the hosts
+   * \param baseRtt the base RTT of the path of each flow
+   */
+  FctStatistics (const std::vector<uint64_t> &sizeBins, DataRate lineRate,
+                 BaseRttCallback baseRtt);
+
+  /**
+   * \brief The same base RTT for all flows, e.g., that of the longest path.
+   */
+  FctStatistics (const std::vector<uint64_t> &sizeBins, DataRate lineRate, Time baseRtt);
+
+  void Record (uint32_t srcNode, uint32_t dstNode, uint64_t flowSize, Time fct);
+
+  Time GetIdealFct (uint32_t srcNode, uint32_t dstNode, uint64_t flowSize) const;
+
+  /**
+   * \brief Write the summary as CSV with a header line.
+   */
+  void WriteSummary (std::ostream &os) const;
+
+  /**
+   * \return the size points of a CDF as size bins
+   */
+  static std::vector<uint64_t> GetSizeBins (const std::vector<std::pair<double, double>> &cdf);
+
+private:
+  struct Bin
+  {
+    explicit Bin (uint64_t max) : maxSize (max)
+    {
+    }
+    uint64_t maxSize;
+    LogHistogram fctNs;
+    LogHistogram slowdown; //!< in thousandths
+  };
+
+  static void WriteBin (std::ostream &os, const std::string &name, const Bin &bin);
+
+  std::vector<Bin> m_bins;
+  Bin m_all;
+  DataRate m_lineRate;
+  BaseRttCallback m_baseRtt;
+
+}; // class FctStatistics
+
+} // namespace ns3
+
+#endif // FCT_STATISTICS_H
@@ -19,11 +19,14 @@
  */
 
 #include "tracer-extension.h"
+#include "binary-trace-writer.h"
 #include "csv-writer.h"
 #include "dcb-net-device-helper.h"
 #include "dcb-switch-stack-helper.h"
+#include "fct-statistics.h"
 #include "ns3/dcb-net-device.h"
 #include "ns3/dcb-traffic-control.h"
+#include "ns3/timer.h"
 #include <fstream>
 
 namespace ns3 {
@@ -36,6 +39,7 @@ namespace tracer_extension {
  */
 static std::string outputDirectory;
 static Time stopTime;
+static BinaryTraceWriter *binaryWriter = nullptr; // null if tracers write CSV files
   
 // ----------------------------------------
 template <class T>
@@ -45,12 +49,24 @@ static std::string GetRealFileName (std::string fileName);
 // ----------------------------------------
 namespace fct_unit {
   Protocol protocol = Protocol::None; // TODO: not supporting multiple protocols
-  std::ofstream fctFileStream;
+  std::ofstream fctFileStream; // not open if the raw FCT of each flow is not logged
+  FctStatistics *statistics = nullptr;
+  std::string statisticsFile;
+  EventId summaryEvent;
+  void WriteSummary ();
   void FlowCompletionTracer (uint32_t srcNode, uint32_t dstNode, uint32_t srcPort,
                              uint32_t dstPort, uint32_t flowSize, Time startTime,
                              Time finishTime);
 }  
 
+// ----------------------------------------
+namespace pfc_unit {
+  Ptr<PfcWatchdog> watchdog;
+  std::ofstream fileStream;
+  void DeadlockTracer (uint8_t priority, const std::vector<PfcWatchdog::PausedPort> &loop);
+  void PauseStormTracer (uint32_t node, uint32_t port, uint8_t priority, bool storm);
+}
+
 // ----------------------------------------  
 class RateTracer
 {
@@ -66,6 +82,7 @@ private:
   Timer m_timer;
   std::string m_context;
   std::ofstream m_ofstream;
+  uint32_t m_stream; //!< stream of binaryWriter, 0 if writing m_ofstream
 }; // class RateTracer  
 std::list<RateTracer *> RateTracer::tracers;
 
@@ -73,18 +90,49 @@ std::list<RateTracer *> RateTracer::tracers;
 class QueueLengthTracer
 {
 public:
-  QueueLengthTracer (std::string context, Ptr<PausableQueueDisc> queueDisc, Time interval);
+  QueueLengthTracer (std::string context, Ptr<PausableQueueDisc> queueDisc, Time interval,
+                     uint32_t threshold);
   ~QueueLengthTracer ();
   void Trace ();
   static std::list<QueueLengthTracer*> tracers;
 
 private:
+  void Change (uint8_t priority, uint32_t bytes);
   Ptr<PausableQueueDisc> m_queueDisc;
-  Timer m_timer;
+  Time m_interval;
+  uint32_t m_threshold;
+  Time m_lastTrace;
+  EventId m_event;
+  std::vector<uint32_t> m_lastBytes; //!< bytes of each class in the last row
+  std::string m_context;
   std::ofstream m_ofstream;
+  uint32_t m_stream; //!< stream of binaryWriter, 0 if not declared yet
 }; // class QueueLengthTracer
 std::list<QueueLengthTracer*> QueueLengthTracer::tracers;  
 
+// ----------------------------------------  
+class SwitchQueueSampler
+{
+public:
+  SwitchQueueSampler (std::string context, Ptr<Node> sw, Time interval);
+  ~SwitchQueueSampler ();
+  static std::list<SwitchQueueSampler *> tracers;
+
+private:
+  static void Change (SwitchQueueSampler *sampler, uint32_t port, uint8_t priority,
+                      uint32_t bytes);
+  void Sample ();
+  std::vector<Ptr<PausableQueueDisc>> m_queueDiscs; //!< indexed by port, null if not DCB
+  std::vector<uint32_t> m_changedPorts;
+  std::vector<bool> m_changed;
+  Time m_interval;
+  Time m_lastSample;
+  EventId m_event;
+  std::ofstream m_ofstream;
+  uint32_t m_stream; //!< stream of binaryWriter, 0 if writing m_ofstream
+}; // class SwitchQueueSampler
+std::list<SwitchQueueSampler *> SwitchQueueSampler::tracers;
+
 // ----------------------------------------  
 class BufferOverflowTracer {
 public:
@@ -95,6 +143,7 @@ public:
     
 private:
   std::ofstream m_ofstream;
+  uint32_t m_stream; //!< stream of binaryWriter, 0 if writing m_ofstream
 }; // class BufferoverflowTracer
 std::list<BufferOverflowTracer *> BufferOverflowTracer::tracers;
 
@@ -113,6 +162,18 @@ void
 ConfigStopTime (Time t)
 {
   stopTime = t;
+  if (fct_unit::statistics)
+    {
+      fct_unit::summaryEvent.Cancel ();
+      fct_unit::summaryEvent = Simulator::Schedule (stopTime, &fct_unit::WriteSummary);
+    }
+}
+
+void
+ConfigBinaryTrace (std::string fileName)
+{
+  delete binaryWriter;
+  binaryWriter = new BinaryTraceWriter (GetRealFileName (fileName));
 }
 
 void
@@ -127,6 +188,34 @@ ConfigTraceFCT (Protocol protocol, std::string fileName)
     }
 }
 
+static void
+SetFctStatistics (Protocol protocol, std::string fileName, FctStatistics *statistics)
+{
+  fct_unit::protocol = protocol;
+  delete fct_unit::statistics;
+  fct_unit::statistics = statistics;
+  fct_unit::statisticsFile = GetRealFileName (fileName);
+  if (!stopTime.IsZero ())
+    {
+      fct_unit::summaryEvent.Cancel ();
+      fct_unit::summaryEvent = Simulator::Schedule (stopTime, &fct_unit::WriteSummary);
+    }
+}
+
+void
+ConfigFctStatistics (Protocol protocol, std::string fileName, const std::vector<uint64_t> &sizeBins,
+                     DataRate lineRate, Time baseRtt)
+{
+  SetFctStatistics (protocol, fileName, new FctStatistics (sizeBins, lineRate, baseRtt));
+}
+
+void
+ConfigFctStatistics (Protocol protocol, std::string fileName, const std::vector<uint64_t> &sizeBins,
+                     DataRate lineRate, FctStatistics::BaseRttCallback baseRtt)
+{
+  SetFctStatistics (protocol, fileName, new FctStatistics (sizeBins, lineRate, baseRtt));
+}
+
 void
 RegisterTraceFCT (Ptr<TraceApplication> app)
 {
@@ -173,13 +262,14 @@ EnableDeviceRateTrace (Ptr<NetDevice> device, std::string context, Time interval
 }
 
 void
-EnablePortQueueLengthTrace (Ptr<NetDevice> device, std::string context, Time interval)
+EnablePortQueueLengthTrace (Ptr<NetDevice> device, std::string context, Time interval,
+                            uint32_t threshold)
 {
   Ptr<DcbNetDevice> dcbDev = DynamicCast<DcbNetDevice> (device);
   if (dcbDev)
     {
       QueueLengthTracer *tracer =
-          new QueueLengthTracer (context, dcbDev->GetQueueDisc (), interval);
+          new QueueLengthTracer (context, dcbDev->GetQueueDisc (), interval, threshold);
       QueueLengthTracer::tracers.push_back (tracer);
     }
   else
@@ -188,6 +278,12 @@ EnablePortQueueLengthTrace (Ptr<NetDevice> device, std::string context, Time int
     }
 }
 
+void
+EnableSwitchQueueLengthTrace (Ptr<Node> sw, std::string context, Time interval)
+{
+  SwitchQueueSampler::tracers.push_back (new SwitchQueueSampler (context, sw, interval));
+}
+
 void
 EnableBufferoverflowTrace (Ptr<Node> sw, std::string context)
 {
@@ -196,6 +292,27 @@ EnableBufferoverflowTrace (Ptr<Node> sw, std::string context)
   BufferOverflowTracer::tracers.push_back (tracer);
 }
 
+Ptr<PfcWatchdog>
+EnablePfcWatchdog (NodeContainer nodes, std::string fileName)
+{
+  if (!pfc_unit::watchdog)
+    {
+      std::string realName = GetRealFileName (fileName);
+      pfc_unit::fileStream.open (realName);
+      if (!pfc_unit::fileStream.good ())
+        {
+          NS_FATAL_ERROR ("Cannot open file \"" << realName << "\"");
+        }
+      pfc_unit::watchdog = CreateObject<PfcWatchdog> ();
+      pfc_unit::watchdog->TraceConnectWithoutContext ("Deadlock",
+                                                      MakeCallback (&pfc_unit::DeadlockTracer));
+      pfc_unit::watchdog->TraceConnectWithoutContext ("PauseStorm",
+                                                      MakeCallback (&pfc_unit::PauseStormTracer));
+    }
+  pfc_unit::watchdog->Install (nodes);
+  return pfc_unit::watchdog;
+}
+
 void
 CleanTracers ()
 {
@@ -203,9 +320,20 @@ CleanTracers ()
     {
       fct_unit::fctFileStream.close ();
     }
+  fct_unit::summaryEvent.Cancel ();
+  fct_unit::WriteSummary (); // if the simulation stopped before stopTime
   ClearTracersList (RateTracer::tracers);
   ClearTracersList (QueueLengthTracer::tracers);
+  ClearTracersList (SwitchQueueSampler::tracers);
   ClearTracersList (BufferOverflowTracer::tracers);
+  if (pfc_unit::watchdog)
+    {
+      pfc_unit::watchdog->Dispose ();
+      pfc_unit::watchdog = nullptr;
+      pfc_unit::fileStream.close ();
+    }
+  delete binaryWriter; // flush the buffered traces
+  binaryWriter = nullptr;
 }
 
 /************************************************
@@ -241,6 +369,14 @@ FlowCompletionTracer (uint32_t srcNode, uint32_t dstNode, uint32_t srcPort,
 {
   // TODO: add mutex lock for concurrency
   Time fct = finishTime - startTime;
+  if (statistics)
+    {
+      statistics->Record (srcNode, dstNode, flowSize, fct);
+    }
+  if (!fctFileStream.is_open ())
+    {
+      return;
+    }
   CsvWriter writer (&fct_unit::fctFileStream, 8);
   writer.WriteNextValue (srcNode); // src node
   writer.WriteNextValue (dstNode); // dest node
@@ -256,18 +392,69 @@ FlowCompletionTracer (uint32_t srcNode, uint32_t dstNode, uint32_t srcPort,
   //                        << finishTime << " with FCT=" << fct);
 }
 
+void
+WriteSummary ()
+{
+  if (!statistics)
+    {
+      return;
+    }
+  std::ofstream ofs (statisticsFile);
+  if (!ofs.good ())
+    {
+      std::cerr << "Error: Cannot open file \"" << statisticsFile << "\"" << std::endl;
+    }
+  statistics->WriteSummary (ofs);
+  delete statistics;
+  statistics = nullptr;
+}
+
 } // namespace fct_unit
 
+///////////////////////
+/// PFC watchdog
+///////////////////////
+namespace pfc_unit {
+
+// Each row is the time in ns, the event, the priority and the ports as
+// node:port, with the time in ns each port was paused since for a deadlock.
+void
+DeadlockTracer (uint8_t priority, const std::vector<PfcWatchdog::PausedPort> &loop)
+{
+  fileStream << Simulator::Now ().GetNanoSeconds () << ",deadlock," << +priority << ",";
+  for (const PfcWatchdog::PausedPort &p : loop)
+    {
+      fileStream << p.node << ":" << p.port << ":" << p.pausedSince.GetNanoSeconds () << " ";
+    }
+  fileStream << std::endl;
+}
+
+void
+PauseStormTracer (uint32_t node, uint32_t port, uint8_t priority, bool storm)
+{
+  fileStream << Simulator::Now ().GetNanoSeconds () << "," << (storm ? "storm" : "restored")
+             << "," << +priority << "," << node << ":" << port << std::endl;
+}
+
+} // namespace pfc_unit
+
 ///////////////////////  
 /// RateTracer
 ///////////////////////
 
-RateTracer::RateTracer (Time interval, std::string context) : m_bytes (0), m_context (context)
+RateTracer::RateTracer (Time interval, std::string context)
+    : m_bytes (0), m_context (context), m_stream (0)
 {
   m_timer.SetFunction (&RateTracer::LogRate, this);
   m_timer.SetDelay (interval);
-  m_timer.Schedule ();
 
+  if (binaryWriter)
+    {
+      m_stream = binaryWriter->AddStream ("rate-tx-" + context,
+                                          {{"time_us", BinaryTraceWriter::I64},
+                                           {"rate_mbps", BinaryTraceWriter::F64}});
+      return;
+    }
   std::string filename = GetRealFileName ("rate-tx-" + context + ".csv");
   m_ofstream.open (filename);
   if (!m_ofstream.good ())
@@ -284,16 +471,31 @@ void
 RateTracer::Trace (Ptr<const Packet> packet)
 {
   m_bytes += packet->GetSize ();
+  if (!m_timer.IsRunning () && Simulator::Now () < stopTime)
+    {
+      m_timer.Schedule (); // the device starts sending after being idle
+    }
 }
 
 void
 RateTracer::LogRate ()
 {
   double rate = static_cast<double> (m_bytes) * 8 / m_timer.GetDelay ().GetMicroSeconds ();
-  m_ofstream << Simulator::Now ().GetMicroSeconds () << "," << rate << std::endl;
+  if (m_stream)
+    {
+      binaryWriter->BeginRow (m_stream);
+      binaryWriter->Write (Simulator::Now ().GetMicroSeconds ());
+      binaryWriter->Write (rate);
+    }
+  else
+    {
+      m_ofstream << Simulator::Now ().GetMicroSeconds () << "," << rate << std::endl;
+    }
   // NS_LOG_UNCOND ("rate of device " <<  m_context << " is " << rate << "Mbps");
+  // Stop after the first idle interval, whose zero rate is logged, until the next packet
+  const bool idle = m_bytes == 0;
   m_bytes = 0;
-  if (Simulator::Now () < stopTime)
+  if (!idle && Simulator::Now () < stopTime)
     {
       m_timer.Schedule ();
     }
@@ -304,13 +506,21 @@ RateTracer::LogRate ()
 ///////////////////////
   
 QueueLengthTracer::QueueLengthTracer (std::string context, Ptr<PausableQueueDisc> queueDisc,
-                                          Time interval)
-    : m_queueDisc (queueDisc)
+                                      Time interval, uint32_t threshold)
+    : m_queueDisc (queueDisc),
+      m_interval (interval),
+      m_threshold (threshold),
+      m_lastTrace (Time (0) - interval),
+      m_context (context),
+      m_stream (0)
 {
-  m_timer.SetFunction (&QueueLengthTracer::Trace, this);
-  m_timer.SetDelay (interval);
-  m_timer.Schedule ();
+  queueDisc->TraceConnectWithoutContext ("ClassBytesInQueue",
+                                         MakeCallback (&QueueLengthTracer::Change, this));
 
+  if (binaryWriter)
+    {
+      return; // the stream is declared once the queue disc classes are created
+    }
   std::string filename = GetRealFileName ("queue-" + context + ".csv");
   m_ofstream.open (filename);
   if (!m_ofstream.good ())
@@ -320,24 +530,186 @@ QueueLengthTracer::QueueLengthTracer (std::string context, Ptr<PausableQueueDisc
 }
 QueueLengthTracer::~QueueLengthTracer ()
 {
+  m_event.Cancel ();
   m_ofstream.close ();
 }    
 
+void
+QueueLengthTracer::Change (uint8_t priority, uint32_t bytes)
+{
+  if (Simulator::Now () > stopTime)
+    {
+      return;
+    }
+  if (priority >= m_lastBytes.size ())
+    {
+      m_lastBytes.resize (priority + 1, 0);
+    }
+  const uint32_t last = m_lastBytes[priority];
+  if (m_threshold > 0 && (bytes > last ? bytes - last : last - bytes) >= m_threshold)
+    {
+      m_event.Cancel ();
+      Trace ();
+    }
+  else if (!m_event.IsRunning ())
+    {
+      // at most one row per interval
+      Time delay = std::max (m_lastTrace + m_interval - Simulator::Now (), Time (0));
+      m_event = Simulator::Schedule (delay, &QueueLengthTracer::Trace, this);
+    }
+}
+
 void
 QueueLengthTracer::Trace ()
 {
   size_t nQueue = m_queueDisc->GetNQueueDiscClasses ();
-  m_ofstream << Simulator::Now ().GetMicroSeconds ();
+  if (binaryWriter)
+    {
+      if (m_stream == 0)
+        {
+          std::vector<BinaryTraceWriter::Column> columns{{"time_us", BinaryTraceWriter::I64}};
+          for (size_t i = 0; i < nQueue; i++)
+            {
+              columns.push_back ({"queue" + std::to_string (i), BinaryTraceWriter::U32});
+            }
+          m_stream = binaryWriter->AddStream ("queue-" + m_context, columns);
+        }
+      binaryWriter->BeginRow (m_stream);
+      binaryWriter->Write (Simulator::Now ().GetMicroSeconds ());
+    }
+  else
+    {
+      m_ofstream << Simulator::Now ().GetMicroSeconds ();
+    }
+  m_lastBytes.resize (nQueue, 0);
   for (size_t i = 0; i < nQueue; i++) // Get queue length of each priority
     {
       uint32_t bytes = m_queueDisc->GetQueueDiscClass (i)->GetQueueDisc ()->GetNBytes ();
-      m_ofstream << "," << bytes;
+      if (m_stream)
+        {
+          binaryWriter->Write (bytes);
+        }
+      else
+        {
+          m_ofstream << "," << bytes;
+        }
+      m_lastBytes[i] = bytes;
     }
-  m_ofstream << std::endl;
-  if (Simulator::Now () < stopTime)
+  if (!m_stream)
     {
-      m_timer.Schedule ();
+      m_ofstream << std::endl;
+    }
+  m_lastTrace = Simulator::Now ();
+}
+
+///////////////////////////
+/// SwitchQueueSampler
+///////////////////////////
+
+SwitchQueueSampler::SwitchQueueSampler (std::string context, Ptr<Node> sw, Time interval)
+    : m_interval (interval), m_lastSample (Time (0) - interval), m_stream (0)
+{
+  const uint32_t nDevices = sw->GetNDevices ();
+  m_queueDiscs.resize (nDevices);
+  m_changed.resize (nDevices, false);
+  for (uint32_t i = 0; i < nDevices; i++)
+    {
+      Ptr<DcbNetDevice> dev = DynamicCast<DcbNetDevice> (sw->GetDevice (i));
+      if (dev && dev->GetQueueDisc ())
+        {
+          m_queueDiscs[i] = dev->GetQueueDisc ();
+          m_queueDiscs[i]->TraceConnectWithoutContext (
+              "ClassBytesInQueue", MakeBoundCallback (&SwitchQueueSampler::Change, this, i));
+        }
+    }
+
+  if (binaryWriter)
+    {
+      std::vector<BinaryTraceWriter::Column> columns{{"time_us", BinaryTraceWriter::I64},
+                                                     {"port", BinaryTraceWriter::U32}};
+      for (uint32_t i = 0; i < DcbTrafficControl::PRIORITY_NUMBER; i++)
+        {
+          columns.push_back ({"queue" + std::to_string (i), BinaryTraceWriter::U32});
+        }
+      m_stream = binaryWriter->AddStream ("queue-" + context, columns);
+      return;
+    }
+  std::string filename = GetRealFileName ("queue-" + context + ".csv");
+  m_ofstream.open (filename);
+  if (!m_ofstream.good ())
+    {
+      std::cerr << "Error: Cannot open file \"" << filename << "\"" << std::endl;
+    }
+}
+
+SwitchQueueSampler::~SwitchQueueSampler ()
+{
+  m_event.Cancel ();
+  m_ofstream.close ();
+}
+
+// static
+void
+SwitchQueueSampler::Change (SwitchQueueSampler *sampler, uint32_t port, uint8_t priority,
+                            uint32_t bytes)
+{
+  if (Simulator::Now () > stopTime)
+    {
+      return;
     }
+  if (!sampler->m_changed[port])
+    {
+      sampler->m_changed[port] = true;
+      sampler->m_changedPorts.push_back (port);
+    }
+  if (!sampler->m_event.IsRunning ())
+    {
+      // one event samples all the ports changed within the interval
+      Time delay =
+          std::max (sampler->m_lastSample + sampler->m_interval - Simulator::Now (), Time (0));
+      sampler->m_event = Simulator::Schedule (delay, &SwitchQueueSampler::Sample, sampler);
+    }
+}
+
+void
+SwitchQueueSampler::Sample ()
+{
+  const int64_t now = Simulator::Now ().GetMicroSeconds ();
+  for (uint32_t port : m_changedPorts)
+    {
+      const Ptr<PausableQueueDisc> &qdisc = m_queueDiscs[port];
+      const std::size_t nQueue = qdisc->GetNQueueDiscClasses ();
+      if (m_stream)
+        {
+          binaryWriter->BeginRow (m_stream);
+          binaryWriter->Write (now);
+          binaryWriter->Write (port);
+        }
+      else
+        {
+          m_ofstream << now << "," << port;
+        }
+      for (std::size_t i = 0; i < DcbTrafficControl::PRIORITY_NUMBER; i++)
+        {
+          uint32_t bytes =
+              i < nQueue ? qdisc->GetQueueDiscClass (i)->GetQueueDisc ()->GetNBytes () : 0;
+          if (m_stream)
+            {
+              binaryWriter->Write (bytes);
+            }
+          else
+            {
+              m_ofstream << "," << bytes;
+            }
+        }
+      if (!m_stream)
+        {
+          m_ofstream << "\n";
+        }
+      m_changed[port] = false;
+    }
+  m_changedPorts.clear ();
+  m_lastSample = Simulator::Now ();
 }
 
 
@@ -346,9 +718,21 @@ QueueLengthTracer::Trace ()
 ///////////////////////////
   
 BufferOverflowTracer::BufferOverflowTracer (std::string context, Ptr<DcbTrafficControl> tc)
+    : m_stream (0)
 {
-  std::string filename = GetRealFileName ("bufferoverflow-" + context + ".csv");
-  m_ofstream.open (filename);
+  if (binaryWriter)
+    {
+      m_stream = binaryWriter->AddStream (
+          "bufferoverflow-" + context,
+          {{"src", BinaryTraceWriter::U32}, {"dst", BinaryTraceWriter::U32},
+           {"src_qp", BinaryTraceWriter::U32}, {"dst_qp", BinaryTraceWriter::U32},
+           {"psn", BinaryTraceWriter::U32}});
+    }
+  else
+    {
+      std::string filename = GetRealFileName ("bufferoverflow-" + context + ".csv");
+      m_ofstream.open (filename);
+    }
   tc->TraceConnectWithoutContext ("BufferOverflow",
                                   MakeCallback (&BufferOverflowTracer::Trace, this));
 }
@@ -365,11 +749,21 @@ BufferOverflowTracer::Trace (Ptr<const Packet> packet)
   UdpRoCEv2Header header;
   p->RemoveHeader (ipHeader);
   p->PeekHeader (header);
+  if (m_stream)
+    {
+      binaryWriter->BeginRow (m_stream);
+      binaryWriter->Write (ipHeader.GetSource ().Get ());
+      binaryWriter->Write (ipHeader.GetDestination ().Get ());
+      binaryWriter->Write (header.GetRoCE ().GetSrcQP ());
+      binaryWriter->Write (header.GetRoCE ().GetDestQP ());
+      binaryWriter->Write (header.GetRoCE ().GetPSN ());
+      return;
+    }
   m_ofstream << ipHeader.GetSource () << ","
              << ipHeader.GetDestination () << ","
              << header.GetRoCE ().GetSrcQP () << ","
              << header.GetRoCE ().GetDestQP () << ","
-             << header.GetRoCE ().GetPSN ();
+             << header.GetRoCE ().GetPSN () << std::endl;
 }
   
 } // namespace tracer_extension
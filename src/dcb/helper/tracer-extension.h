@@ -27,6 +27,8 @@
 #include "ns3/rocev2-header.h"
 #include "ns3/rocev2-socket.h"
 #include "ns3/dcb-trace-application.h"
+#include "ns3/fct-statistics.h"
+#include "ns3/pfc-watchdog.h"
 
 namespace ns3 {
 
@@ -42,8 +44,35 @@ namespace tracer_extension {
   void ConfigOutputDirectory (std::string dirName);
   void ConfigStopTime (Time stopTime);
 
+  /**
+   * Write the traces of the rate, queue length and buffer overflow tracers
+   * enabled afterwards into one binary file in the output directory, see
+   * BinaryTraceWriter, instead of one CSV file per tracer.
+   */
+  void ConfigBinaryTrace (std::string fileName);
+
+  /**
+   * Log the FCT of each flow into fileName.
+   */
   void ConfigTraceFCT (Protocol protocol, std::string fileName);
 
+  /**
+   * Aggregate the FCT and slowdown of the flows by size, see FctStatistics,
+   * and write the summary into fileName at the stop time, or when cleaning
+   * the tracers if the simulation stops earlier.  It does not need the log
+   * of ConfigTraceFCT, which can be skipped for large runs.
+   */
+  void ConfigFctStatistics (Protocol protocol, std::string fileName,
+                            const std::vector<uint64_t> &sizeBins, DataRate lineRate,
+                            Time baseRtt);
+  /**
+   * Same as above, with the base RTT of each pair of source and destination
+   * nodes, e.g., from the hops of the path between them.
+   */
+  void ConfigFctStatistics (Protocol protocol, std::string fileName,
+                            const std::vector<uint64_t> &sizeBins, DataRate lineRate,
+                            FctStatistics::BaseRttCallback baseRtt);
+
   void RegisterTraceFCT (Ptr<TraceApplication> app);
 
   /**
@@ -58,10 +87,31 @@ namespace tracer_extension {
 
   void EnableDeviceRateTrace (Ptr<NetDevice> device, std::string context, Time interval);
 
-  void EnablePortQueueLengthTrace (Ptr<NetDevice> device, std::string context, Time interval);
+  /**
+   * Trace the queue length of each priority of a port when it changes: at
+   * most one row per interval, and a row as soon as a priority moved by at
+   * least threshold bytes since the last row if threshold is not 0.  An idle
+   * port costs no event.
+   */
+  void EnablePortQueueLengthTrace (Ptr<NetDevice> device, std::string context, Time interval,
+                                   uint32_t threshold = 0);
+
+  /**
+   * Trace the queue lengths of all ports of a switch into one file, with one
+   * row per port whose queues changed, sampled by one event per interval for
+   * the whole switch and only while some queue changes.
+   */
+  void EnableSwitchQueueLengthTrace (Ptr<Node> sw, std::string context, Time interval);
 
   void EnableBufferoverflowTrace (Ptr<Node> sw, std::string context);
 
+  /**
+   * Watch the PFC of the nodes with a PfcWatchdog, configured by its
+   * attributes, and log the deadlocks and pause storms it finds into fileName.
+   * Call it after the stacks are installed on the nodes.
+   */
+  Ptr<PfcWatchdog> EnablePfcWatchdog (NodeContainer nodes, std::string fileName);
+
   void CleanTracers ();
   
 } // namespace tracer_extension
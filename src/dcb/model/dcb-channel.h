@@ -123,13 +123,6 @@ protected:
     (Ptr<const Packet> packet,
      Ptr<NetDevice> txDevice, Ptr<NetDevice> rxDevice,
      Time duration, Time lastBitTime);
-                    
-private:
-  /** Each point to point link has exactly two net devices. */
-  static const std::size_t N_DEVICES = 2;
-
-  Time          m_delay;    //!< Propagation delay
-  std::size_t        m_nDevices; //!< Devices of this channel
 
   /**
    * The trace source for the packet transmission animation events that the 
@@ -148,6 +141,13 @@ private:
                  Time,                  // Amount of time to transmit the pkt
                  Time                   // Last bit receive time (relative to now)
                  > m_txrxDcb;
+                    
+private:
+  /** Each point to point link has exactly two net devices. */
+  static const std::size_t N_DEVICES = 2;
+
+  Time          m_delay;    //!< Propagation delay
+  std::size_t        m_nDevices; //!< Devices of this channel
 
   /** \brief Wire states
    *
@@ -53,12 +53,18 @@ DcbNetDevice::GetTypeId (void)
                          MakeMac48AddressChecker ())
           .AddAttribute ("DataRate", "The default data rate for point to point links",
                          DataRateValue (DataRate ("100Gb/s")),
-                         MakeDataRateAccessor (&DcbNetDevice::m_bps), MakeDataRateChecker ())
+                         MakeDataRateAccessor (&DcbNetDevice::SetDataRate,
+                                               &DcbNetDevice::GetDataRate),
+                         MakeDataRateChecker ())
           .AddAttribute ("FcEnabled", "Enable flow control functions", BooleanValue (false),
                          MakeBooleanAccessor (&DcbNetDevice::m_fcEnabled), MakeBooleanChecker ())
           .AddAttribute ("InterframeGap", "The time to wait between packet (frame) transmissions",
                          TimeValue (Seconds (0.0)),
                          MakeTimeAccessor (&DcbNetDevice::m_tInterframeGap), MakeTimeChecker ())
+          .AddAttribute ("ReceiveErrorModel",
+                         "The receiver error model used to simulate packet loss",
+                         PointerValue (), MakePointerAccessor (&DcbNetDevice::m_receiveErrorModel),
+                         MakePointerChecker<ErrorModel> ())
           //
           // Transmit queueing discipline for the device which includes its own set
           // of trace hooks.
@@ -210,18 +216,19 @@ if (m_receiveErrorModel && m_receiveErrorModel->IsCorrupt (packet))
       m_snifferTrace (packet);
       m_phyRxEndTrace (packet);
 
-      Ptr<Packet> originalPacket = packet->Copy ();
+      //
+      // Trace sinks will expect complete packets, not packets without some of the
+      // headers. Only pay for the copy when someone is listening.
+      //
+      if (!m_macRxTrace.IsEmpty ())
+        {
+          m_macRxTrace (packet->Copy ());
+        }
 
       EthernetHeader ethHeader;
       packet->RemoveHeader (ethHeader);
       uint16_t protocol = ethHeader.GetLengthType ();
 
-      //
-      // Trace sinks will expect complete packets, not packets without some of the
-      // headers.
-      //
-
-      m_macRxTrace (originalPacket);
       m_rxCallback (this, packet, protocol,
                     GetRemote ()); // calling Node::NonPromiscReceiveFromDevice
     }
@@ -382,6 +389,10 @@ DcbNetDevice::SetDataRate (DataRate bps)
 {
   NS_LOG_FUNCTION (this);
   m_bps = bps;
+  if (m_queueDisc)
+    {
+      m_queueDisc->SetLineRate (bps);
+    }
 }
 
 DataRate
@@ -600,6 +611,7 @@ DcbNetDevice::SetQueueDisc (Ptr<PausableQueueDisc> queueDisc)
 {
   NS_LOG_FUNCTION (this << queueDisc);
   m_queueDisc = queueDisc;
+  m_queueDisc->SetLineRate (m_bps);
 }
 
 Ptr<PausableQueueDisc>
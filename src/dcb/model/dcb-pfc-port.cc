@@ -54,9 +54,7 @@ DcbPfcPort::DoIngressProcess (Ptr<const Packet> packet, uint16_t protocol, const
 {
   NS_LOG_FUNCTION (this << packet << protocol << from << to << packetType);
 
-  CoSTag cosTag;
-  packet->PeekPacketTag (cosTag);
-  uint8_t priority = cosTag.GetCoS ();
+  uint8_t priority = packet->GetSwitchMetadata ().priority;
 
   if (CheckEnableVec (priority))
     {
@@ -113,19 +111,15 @@ DcbPfcPort::ReceivePfc (Ptr<NetDevice> dev, Ptr<const Packet> packet, uint16_t p
           if (quanta > 0)
             {
               uint64_t bitRate = device->GetDataRate ().GetBitRate ();
-              qDisc->SetPaused (priority, true);
               Time pauseTime = NanoSeconds (1e9 * quanta * PfcFrame::QUANTUM_BIT / bitRate);
-              EventId event =
-                  Simulator::Schedule (pauseTime, &PausableQueueDisc::SetPaused, qDisc, priority,
-                                       false); // resume the queue after the pause time.
-              UpdatePauseEvent (priority, event);
+              // the queue disc resumes the queue after the pause time
+              qDisc->PauseUntil (priority, Simulator::Now () + pauseTime);
               NS_LOG_DEBUG ("PFC: node " << Simulator::GetContext () << " port " << index
                                          << " priority " << (uint32_t) priority << " is paused");
             }
           else
             {
-              qDisc->SetPaused (priority, false);
-              CancelPauseEvent (priority);
+              qDisc->Resume (priority);
               NS_LOG_DEBUG ("PFC: node " << Simulator::GetContext () << " port " << index
                                          << " priority " << (uint32_t) priority << " is resumed");
             }
@@ -158,8 +152,11 @@ DcbPfcPort::SetEnableVec (uint8_t enableVec)
 inline bool
 DcbPfcPort::CheckShouldSendPause (uint8_t priority, uint32_t packetSize) const
 {
-  // TODO: add support for dynamic threshold
   const PortInfo::IngressQueueInfo &q = m_port.getQueue (priority);
+  if (m_tc->IsSharedBufferEnabled ())
+    {
+      return !q.isPaused && m_tc->CheckIngressXoff (m_port.m_index, priority);
+    }
   return !q.isPaused &&
          m_tc->CompareIngressQueueLength (m_port.m_index, priority, q.reserve - packetSize) > 0;
 }
@@ -167,8 +164,11 @@ DcbPfcPort::CheckShouldSendPause (uint8_t priority, uint32_t packetSize) const
 inline bool
 DcbPfcPort::CheckShouldSendResume (uint8_t priority) const
 {
-  // TODO: add support for dynamic threshold
   const PortInfo::IngressQueueInfo &q = m_port.getQueue (priority);
+  if (m_tc->IsSharedBufferEnabled ())
+    {
+      return q.isPaused && m_tc->CheckIngressXon (m_port.m_index, priority);
+    }
   return q.isPaused && m_tc->CompareIngressQueueLength (m_port.m_index, priority, q.xon) <= 0;
 }
 
@@ -178,18 +178,6 @@ DcbPfcPort::SetPaused (uint8_t priority, bool paused)
   m_port.getQueue (priority).isPaused = paused;
 }
 
-inline void
-DcbPfcPort::UpdatePauseEvent (uint8_t priority, const EventId &event)
-{
-  m_port.getQueue (priority).ReplacePauseEvent (event);
-}
-
-inline void
-DcbPfcPort::CancelPauseEvent (uint8_t priority)
-{
-  m_port.getQueue (priority).CancelPauseEvent ();
-}
-
 /**
  * class DcbPfcControl::PortInfo implementation starts.
  */
@@ -224,31 +212,10 @@ DcbPfcPort::PortInfo::getQueue (uint8_t priority)
  */
 
 DcbPfcPort::PortInfo::IngressQueueInfo::IngressQueueInfo ()
-    : reserve (0), xon (0), isPaused (false), hasEvent (false), pauseEvent ()
+    : reserve (0), xon (0), isPaused (false)
 {
 }
 
-inline void
-DcbPfcPort::PortInfo::IngressQueueInfo::ReplacePauseEvent (const EventId &event)
-{
-  if (hasEvent)
-    {
-      pauseEvent.Cancel ();
-    }
-  hasEvent = true;
-  pauseEvent = event;
-}
-
-inline void
-DcbPfcPort::PortInfo::IngressQueueInfo::CancelPauseEvent ()
-{
-  if (hasEvent)
-    {
-      hasEvent = false;
-      pauseEvent.Cancel ();
-    }
-}
-
 /** class DcbPfcControl::PortInfo::IngressQueueInfo implementation finished. */
 
 } // namespace ns3
@@ -23,7 +23,6 @@
 
 #include "dcb-flow-control-port.h"
 #include "dcb-traffic-control.h"
-#include "ns3/event-id.h"
 #include "ns3/net-device.h"
 
 namespace ns3 {
@@ -96,13 +95,7 @@ protected:
       uint32_t xon;
       bool isPaused;
 
-      bool hasEvent;
-      EventId pauseEvent;
-      
       IngressQueueInfo ();
-
-      void ReplacePauseEvent (const EventId &event);
-      void CancelPauseEvent ();
     }; // struct IngressQueueInfo
 
     explicit PortInfo (uint32_t index);
@@ -124,9 +117,6 @@ protected:
 
   void SetPaused (uint8_t priority, bool paused);
 
-  void UpdatePauseEvent (uint8_t priority, const EventId &event);
-  void CancelPauseEvent (uint8_t priority);
-
 private:
   PortInfo m_port;
 
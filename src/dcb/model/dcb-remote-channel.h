@@ -0,0 +1,65 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#ifndef DCB_REMOTE_CHANNEL_H
+#define DCB_REMOTE_CHANNEL_H
+
+#include "dcb-channel.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup dcb
+ *
+ * \brief A DcbChannel whose two ends live in different MPI ranks.
+ *
+ * Like PointToPointRemoteChannel, it only overrides TransmitStart and hands
+ * the packet to MpiInterface instead of scheduling the receive locally.
+ * The receiving DcbNetDevice must have an MpiReceiver aggregated whose
+ * callback is DcbNetDevice::Receive. Data packets and PFC frames both travel
+ * through here, so a pause sent across a rank boundary arrives after the
+ * same tx + propagation delay as on a local link.
+ */
+class DcbRemoteChannel : public DcbChannel
+{
+public:
+  /**
+   * \brief Get the TypeId
+   *
+   * \return The TypeId for this class
+   */
+  static TypeId GetTypeId (void);
+
+  DcbRemoteChannel ();
+  ~DcbRemoteChannel ();
+
+  /**
+   * \brief Transmit the packet to the remote rank
+   *
+   * \param p Packet to transmit
+   * \param src Source DcbNetDevice
+   * \param txTime Transmit time to apply
+   * \returns true if successful (currently always true)
+   */
+  virtual bool TransmitStart (Ptr<const Packet> p, Ptr<DcbNetDevice> src, Time txTime) override;
+
+}; // class DcbRemoteChannel
+
+} // namespace ns3
+
+#endif // DCB_REMOTE_CHANNEL_H
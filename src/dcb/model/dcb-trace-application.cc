@@ -65,14 +65,19 @@ TraceApplication::GetTypeId ()
           //                MakeTypeIdChecker ())
           .AddTraceSource ("FlowComplete", "Trace when a flow completes.",
                            MakeTraceSourceAccessor (&TraceApplication::m_flowCompleteTrace),
-                           "ns3::TracerExtension::FlowTracedCallback");
+                           "ns3::TracerExtension::FlowTracedCallback")
+          .AddTraceSource ("LiveFlows", "Number of flows started but not completed yet.",
+                           MakeTraceSourceAccessor (&TraceApplication::m_liveFlows),
+                           "ns3::TracedValueCallback::Uint32");
   return tid;
 }
 
 TraceApplication::TraceApplication (Ptr<DcTopology> topology, uint32_t nodeIndex,
                                     int32_t destIndex /* = -1 */)
-    : m_enableSend (true),
+    : m_liveFlows (0),
+      m_enableSend (true),
       m_enableReceive (true),
+      m_randomFlows (true),
       m_topology (topology),
       m_nodeIndex (nodeIndex),
       m_ecnEnabled (true),
@@ -109,6 +114,10 @@ TraceApplication::InitForRngs ()
 TraceApplication::~TraceApplication ()
 {
   NS_LOG_FUNCTION (this);
+  for (auto &[_, flow] : m_flows) // flows not completed before the simulation stops
+    {
+      delete flow;
+    }
 }
 
 // int64_t
@@ -179,10 +188,9 @@ TraceApplication::StartApplication (void)
 
   if (m_enableSend)
     {
-      for (Time t = Simulator::Now () + GetNextFlowArriveInterval (); t < m_stopTime;
-           t += GetNextFlowArriveInterval ())
+      if (m_randomFlows)
         {
-          ScheduleNextFlow (t);
+          ScheduleNextFlow ();
         }
       if (m_protoGroup == ProtocolGroup::RoCEv2)
         {
@@ -195,6 +203,7 @@ void
 TraceApplication::StopApplication (void)
 {
   NS_LOG_FUNCTION (this);
+  m_nextFlowEvent.Cancel ();
 }
 
 uint32_t
@@ -241,29 +250,63 @@ TraceApplication::NodeIndexToAddr (uint32_t destNode) const
   return InetSocketAddress (ipv4Addr, portNum);
 }
 
+/**
+ * \return an IP TOS whose priority by Socket::IpTos2Priority is the given one
+ */
+static uint8_t
+PriorityToIpTos (uint8_t priority)
+{
+  switch (priority)
+    {
+    case Socket::SocketPriority::NS3_PRIO_BESTEFFORT:
+      return 0;
+    case Socket::SocketPriority::NS3_PRIO_BULK:
+      return 4 << 1;
+    case Socket::SocketPriority::NS3_PRIO_INTERACTIVE:
+      return 8 << 1;
+    case Socket::SocketPriority::NS3_PRIO_INTERACTIVE_BULK:
+      return 12 << 1;
+    default:
+      NS_FATAL_ERROR ("Flow priority should be 0, 2, 4 or 6, not " << +priority);
+    }
+}
+
 Ptr<Socket>
-TraceApplication::CreateNewSocket (uint32_t destNode)
+TraceApplication::CreateNewSocket (uint32_t destNode, uint8_t priority)
 {
   NS_LOG_FUNCTION (this);
 
-  Ptr<Socket> socket = Socket::CreateSocket (GetNode (), m_socketTid);
-  socket->BindToNetDevice (GetNode ()->GetDevice (0));
-  if (m_protoGroup == ProtocolGroup::TCP)
+  Ptr<Socket> socket;
+  if (!m_socketPool.empty ())
     {
-      socket->SetAttribute ("SegmentSize",
-                            UintegerValue (1440)); // default TCP segment is too small
+      socket = m_socketPool.back ();
+      m_socketPool.pop_back ();
+      DynamicCast<UdpBasedSocket> (socket)->Reset ();
     }
   else
     {
-      Ptr<UdpBasedSocket> udpBasedSocket = DynamicCast<UdpBasedSocket> (socket);
-      if (udpBasedSocket)
+      socket = Socket::CreateSocket (GetNode (), m_socketTid);
+      socket->BindToNetDevice (GetNode ()->GetDevice (0));
+      if (m_protoGroup == ProtocolGroup::TCP)
+        {
+          socket->SetAttribute ("SegmentSize",
+                                UintegerValue (1440)); // default TCP segment is too small
+        }
+      else
         {
-          udpBasedSocket->SetFlowCompleteCallback (
-              MakeCallback (&TraceApplication::FlowCompletes, this));
-          Ptr<RoCEv2Socket> roceSocket = DynamicCast<RoCEv2Socket> (udpBasedSocket);
-          if (roceSocket)
+          Ptr<UdpBasedSocket> udpBasedSocket = DynamicCast<UdpBasedSocket> (socket);
+          if (udpBasedSocket)
             {
-              roceSocket->SetStopTime (m_stopTime);
+              udpBasedSocket->SetFlowCompleteCallback (
+                  MakeCallback (&TraceApplication::FlowCompletes, this));
+              // only sockets closing themselves after the flow can be recycled
+              socket->SetCloseCallbacks (MakeCallback (&TraceApplication::RecycleSocket, this),
+                                         MakeNullCallback<void, Ptr<Socket>> ());
+              Ptr<RoCEv2Socket> roceSocket = DynamicCast<RoCEv2Socket> (udpBasedSocket);
+              if (roceSocket)
+                {
+                  roceSocket->SetStopTime (m_stopTime);
+                }
             }
         }
     }
@@ -275,10 +318,12 @@ TraceApplication::CreateNewSocket (uint32_t destNode)
     }
 
   InetSocketAddress destAddr = NodeIndexToAddr (destNode);
+  uint8_t tos = PriorityToIpTos (priority);
   if (m_ecnEnabled)
     {
-      destAddr.SetTos (Ipv4Header::EcnType::ECN_ECT1);
+      tos |= Ipv4Header::EcnType::ECN_ECT1;
     }
+  destAddr.SetTos (tos);
   ret = socket->Connect (destAddr);
   if (ret == -1)
     {
@@ -292,22 +337,56 @@ TraceApplication::CreateNewSocket (uint32_t destNode)
 }
 
 void
-TraceApplication::ScheduleNextFlow (const Time &startTime)
+TraceApplication::RecycleSocket (Ptr<Socket> socket)
+{
+  NS_LOG_FUNCTION (this << socket);
+  m_socketPool.push_back (socket);
+}
+
+void
+TraceApplication::ScheduleNextFlow ()
+{
+  const Time interval = GetNextFlowArriveInterval ();
+  if (Simulator::Now () + interval < m_stopTime)
+    {
+      m_nextFlowEvent = Simulator::Schedule (interval, &TraceApplication::StartNextFlow, this);
+    }
+}
+
+void
+TraceApplication::StartNextFlow ()
 {
+  NS_LOG_FUNCTION (this);
+
   uint32_t destNode = GetDestinationNode ();
-  Ptr<Socket> socket = CreateNewSocket (destNode);
-  uint64_t size = GetNextFlowSize ();
+  StartFlow (destNode, GetNextFlowSize ());
+
+  ScheduleNextFlow ();
+}
+
+void
+TraceApplication::StartFlow (uint32_t destNode, uint64_t size, uint8_t priority /* = 0 */)
+{
+  NS_LOG_FUNCTION (this << destNode << size << +priority);
 
-  Flow *flow = new Flow (size, startTime, destNode, socket);
+  Ptr<Socket> socket = CreateNewSocket (destNode, priority);
+  Flow *flow = new Flow (size, Simulator::Now (), destNode, socket);
   m_flows.emplace (socket, flow); // used when flow completes
-  Simulator::Schedule (startTime - Simulator::Now (), &TraceApplication::SendNextPacket, this,
-                       flow);
+  m_liveFlows++;
+  SendNextPacket (flow);
 }
 
 void
 TraceApplication::SendNextPacket (Flow *flow)
 {
   const uint32_t packetSize = std::min (flow->remainBytes, MSS);
+  Ptr<UdpBasedSocket> udpSock = DynamicCast<UdpBasedSocket> (flow->socket);
+  if (udpSock && flow->remainBytes <= MSS)
+    {
+      udpSock->FinishSending (); // the packet below is the last one
+    }
+  // The payload is all zero, which Buffer keeps as a virtual zero area: no
+  // payload bytes are allocated or copied along the path.
   Ptr<Packet> packet = Create<Packet> (packetSize);
   int actual = flow->socket->Send (packet);
   if (actual == static_cast<int> (packetSize))
@@ -322,22 +401,8 @@ TraceApplication::SendNextPacket (Flow *flow)
               Simulator::Schedule (txTime, &TraceApplication::SendNextPacket, this, flow);
               return;
             }
-          else
-            {
-              // flow sending completes
-              Ptr<UdpBasedSocket> udpSock = DynamicCast<UdpBasedSocket> (flow->socket);
-              if (udpSock)
-                {
-                  udpSock->FinishSending ();
-                }
-              // TODO: do some trace here
-              // ...
-            }
         }
-      // m_flows.erase (flow);
-      // flow->Dispose ();
-      // Dispose will delete the struct leading to flow a dangling pointer.
-      // flow = nullptr;
+      // flow sending completes, the Flow is released in FlowCompletes
     }
   else
     {
@@ -439,6 +504,10 @@ TraceApplication::FlowCompletes (Ptr<UdpBasedSocket> socket)
   Flow *flow = p->second;
   m_flowCompleteTrace (Simulator::GetContext (), flow->destNode, socket->GetSrcPort (),
                        socket->GetDstPort (), flow->totalBytes, flow->startTime, Simulator::Now ());
+  // The socket closes and returns to the pool by itself after the last ACK
+  m_flows.erase (p);
+  delete flow;
+  m_liveFlows--;
 }
 
 void
@@ -453,4 +522,10 @@ TraceApplication::SetReceiveEnabled (bool enabled)
   m_enableReceive = enabled;
 }
 
+void
+TraceApplication::SetRandomFlowsEnabled (bool enabled)
+{
+  m_randomFlows = enabled;
+}
+
 } // namespace ns3
@@ -26,9 +26,11 @@
 #include "ns3/inet-socket-address.h"
 #include "ns3/rocev2-header.h"
 #include "ns3/traced-callback.h"
+#include "ns3/traced-value.h"
 #include "ns3/seq-ts-size-header.h"
 #include "ns3/random-variable-stream.h"
 #include "ns3/dc-topology.h"
+#include "ns3/event-id.h"
 #include "rocev2-socket.h"
 #include "udp-based-socket.h"
 #include <map>
@@ -92,12 +94,6 @@ public:
       : startTime (t), totalBytes (s), remainBytes (s), destNode (dest), socket (sock)
     {
     }
-    void Dispose () // to provide a similar API as ns-3
-    {
-      socket->Close ();
-      socket->SetRecvCallback(MakeNullCallback<void, Ptr<Socket> > ());
-      delete this; // TODO: is it ok to suicide here?
-    }
   };
   
   typedef const std::vector<std::pair<double, double>> TraceCdf;
@@ -111,6 +107,18 @@ public:
   void SetSendEnabled (bool enabled);
   void SetReceiveEnabled (bool enabled);
 
+  /**
+   * \brief Whether to generate random flows by the CDF and the arrival interval.
+   * If not, the application only sends the flows given by StartFlow.
+   */
+  void SetRandomFlowsEnabled (bool enabled);
+
+  /**
+   * \brief Start a flow to destNode now, e.g., one replayed from a trace.
+   * \param priority 0, 2, 4 or 6 as Socket::SocketPriority
+   */
+  void StartFlow (uint32_t destNode, uint64_t size, uint8_t priority = 0);
+
   void FlowCompletes (Ptr<UdpBasedSocket> socket);
 
   constexpr static inline const uint64_t MSS = 1000; // bytes
@@ -165,14 +173,26 @@ private:
   virtual void StopApplication (void) override; // Called at time specified by Stop
 
   /**
-   * \brief Schedule the next On period start
+   * \brief Draw the next flow arrival and schedule StartNextFlow at that time.
+   * Only one arrival is pending at any time so that sockets are created on demand.
+   */
+  void ScheduleNextFlow ();
+
+  /**
+   * \brief Create the socket of the arriving flow, start sending and
+   * schedule the next arrival.
+   */
+  void StartNextFlow ();
+
+  /**
+   * \brief Create new socket, or reuse a closed one from the socket pool.
    */
-  void ScheduleNextFlow (const Time &startTime);
+  Ptr<Socket> CreateNewSocket (uint32_t destNode, uint8_t priority);
 
   /**
-   * \brief Create new socket.
+   * \brief Put a closed socket back to the pool for later flows.
    */
-  Ptr<Socket> CreateNewSocket (uint32_t destNode);
+  void RecycleSocket (Ptr<Socket> socket);
 
   /**
    * \brief Get destination node index of one flow.
@@ -228,10 +248,14 @@ private:
    */
   void HandleRead (Ptr<Socket> socket); 
   
-  std::map<Ptr<Socket>, Flow *> m_flows;
+  std::map<Ptr<Socket>, Flow *> m_flows;     //!< Flows not completed yet
+  std::vector<Ptr<Socket>> m_socketPool;     //!< Closed sockets ready to be reused
+  TracedValue<uint32_t>  m_liveFlows;       //!< Number of flows not completed yet
+  EventId                m_nextFlowEvent;   //!< Pending arrival of the next flow
 
   bool                   m_enableSend;
   bool                   m_enableReceive;
+  bool                   m_randomFlows;     //!< Whether to generate random flows
   const Ptr<DcTopology>  m_topology;        //!< The topology
   const uint32_t         m_nodeIndex;
   bool                   m_ecnEnabled;
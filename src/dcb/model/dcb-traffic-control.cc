@@ -24,19 +24,31 @@
 #include "ns3/address.h"
 #include "ns3/boolean.h"
 #include "ns3/callback.h"
+#include "ns3/enum.h"
 #include "ns3/ethernet-header.h"
 #include "ns3/fatal-error.h"
+#include "ns3/global-router-interface.h"
+#include "ns3/hash.h"
+#include "ns3/ipv4-global-routing.h"
+#include "ns3/ipv4-l3-protocol.h"
 #include "ns3/ipv4-queue-disc-item.h"
 #include "ns3/log-macros-enabled.h"
 #include "ns3/nstime.h"
 #include "ns3/pfc-frame.h"
 #include "ns3/trace-source-accessor.h"
+#include "ns3/uinteger.h"
 #include "ns3/type-id.h"
 #include "ns3/simulator.h"
 #include "ns3/ipv4-header.h"
+#include "ns3/node.h"
+#include "ns3/rocev2-header.h"
 #include "ns3/socket.h"
+#include "ns3/udp-header.h"
+#include "ns3/udp-l4-protocol.h"
 #include "pausable-queue-disc.h"
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace ns3 {
 
@@ -44,6 +56,9 @@ NS_LOG_COMPONENT_DEFINE ("DcbTrafficControl");
 
 NS_OBJECT_ENSURE_REGISTERED (DcbTrafficControl);
 
+/// The forwarding table is a vector if at least one in this many of its entries has a route
+static const uint32_t MAX_FIB_SPARSITY = 4;
+
 TypeId
 DcbTrafficControl::GetTypeId (void)
 {
@@ -52,6 +67,31 @@ DcbTrafficControl::GetTypeId (void)
           .SetParent<TrafficControlLayer> ()
           .SetGroupName ("Dcb")
           .AddConstructor<DcbTrafficControl> ()
+          .AddAttribute ("FastForwarding",
+                         "Whether to forward IPv4 packets through the table built by "
+                         "BuildForwardingTable instead of Ipv4L3Protocol",
+                         BooleanValue (true),
+                         MakeBooleanAccessor (&DcbTrafficControl::m_fastForwarding),
+                         MakeBooleanChecker ())
+          .AddAttribute ("LoadBalancing",
+                         "How the fast path picks one of the equal-cost egress ports",
+                         EnumValue (DcbTrafficControl::ECMP),
+                         MakeEnumAccessor (&DcbTrafficControl::m_loadBalancing),
+                         MakeEnumChecker (DcbTrafficControl::ECMP, "Ecmp",
+                                          DcbTrafficControl::PACKET_SPRAY, "PacketSpray",
+                                          DcbTrafficControl::FLOWLET, "Flowlet",
+                                          DcbTrafficControl::CONGESTION_AWARE, "CongestionAware"))
+          .AddAttribute ("FlowletGap",
+                         "A flow idle for longer than this starts a new flowlet, which "
+                         "may take another port",
+                         TimeValue (MicroSeconds (50)),
+                         MakeTimeAccessor (&DcbTrafficControl::m_flowletGap),
+                         MakeTimeChecker ())
+          .AddAttribute ("FlowletTableSize",
+                         "Number of entries of the flowlet table, indexed by flow hash",
+                         UintegerValue (4096),
+                         MakeUintegerAccessor (&DcbTrafficControl::m_flowletTableSize),
+                         MakeUintegerChecker<uint32_t> (1))
           .AddTraceSource ("BufferOverflow", "Trace source indicating buffer overflow",
                            MakeTraceSourceAccessor (&DcbTrafficControl::m_bufferOverflowTrace),
                            "ns3::Packet::TracedCallback");
@@ -65,9 +105,17 @@ DcbTrafficControl::GetInstanceTypeId (void) const
   return GetTypeId ();
 }
 
-DcbTrafficControl::DcbTrafficControl () : TrafficControlLayer ()
+DcbTrafficControl::DcbTrafficControl ()
+    : TrafficControlLayer (),
+      m_fastForwarding (true),
+      m_calcChecksum (false),
+      m_fibBase (0),
+      m_ecmpMode (Ipv4GlobalRouting::PER_FLOW_ECMP),
+      m_loadBalancing (ECMP),
+      m_flowletTableSize (4096)
 {
   NS_LOG_FUNCTION (this);
+  m_rand = CreateObject<UniformRandomVariable> ();
 }
 
 DcbTrafficControl::~DcbTrafficControl ()
@@ -75,6 +123,17 @@ DcbTrafficControl::~DcbTrafficControl ()
   NS_LOG_FUNCTION (this);
 }
 
+void
+DcbTrafficControl::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_fib.clear ();
+  m_fibMap.clear ();
+  m_portQueues.clear ();
+  m_rand = nullptr;
+  TrafficControlLayer::DoDispose ();
+}
+
 void
 DcbTrafficControl::SetRootQueueDiscOnDevice (Ptr<DcbNetDevice> device, Ptr<PausableQueueDisc> qDisc)
 {
@@ -99,6 +158,37 @@ DcbTrafficControl::SetBufferSize (uint32_t bytes)
   m_buffer.SetBufferSpace (bytes);
 }
 
+void
+DcbTrafficControl::ConfigSharedBuffer (const DcbSharedBufferConfig &config)
+{
+  NS_LOG_FUNCTION (this);
+  m_buffer.ConfigShared (config);
+}
+
+bool
+DcbTrafficControl::IsSharedBufferEnabled () const
+{
+  return m_buffer.IsSharedEnabled ();
+}
+
+uint32_t
+DcbTrafficControl::GetSharedBufferFreeBytes () const
+{
+  return static_cast<uint32_t> (m_buffer.GetSharedFreeCells () * Buffer::CELL_SIZE);
+}
+
+bool
+DcbTrafficControl::CheckIngressXoff (uint32_t port, uint8_t priority) const
+{
+  return m_buffer.CheckXoff (port, priority);
+}
+
+bool
+DcbTrafficControl::CheckIngressXon (uint32_t port, uint8_t priority) const
+{
+  return m_buffer.CheckXon (port, priority);
+}
+
 void
 DcbTrafficControl::Receive (Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol,
                             const Address &from, const Address &to,
@@ -106,19 +196,24 @@ DcbTrafficControl::Receive (Ptr<NetDevice> device, Ptr<const Packet> packet, uin
 {
   NS_LOG_FUNCTION (this << device << packet << protocol << from << to << packetType);
 
-  // Add priority to packet tag
-  uint8_t priority = PeekPriorityOfPacket (packet);
-  CoSTag cosTag;
-  cosTag.SetCoS (priority);
-  packet->AddPacketTag (cosTag); // CoSTag is removed in PausableQueueDisc::DoEnqueue
+  // Parse the IPv4 header once for priority, buffer accounting and forwarding
+  Ipv4Header ipv4Header;
+  if (m_calcChecksum)
+    {
+      ipv4Header.EnableChecksum ();
+    }
+  packet->PeekHeader (ipv4Header);
 
-  // Add from-index to packet tag
+  // Record the priority for PausableQueueDisc::DoEnqueue and the ingress port for
+  // EgressProcess to decrement the counter
+  uint8_t priority = Socket::IpTos2Priority (ipv4Header.GetTos ());
   uint32_t index = device->GetIfIndex ();
-  DeviceIndexTag tag (index);
-  packet->AddPacketTag (tag); // egress will read the index from tag to decrement counter
+  Packet::SwitchMetadata metadata;
+  metadata.ingressPort = index;
+  metadata.priority = priority;
+  metadata.valid = true;
+  packet->SetSwitchMetadata (metadata);
   // update ingress queue length
-  Ipv4Header ipv4Header;
-  packet->PeekHeader (ipv4Header);
   bool success = m_buffer.InPacketProcess (index, priority,
                                            packet->GetSize () - ipv4Header.GetSerializedSize ());
   if (!success)
@@ -133,16 +228,236 @@ DcbTrafficControl::Receive (Ptr<NetDevice> device, Ptr<const Packet> packet, uin
       // run flow control ingress process
       port.GetFC ()->IngressProcess (packet, protocol, from, to, packetType);
     }
+  if (m_fastForwarding && protocol == Ipv4L3Protocol::PROT_NUMBER &&
+      FastForward (ipv4Header, packet))
+    {
+      return;
+    }
   TrafficControlLayer::Receive (device, packet, protocol, from, to, packetType);
 }
 
+bool
+DcbTrafficControl::FastForward (const Ipv4Header &header, Ptr<const Packet> packet)
+{
+  NS_LOG_FUNCTION (this << header << packet);
+
+  const std::vector<Ptr<NetDevice>> *fibEntry = LookupFib (header.GetDestination ());
+  if (fibEntry == nullptr || header.GetTtl () <= 1)
+    {
+      return false; // no host route, or Ipv4L3Protocol should answer the TTL expiry
+    }
+  const std::vector<Ptr<NetDevice>> &ports = *fibEntry;
+  const bool perFlow = ports.size () > 1 && m_ecmpMode == Ipv4GlobalRouting::PER_FLOW_ECMP &&
+                       m_loadBalancing != PACKET_SPRAY;
+  if (perFlow && header.GetProtocol () != UdpL4Protocol::PROT_NUMBER)
+    {
+      return false; // only UDP is hashed here, leave the rest to Ipv4GlobalRouting
+    }
+
+  Ptr<Packet> payload = packet->Copy ();
+  payload->RemoveAtStart (header.GetSerializedSize ());
+  Ptr<NetDevice> outDev = ports[0]; // Ipv4GlobalRouting without ECMP takes the first route
+  if (ports.size () > 1 && !perFlow && m_ecmpMode != Ipv4GlobalRouting::NONE)
+    { // per-packet ECMP, or packet spraying
+      outDev = ports[m_rand->GetInteger (0, ports.size () - 1)];
+    }
+  else if (perFlow)
+    {
+      Packet::SwitchMetadata metadata = payload->GetSwitchMetadata ();
+      metadata.flowHash = EcmpHash (header, payload);
+      payload->SetSwitchMetadata (metadata);
+      if (m_loadBalancing == ECMP)
+        {
+          outDev = ports[metadata.flowHash % ports.size ()];
+        }
+      else
+        {
+          outDev = ports[SelectFlowletPort (metadata.flowHash, ports)];
+        }
+    }
+
+  Ipv4Header fwdHeader = header;
+  fwdHeader.SetTtl (header.GetTtl () - 1);
+  NS_LOG_LOGIC ("Fast forward to " << header.GetDestination () << " via device "
+                                   << outDev->GetIfIndex ());
+  // DcbNetDevice does not need ARP, so the destination is always the broadcast address,
+  // just like Ipv4Interface::Send does.
+  Send (outDev, Create<Ipv4QueueDiscItem> (payload, outDev->GetBroadcast (),
+                                           Ipv4L3Protocol::PROT_NUMBER, fwdHeader));
+  return true;
+}
+
+const std::vector<Ptr<NetDevice>> *
+DcbTrafficControl::LookupFib (Ipv4Address destination) const
+{
+  if (!m_fibMap.empty ())
+    {
+      auto it = m_fibMap.find (destination.Get ());
+      return it == m_fibMap.end () ? nullptr : &it->second;
+    }
+  const uint32_t index = destination.Get () - m_fibBase; // wraps if below base
+  if (index >= m_fib.size () || m_fib[index].empty ())
+    {
+      return nullptr;
+    }
+  return &m_fib[index];
+}
+
+// static
+uint32_t
+DcbTrafficControl::EcmpHash (const Ipv4Header &header, Ptr<const Packet> payload)
+{
+  // Same layout as Ipv4GlobalRouting::HashBuf so that both paths pick the same route
+  union {
+    struct {
+      uint32_t srcIp;
+      uint32_t dstIp;
+      uint16_t srcPort;
+      uint16_t dstPort;
+    } __attribute__ ((__packed__)) f;
+    char b[12];
+  } buf;
+  buf.f.srcIp = header.GetSource ().Get ();
+  buf.f.dstIp = header.GetDestination ().Get ();
+
+  UdpRoCEv2Header udpRoCE;
+  if (payload->GetSize () >= udpRoCE.GetSerializedSize ())
+    {
+      payload->PeekHeader (udpRoCE);
+      const UdpHeader &udp = udpRoCE.GetUdp ();
+      if (udp.GetSourcePort () == 4791) // RoCEv2L4Protocol::PROT_NUMBER
+        {
+          buf.f.srcPort = udpRoCE.GetRoCE ().GetSrcQP ();
+          buf.f.dstPort = udpRoCE.GetRoCE ().GetDestQP ();
+        }
+      else
+        {
+          buf.f.srcPort = udp.GetSourcePort ();
+          buf.f.dstPort = udp.GetDestinationPort ();
+        }
+    }
+  else
+    {
+      UdpHeader udp;
+      payload->PeekHeader (udp);
+      buf.f.srcPort = udp.GetSourcePort ();
+      buf.f.dstPort = udp.GetDestinationPort ();
+    }
+  return Hash32 (buf.b, sizeof (buf.b));
+}
+
+uint32_t
+DcbTrafficControl::SelectFlowletPort (uint32_t flowHash, const std::vector<Ptr<NetDevice>> &ports)
+{
+  const Time now = Simulator::Now ();
+  Flowlet &flowlet = m_flowlets[flowHash % m_flowlets.size ()];
+  // An entry may be shared with a flow to another destination with fewer ports
+  if (flowlet.port >= ports.size () || now - flowlet.lastSeen > m_flowletGap)
+    {
+      flowlet.port = m_loadBalancing == CONGESTION_AWARE
+                         ? SelectLeastCongestedPort (ports)
+                         : m_rand->GetInteger (0, ports.size () - 1);
+      NS_LOG_LOGIC ("New flowlet of flow hash " << flowHash << " on port " << flowlet.port);
+    }
+  flowlet.lastSeen = now;
+  return flowlet.port;
+}
+
+uint32_t
+DcbTrafficControl::SelectLeastCongestedPort (const std::vector<Ptr<NetDevice>> &ports)
+{
+  // Start from a random port so that ties do not always go to the first one
+  const uint32_t n = ports.size ();
+  const uint32_t start = m_rand->GetInteger (0, n - 1);
+  uint32_t best = start;
+  uint32_t bestBytes = m_portQueues[ports[start]->GetIfIndex ()]->GetNBytes ();
+  for (uint32_t i = 1; i < n && bestBytes > 0; i++)
+    {
+      const uint32_t port = (start + i) % n;
+      const uint32_t bytes = m_portQueues[ports[port]->GetIfIndex ()]->GetNBytes ();
+      if (bytes < bestBytes)
+        {
+          best = port;
+          bestBytes = bytes;
+        }
+    }
+  return best;
+}
+
+void
+DcbTrafficControl::BuildForwardingTable ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_fib.clear ();
+  m_fibMap.clear ();
+  m_calcChecksum = Node::ChecksumEnabled ();
+  Ptr<GlobalRouter> router = GetObject<GlobalRouter> ();
+  Ptr<Ipv4> ipv4 = GetObject<Ipv4> ();
+  if (router == nullptr || router->GetRoutingProtocol () == nullptr || ipv4 == nullptr)
+    {
+      NS_FATAL_ERROR ("Building the forwarding table requires Ipv4GlobalRouting on the node");
+    }
+
+  UintegerValue ecmpMode;
+  router->GetRoutingProtocol ()->GetAttribute ("RandomEcmpRouting", ecmpMode);
+  m_ecmpMode = static_cast<Ipv4GlobalRouting::EcmpMode> (ecmpMode.Get ());
+  const std::map<Ipv4Address, std::vector<uint32_t>> routes =
+      router->GetRoutingProtocol ()->GetHostRouteInterfaces ();
+  if (routes.empty ())
+    {
+      return;
+    }
+  // Addresses are usually allocated contiguously, so the table is dense.
+  m_fibBase = routes.begin ()->first.Get ();
+  const uint64_t span = static_cast<uint64_t> (routes.rbegin ()->first.Get ()) - m_fibBase + 1;
+  const bool dense = span <= static_cast<uint64_t> (routes.size ()) * MAX_FIB_SPARSITY;
+  if (dense)
+    {
+      m_fib.resize (span);
+    }
+  else
+    {
+      m_fibMap.reserve (routes.size ());
+    }
+  for (const auto &route : routes)
+    {
+      std::vector<Ptr<NetDevice>> &ports = dense ? m_fib[route.first.Get () - m_fibBase]
+                                                 : m_fibMap[route.first.Get ()];
+      ports.reserve (route.second.size ());
+      for (uint32_t interface : route.second)
+        {
+          ports.push_back (ipv4->GetNetDevice (interface));
+        }
+    }
+
+  if (m_loadBalancing == FLOWLET || m_loadBalancing == CONGESTION_AWARE)
+    {
+      m_flowlets.assign (m_flowletTableSize, {Time (), std::numeric_limits<uint32_t>::max ()});
+    }
+  if (m_loadBalancing == CONGESTION_AWARE)
+    {
+      Ptr<Node> node = GetObject<Node> ();
+      m_portQueues.assign (node->GetNDevices (), nullptr);
+      for (uint32_t i = 0; i < node->GetNDevices (); i++)
+        {
+          Ptr<DcbNetDevice> dev = DynamicCast<DcbNetDevice> (node->GetDevice (i));
+          if (dev)
+            {
+              m_portQueues[i] = dev->GetQueueDisc ();
+            }
+        }
+    }
+}
+
 void
 DcbTrafficControl::EgressProcess (uint32_t outPort, uint8_t priority, Ptr<Packet> packet)
 {
   NS_LOG_FUNCTION (this << outPort << priority << packet);
-  DeviceIndexTag tag;
-  packet->RemovePacketTag (tag);
-  uint32_t fromIdx = tag.GetIndex ();
+  Packet::SwitchMetadata metadata = packet->GetSwitchMetadata ();
+  uint32_t fromIdx = metadata.ingressPort;
+  metadata.valid = false; // the metadata is per hop
+  packet->SetSwitchMetadata (metadata);
   m_buffer.OutPacketProcess (fromIdx, priority, packet->GetSize ());
 
   PortInfo &port = m_buffer.GetPort (outPort);
@@ -200,6 +515,8 @@ DcbTrafficControl::PeekPriorityOfPacket (const Ptr<const Packet> packet)
 DcbTrafficControl::PortInfo::PortInfo () : m_fcEnabled (false), m_fc (nullptr)
 {
   std::memset(m_ingressQueueLength, 0, sizeof(m_ingressQueueLength));
+  std::memset (m_ingressSharedCells, 0, sizeof (m_ingressSharedCells));
+  std::memset (m_ingressHeadroomCells, 0, sizeof (m_ingressHeadroomCells));
 }
 
 void
@@ -225,7 +542,16 @@ DcbTrafficControl::PortInfo::CallFCPacketOutPipeline (uint32_t fromIdx, uint8_t
     }
 }
 
-DcbTrafficControl::Buffer::Buffer () : m_remainCells (32 * 1024 * 1024 / CELL_SIZE)
+DcbTrafficControl::Buffer::Buffer ()
+    : m_totalCells (32 * 1024 * 1024 / CELL_SIZE),
+      m_remainCells (m_totalCells),
+      m_sharedEnabled (false),
+      m_sharedCells (0),
+      m_sharedUsedCells (0),
+      m_reserveCells (0),
+      m_headroomCells (0),
+      m_xonOffsetCells (0),
+      m_pfcAlpha (1.)
 {
 }
 
@@ -234,7 +560,8 @@ DcbTrafficControl::Buffer::SetBufferSpace (uint32_t bytes)
 {
   NS_LOG_FUNCTION (this << bytes);
 
-  m_remainCells = CalcCellSize (bytes);
+  m_totalCells = CalcCellSize (bytes);
+  m_remainCells = m_totalCells;
 }
 
 void
@@ -245,11 +572,94 @@ DcbTrafficControl::Buffer::RegisterPortNumber (const uint32_t num)
   m_ports.resize (num);
 }
 
+void
+DcbTrafficControl::Buffer::ConfigShared (const DcbSharedBufferConfig &config)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_reserveCells = CalcCellSize (config.reserve);
+  m_headroomCells = CalcCellSize (config.headroom);
+  m_xonOffsetCells = CalcCellSize (config.xonOffset);
+  m_pfcAlpha = config.pfcAlpha;
+  if (m_pfcAlpha <= 0.)
+    {
+      NS_FATAL_ERROR ("Shared buffer alpha should be positive, not " << m_pfcAlpha);
+    }
+  uint64_t dedicated = 0;
+  for (const PortInfo &port : m_ports)
+    {
+      dedicated += static_cast<uint64_t> (PRIORITY_NUMBER) *
+                   (m_reserveCells + (port.FcEnabled () ? m_headroomCells : 0));
+    }
+  if (dedicated >= m_totalCells)
+    {
+      NS_FATAL_ERROR ("Reserved space and headroom of all queues (" << dedicated * CELL_SIZE
+                      << " bytes) leave no shared buffer out of " << m_totalCells * CELL_SIZE
+                      << " bytes");
+    }
+  m_sharedCells = m_totalCells - dedicated;
+  m_sharedUsedCells = 0;
+  m_sharedEnabled = true;
+}
+
+uint32_t
+DcbTrafficControl::Buffer::GetSharedFreeCells () const
+{
+  return m_sharedEnabled ? m_sharedCells - m_sharedUsedCells : m_remainCells;
+}
+
+bool
+DcbTrafficControl::Buffer::CheckXoff (uint32_t port, uint8_t priority) const
+{
+  const PortInfo &p = m_ports[port];
+  return p.GetHeadroomCells (priority) > 0 || p.GetSharedCells (priority) >= GetXoffThreshold ();
+}
+
+bool
+DcbTrafficControl::Buffer::CheckXon (uint32_t port, uint8_t priority) const
+{
+  const PortInfo &p = m_ports[port];
+  return p.GetHeadroomCells (priority) == 0 &&
+         p.GetSharedCells (priority) + m_xonOffsetCells <= GetXoffThreshold ();
+}
+
 bool
 DcbTrafficControl::Buffer::InPacketProcess (uint32_t portIndex, uint8_t priority,
                                             uint32_t packetSize)
 {
   uint32_t packetCells = CalcCellSize (packetSize);
+  if (m_sharedEnabled)
+    {
+      PortInfo &port = m_ports[portIndex];
+      const uint32_t shared = port.GetSharedCells (priority);
+      const uint32_t headroom = port.GetHeadroomCells (priority);
+      // a queue already in its headroom stays there until it drains
+      if (headroom == 0)
+        {
+          const uint32_t reserved = port.GetQueueLength (priority) - shared;
+          if (reserved + packetCells <= m_reserveCells)
+            {
+              IncrementIngressQueueCounter (portIndex, priority, packetCells);
+              return true;
+            }
+          if (shared + packetCells <= GetXoffThreshold () &&
+              m_sharedUsedCells + packetCells <= m_sharedCells)
+            {
+              m_sharedUsedCells += packetCells;
+              port.IncreSharedCells (priority, packetCells);
+              IncrementIngressQueueCounter (portIndex, priority, packetCells);
+              return true;
+            }
+        }
+      if (port.FcEnabled () && headroom + packetCells <= m_headroomCells)
+        {
+          port.IncreHeadroomCells (priority, packetCells);
+          IncrementIngressQueueCounter (portIndex, priority, packetCells);
+          return true;
+        }
+      NS_LOG_DEBUG ("Shared buffer threshold exceeded, packet drop.");
+      return false;
+    }
   if (m_remainCells > packetCells)
     {
       m_remainCells -= packetCells;
@@ -265,6 +675,18 @@ DcbTrafficControl::Buffer::OutPacketProcess (uint32_t portIndex, uint8_t priorit
                                              uint32_t packetSize)
 {
   uint32_t packetCells = CalcCellSize (packetSize);
+  if (m_sharedEnabled)
+    {
+      // release the headroom first, then the shared space, then the reserved space
+      PortInfo &port = m_ports[portIndex];
+      const uint32_t headroom = std::min (port.GetHeadroomCells (priority), packetCells);
+      port.IncreHeadroomCells (priority, -headroom);
+      const uint32_t shared = std::min (port.GetSharedCells (priority), packetCells - headroom);
+      port.IncreSharedCells (priority, -shared);
+      m_sharedUsedCells -= shared;
+      DecrementIngressQueueCounter (portIndex, priority, packetCells);
+      return;
+    }
   m_remainCells += packetCells;
   DecrementIngressQueueCounter (portIndex, priority, packetCells);
 }
@@ -304,116 +726,4 @@ DcbTrafficControl::Buffer::CalcCellSize (uint32_t bytes)
   return static_cast<uint32_t> (ceil (bytes / CELL_SIZE));
 }
 
-/** Tags implementation **/
-
-DeviceIndexTag::DeviceIndexTag (uint32_t index) : m_index (index)
-{
-}
-
-void
-DeviceIndexTag::SetIndex (uint32_t index)
-{
-  m_index = index;
-}
-
-uint32_t
-DeviceIndexTag::GetIndex () const
-{
-  return m_index;
-}
-
-TypeId
-DeviceIndexTag::GetTypeId ()
-{
-  static TypeId tid = TypeId ("ns3::DevIndexTag")
-                          .SetParent<Tag> ()
-                          .SetGroupName ("Dcb")
-                          .AddConstructor<DeviceIndexTag> ();
-  return tid;
-}
-
-TypeId
-DeviceIndexTag::GetInstanceTypeId () const
-{
-  return GetTypeId ();
-}
-
-uint32_t
-DeviceIndexTag::GetSerializedSize () const
-{
-  return sizeof (uint32_t);
-}
-
-void
-DeviceIndexTag::Serialize (TagBuffer i) const
-{
-  i.WriteU32 (m_index);
-}
-
-void
-DeviceIndexTag::Deserialize (TagBuffer i)
-{
-  m_index = i.ReadU32 ();
-}
-
-void
-DeviceIndexTag::Print (std::ostream &os) const
-{
-  os << "Device = " << m_index;
-}
-
-CoSTag::CoSTag (uint8_t cos) : m_cos (cos)
-{
-}
-
-void
-CoSTag::SetCoS (uint8_t cos)
-{
-  m_cos = cos;
-}
-
-uint8_t
-CoSTag::GetCoS () const
-{
-  return m_cos;
-}
-
-TypeId
-CoSTag::GetTypeId ()
-{
-  static TypeId tid =
-      TypeId ("ns3::CoSTag").SetParent<Tag> ().SetGroupName ("Dcb").AddConstructor<CoSTag> ();
-  return tid;
-}
-
-TypeId
-CoSTag::GetInstanceTypeId () const
-{
-  return GetTypeId ();
-}
-
-uint32_t
-CoSTag::GetSerializedSize () const
-{
-  return sizeof (uint8_t);
-}
-
-void
-CoSTag::Serialize (TagBuffer i) const
-{
-  i.WriteU8 (m_cos);
-}
-
-void
-CoSTag::Deserialize (TagBuffer i)
-{
-  m_cos = i.ReadU8 ();
-}
-
-void
-CoSTag::Print (std::ostream &os) const
-{
-  os << "Device = " << m_cos;
-}
-
 } // namespace ns3
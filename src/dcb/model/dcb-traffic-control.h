@@ -25,10 +25,14 @@
 #include "dcb-net-device.h"
 #include "ns3/drop-tail-queue.h"
 #include "ns3/net-device.h"
-#include "ns3/tag-buffer.h"
 #include "ns3/pfc-frame.h"
 #include "ns3/traffic-control-layer.h"
+#include "ns3/ipv4-global-routing.h"
 #include "ns3/ipv4-queue-disc-item.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/nstime.h"
+#include "ns3/random-variable-stream.h"
+#include <unordered_map>
 #include <vector>
 
 namespace ns3 {
@@ -38,6 +42,17 @@ class QueueDisc;
 class NetDeviceQueueInterface;
 class DcbFlowControlPort;
 
+/**
+ * \brief Configuration of the shared-buffer MMU of DcbTrafficControl, sizes in bytes.
+ */
+struct DcbSharedBufferConfig
+{
+  uint32_t reserve = 0; //!< reserved space of each ingress queue
+  uint32_t headroom = 0; //!< headroom of each ingress queue of a port with flow control
+  double pfcAlpha = 1.; //!< alpha of the dynamic XOFF threshold
+  uint32_t xonOffset = 0; //!< how far below the XOFF threshold a paused queue resumes
+}; // struct DcbSharedBufferConfig
+
 /**
  * \defgroup dcb
  *
@@ -117,6 +132,16 @@ public:
   DcbTrafficControl (DcbTrafficControl const &) = delete;
   DcbTrafficControl &operator= (DcbTrafficControl const &) = delete;
 
+  /**
+   * \brief How the fast path picks one of the equal-cost egress ports.
+   */
+  enum LoadBalancing {
+    ECMP, //!< per-flow hash of the 5-tuple, or of the QPs for RoCEv2
+    PACKET_SPRAY, //!< a random port for every packet
+    FLOWLET, //!< a random port for every flowlet, like LetFlow
+    CONGESTION_AWARE, //!< the port with the least queued bytes for every flowlet
+  };
+
   using TrafficControlLayer::SetRootQueueDiscOnDevice;
   virtual void SetRootQueueDiscOnDevice (Ptr<DcbNetDevice> device, Ptr<PausableQueueDisc> qDisc);
 
@@ -127,6 +152,47 @@ public:
 
   void SetBufferSize (uint32_t bytes);
 
+  /**
+   * \brief Use a shared-buffer MMU with dynamic thresholds instead of one
+   * buffer where any queue may grow until it is full.
+   *
+   * Every ingress queue first uses its reserved space, then the pool shared by
+   * all queues as long as its shared occupancy stays below
+   * alpha * (free shared space), the dynamic threshold of Broadcom switches.
+   * A queue beyond its threshold is over PFC XOFF and, if its port has flow
+   * control, takes further packets into its headroom while the pause reaches
+   * the upstream.  A paused queue resumes when its headroom is drained and its
+   * shared occupancy is xonOffset below the threshold.  All the accounting is
+   * a few counters per packet.
+   *
+   * The shared pool is what remains of the buffer after the reserved space of
+   * all queues and the headroom of the queues of ports with flow control, so
+   * call it after SetBufferSize and after flow control is installed to the ports.
+   *
+   * \param config the sizes of the MMU
+   */
+  void ConfigSharedBuffer (const DcbSharedBufferConfig &config);
+
+  bool IsSharedBufferEnabled () const;
+
+  /**
+   * \return the free space of the shared pool in bytes, or of the whole buffer
+   * if the shared buffer is not enabled
+   */
+  uint32_t GetSharedBufferFreeBytes () const;
+
+  /**
+   * \brief Whether an ingress queue is beyond its dynamic PFC XOFF threshold.
+   * Only meaningful when the shared buffer is enabled.
+   */
+  bool CheckIngressXoff (uint32_t port, uint8_t priority) const;
+
+  /**
+   * \brief Whether a paused ingress queue is back below its PFC XON threshold.
+   * Only meaningful when the shared buffer is enabled.
+   */
+  bool CheckIngressXon (uint32_t port, uint8_t priority) const;
+
   /**
    * \brief Called by NetDevices, incoming packet
    *
@@ -154,6 +220,27 @@ public:
 
   void InstallFCToPort (uint32_t portIdx, Ptr<DcbFlowControlPort> fc);
 
+  /**
+   * \brief Build the forwarding table of the switching fast path.
+   *
+   * Copy the host routes of the node's Ipv4GlobalRouting into a table indexed
+   * by destination address, so that Receive can forward a packet itself:
+   * parse the IPv4 header once, pick the egress port, decrement the TTL and
+   * enqueue to the PausableQueueDisc.  ECN is still marked by the queue disc
+   * on the Ipv4QueueDiscItem header.  Packets without a host route or with an
+   * expiring TTL go through Ipv4L3Protocol as before.
+   *
+   * The egress port follows the RandomEcmpRouting attribute of the
+   * Ipv4GlobalRouting: the first route without ECMP, a random one with
+   * per-packet ECMP, and the LoadBalancing attribute with per-flow ECMP.  The
+   * table is a vector if the addresses are dense, else a hash map.
+   *
+   * Must be called after the global routes are populated, and again if they
+   * are recomputed.  Ipv4L3Protocol traces (Rx, Tx, UnicastForward) are not
+   * fired for fast-forwarded packets.
+   */
+  void BuildForwardingTable ();
+
   static uint8_t PeekPriorityOfPacket (const Ptr<const Packet> packet);
   constexpr static const uint8_t PRIORITY_NUMBER = 8;
 
@@ -187,6 +274,32 @@ public:
       m_ingressQueueLength[priority] += val;
     }
 
+    /// Cells of the ingress queue in the shared pool
+    inline uint32_t
+    GetSharedCells (uint32_t priority) const
+    {
+      return m_ingressSharedCells[priority];
+    }
+
+    inline void
+    IncreSharedCells (uint32_t priority, int32_t val)
+    {
+      m_ingressSharedCells[priority] += val;
+    }
+
+    /// Cells of the ingress queue in its headroom
+    inline uint32_t
+    GetHeadroomCells (uint32_t priority) const
+    {
+      return m_ingressHeadroomCells[priority];
+    }
+
+    inline void
+    IncreHeadroomCells (uint32_t priority, int32_t val)
+    {
+      m_ingressHeadroomCells[priority] += val;
+    }
+
     inline void
     SetFC (Ptr<DcbFlowControlPort> fc)
     {
@@ -208,18 +321,74 @@ public:
 
   private:
     uint32_t m_ingressQueueLength[PRIORITY_NUMBER];
+    uint32_t m_ingressSharedCells[PRIORITY_NUMBER];
+    uint32_t m_ingressHeadroomCells[PRIORITY_NUMBER];
     bool m_fcEnabled;
     Ptr<DcbFlowControlPort> m_fc;
     std::vector<std::pair<uint32_t, FCPacketOutCb>> m_fcPacketOutPipeline;
   }; // class PortInfo
 
+protected:
+  virtual void DoDispose (void) override;
+
 private:
+  /**
+   * \brief Forward an IPv4 packet through the forwarding table.
+   * \param header the IPv4 header peeked from the packet
+   * \param packet the packet, starting with the IPv4 header
+   * \return false if the packet should go through Ipv4L3Protocol instead
+   */
+  bool FastForward (const Ipv4Header &header, Ptr<const Packet> packet);
+
+  /**
+   * \return the egress devices of a destination in the forwarding table, or
+   * nullptr if it has no host route
+   */
+  const std::vector<Ptr<NetDevice>> *LookupFib (Ipv4Address destination) const;
+
+  /**
+   * \brief Per-flow ECMP hash, the same as Ipv4GlobalRouting::UdpEcmp computes.
+   * \param header the IPv4 header
+   * \param payload the packet without IPv4 header
+   */
+  static uint32_t EcmpHash (const Ipv4Header &header, Ptr<const Packet> payload);
+
+  /**
+   * \brief Pick the port of the current flowlet of a flow, or a new port if
+   * the flow has been idle for longer than the flowlet gap.
+   * \param flowHash the ECMP hash of the flow
+   * \param ports the equal-cost egress devices
+   * \return the index of the port in ports
+   */
+  uint32_t SelectFlowletPort (uint32_t flowHash, const std::vector<Ptr<NetDevice>> &ports);
+
+  /**
+   * \return the index in ports of the device with the least bytes queued in
+   * its PausableQueueDisc, ties broken at random
+   */
+  uint32_t SelectLeastCongestedPort (const std::vector<Ptr<NetDevice>> &ports);
+
+  /// The port chosen for the last flowlet of the flows hashed to an entry
+  struct Flowlet
+  {
+    Time lastSeen; //!< when the last packet of the flowlet arrived
+    uint32_t port; //!< index in the equal-cost ports, invalid if out of range
+  };
 
   class Buffer {
   public:
     Buffer ();
     void SetBufferSpace (uint32_t bytes);
     void RegisterPortNumber (const uint32_t num);
+    void ConfigShared (const DcbSharedBufferConfig &config);
+    inline bool
+    IsSharedEnabled () const
+    {
+      return m_sharedEnabled;
+    }
+    uint32_t GetSharedFreeCells () const;
+    bool CheckXoff (uint32_t port, uint8_t priority) const;
+    bool CheckXon (uint32_t port, uint8_t priority) const;
     /**
      * \brief Process when packet received.
      * Returns whether the packet is accomondated into the buffer, false for packet drop. 
@@ -243,74 +412,50 @@ private:
   private:
     
     static uint32_t CalcCellSize (uint32_t bytes);
+
+    /// The dynamic threshold of the shared occupancy of one queue
+    inline uint32_t
+    GetXoffThreshold () const
+    {
+      return static_cast<uint32_t> (m_pfcAlpha * (m_sharedCells - m_sharedUsedCells));
+    }
+
+    uint32_t m_totalCells;
     uint32_t m_remainCells;
     std::vector<PortInfo> m_ports;
+
+    bool m_sharedEnabled; //!< whether the shared-buffer MMU is used
+    uint32_t m_sharedCells; //!< size of the shared pool
+    uint32_t m_sharedUsedCells; //!< occupancy of the shared pool
+    uint32_t m_reserveCells; //!< reserved space of each ingress queue
+    uint32_t m_headroomCells; //!< headroom of each ingress queue of ports with flow control
+    uint32_t m_xonOffsetCells;
+    double m_pfcAlpha;
   }; // class Buffer
   
   Buffer m_buffer;
 
+  bool m_fastForwarding; //!< whether to forward IPv4 packets without Ipv4L3Protocol
+  bool m_calcChecksum; //!< whether IPv4 checksums are enabled, read when building the table
+  uint32_t m_fibBase; //!< the smallest destination address in the forwarding table
+  /// The egress devices of each destination, indexed by the address minus m_fibBase
+  std::vector<std::vector<Ptr<NetDevice>>> m_fib;
+  /// The egress devices of each destination by address, used instead of m_fib if it is sparse
+  std::unordered_map<uint32_t, std::vector<Ptr<NetDevice>>> m_fibMap;
+  Ipv4GlobalRouting::EcmpMode m_ecmpMode; //!< RandomEcmpRouting of the node's global routing
+  /// The queue discs of the devices, indexed by device index
+  std::vector<Ptr<PausableQueueDisc>> m_portQueues;
+
+  LoadBalancing m_loadBalancing; //!< how the fast path spreads packets over equal-cost ports
+  Time m_flowletGap; //!< idle time of a flow that starts a new flowlet
+  uint32_t m_flowletTableSize; //!< number of entries of the flowlet table
+  /// The flowlet table indexed by flow hash; flows colliding on an entry share a flowlet
+  std::vector<Flowlet> m_flowlets;
+  Ptr<UniformRandomVariable> m_rand; //!< picks ports for spraying and new flowlets
+
   TracedCallback<Ptr<const Packet> > m_bufferOverflowTrace;
 };
 
-class DeviceIndexTag : public Tag
-{
-public:
-  DeviceIndexTag () = default;
-
-  explicit DeviceIndexTag (uint32_t index);
-
-  void SetIndex (uint32_t index);
-
-  uint32_t GetIndex () const;
-
-  static TypeId GetTypeId (void);
-
-  virtual TypeId GetInstanceTypeId (void) const override;
-
-  virtual uint32_t GetSerializedSize () const override;
-
-  virtual void Serialize (TagBuffer i) const override;
-
-  virtual void Deserialize (TagBuffer i) override;
-
-  virtual void Print (std::ostream &os) const override;
-
-private:
-  uint32_t m_index; //!< the device index carried by the tag
-
-}; // class DevIndexTag
-
-/**
-  * \brief Class of Service (priority) tag for PFC priority.
-  */
-class CoSTag : public Tag
-{
-public:
-  CoSTag () = default;
-
-  explicit CoSTag (uint8_t cos);
-
-  void SetCoS (uint8_t cos);
-
-  uint8_t GetCoS () const;
-
-  static TypeId GetTypeId (void);
-
-  virtual TypeId GetInstanceTypeId (void) const override;
-
-  virtual uint32_t GetSerializedSize () const override;
-
-  virtual void Serialize (TagBuffer i) const override;
-
-  virtual void Deserialize (TagBuffer i) override;
-
-  virtual void Print (std::ostream &os) const override;
-
-private:
-  uint8_t m_cos; //!< the Class-of-Service carried by the tag
-
-}; // class CoSTag
-
 } // namespace ns3
 
 #endif // DCB_TRAFFIC_CONTROL_H
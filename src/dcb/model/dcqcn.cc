@@ -19,9 +19,11 @@
  */
 
 #include "dcqcn.h"
+#include "ns3/boolean.h"
 #include "ns3/rocev2-header.h"
 #include "ns3/simulator.h"
 #include "rocev2-socket.h"
+#include <cmath>
 
 namespace ns3 {
 
@@ -32,13 +34,22 @@ NS_OBJECT_ENSURE_REGISTERED (DcqcnCongestionOps);
 TypeId
 DcqcnCongestionOps::GetTypeId ()
 {
-  static TypeId tid = TypeId ("ns3::DcqcnCongestionOps").SetParent<Object> ().SetGroupName ("Dcb");
+  static TypeId tid =
+      TypeId ("ns3::DcqcnCongestionOps")
+          .SetParent<RoCEv2CongestionOps> ()
+          .SetGroupName ("Dcb")
+          .AddConstructor<DcqcnCongestionOps> ()
+          .AddAttribute ("LazyTimers",
+                         "Compute the alpha and rate timers in closed form when the state is "
+                         "read instead of scheduling periodic events.",
+                         BooleanValue (false),
+                         MakeBooleanAccessor (&DcqcnCongestionOps::m_lazyTimers),
+                         MakeBooleanChecker ());
   return tid;
 }
 
-DcqcnCongestionOps::DcqcnCongestionOps (Ptr<RoCEv2SocketState> sockState)
-    : m_sockState (sockState),
-      m_alpha (1.), // larger alpha means more aggressive rate reduction
+DcqcnCongestionOps::DcqcnCongestionOps ()
+    : m_alpha (1.), // larger alpha means more aggressive rate reduction
       m_g (0.00390625), // 1 / 16.
       m_raiRatio (.5),
       m_hraiRatio (1.),
@@ -51,7 +62,10 @@ DcqcnCongestionOps::DcqcnCongestionOps (Ptr<RoCEv2SocketState> sockState)
       m_targetRateRatio (100.),
       m_curRateRatio (100.),
       m_CNPInterval (MicroSeconds (4)),
-      m_minRateRatio (1e-3)
+      m_minRateRatio (1e-3),
+      m_lazyTimers (false),
+      m_alphaTimerArmed (false),
+      m_rateTimerArmed (false)
 {
   NS_LOG_FUNCTION (this);
   m_alphaTimer.SetFunction (&DcqcnCongestionOps::UpdateAlpha, this);
@@ -68,14 +82,102 @@ DcqcnCongestionOps::~DcqcnCongestionOps ()
 void
 DcqcnCongestionOps::SetReady ()
 {
+  if (m_lazyTimers)
+    {
+      m_rateTimerArmed = true;
+      m_rateTimerNext = Simulator::Now () + m_rateTimer.GetDelay ();
+      return;
+    }
   m_rateTimer.Schedule ();
 }
 
+uint64_t
+DcqcnCongestionOps::CountLazyExpirations (Time &next, bool &running, const Time &period) const
+{
+  const Time now = Simulator::Now ();
+  if (!running || next > now)
+    {
+      return 0;
+    }
+  uint64_t n = (now - next).GetTimeStep () / period.GetTimeStep () + 1;
+  if (!m_stopTime.IsZero ())
+    {
+      // the k-th expiration (from 0) re-arms the timer only if it is before the stop time
+      const int64_t p = period.GetTimeStep ();
+      const uint64_t maxN =
+          next >= m_stopTime ? 1 : ((m_stopTime - next).GetTimeStep () + p - 1) / p + 1;
+      if (n >= maxN)
+        {
+          n = maxN;
+          running = false;
+        }
+    }
+  next += period * static_cast<int64_t> (n);
+  return n;
+}
+
+void
+DcqcnCongestionOps::Sync ()
+{
+  if (!m_lazyTimers)
+    {
+      return;
+    }
+  NS_LOG_FUNCTION (this);
+
+  // The two timers do not interact with each other between CNPs
+  const uint64_t alphaN =
+      CountLazyExpirations (m_alphaTimerNext, m_alphaTimerArmed, m_alphaTimer.GetDelay ());
+  if (alphaN)
+    {
+      m_alpha *= std::pow (1 - m_g, static_cast<double> (alphaN));
+    }
+
+  uint64_t rateN =
+      CountLazyExpirations (m_rateTimerNext, m_rateTimerArmed, m_rateTimer.GetDelay ());
+  for (; rateN > 0; rateN--)
+    {
+      if (m_targetRateRatio == 100. && m_curRateRatio == 100.)
+        { // line rate reached, the remaining updates only count the iterations
+          m_rateUpdateIter += rateN;
+          break;
+        }
+      m_rateUpdateIter++;
+      UpdateRate ();
+    }
+}
+
+void
+DcqcnCongestionOps::Stop ()
+{
+  NS_LOG_FUNCTION (this);
+  m_alphaTimer.Cancel ();
+  m_rateTimer.Cancel ();
+  m_alphaTimerArmed = false;
+  m_rateTimerArmed = false;
+}
+
+void
+DcqcnCongestionOps::Reset ()
+{
+  NS_LOG_FUNCTION (this);
+  Stop ();
+  m_alpha = 1.;
+  m_bytesCounter = 0;
+  m_rateUpdateIter = 0;
+  m_bytesUpdateIter = 0;
+  m_targetRateRatio = 100.;
+  m_curRateRatio = 100.;
+  m_sockState->SetRateRatioPercent (m_curRateRatio);
+  SetReady ();
+}
+
 void
 DcqcnCongestionOps::UpdateStateSend (Ptr<Packet> packet)
 {
   NS_LOG_FUNCTION (this << packet);
 
+  Sync ();
   m_bytesCounter += packet->GetSize ();
   if (m_bytesCounter >= m_bytesThreshold)
     {
@@ -90,18 +192,33 @@ DcqcnCongestionOps::UpdateStateWithCNP ()
 {
   NS_LOG_FUNCTION (this);
 
+  Sync ();
   m_targetRateRatio = m_curRateRatio;
   m_curRateRatio *= 1 - m_alpha / 2;
   m_curRateRatio = std::max (m_curRateRatio, m_minRateRatio);
   m_sockState->SetRateRatioPercent (m_curRateRatio);
   m_alpha = (1 - m_g) * m_alpha + m_g;
 
-  m_alphaTimer.Cancel (); // re-schedule timer
-  if (m_stopTime.GetNanoSeconds() == 0 || Simulator::Now () < m_stopTime)
+  if (m_lazyTimers)
     {
-      m_alphaTimer.Schedule ();
-      m_rateTimer.Cancel (); // re-schedule timer
-      m_rateTimer.Schedule ();
+      m_alphaTimerArmed = false;
+      if (m_stopTime.GetNanoSeconds () == 0 || Simulator::Now () < m_stopTime)
+        {
+          m_alphaTimerArmed = true;
+          m_alphaTimerNext = Simulator::Now () + m_alphaTimer.GetDelay ();
+          m_rateTimerArmed = true;
+          m_rateTimerNext = Simulator::Now () + m_rateTimer.GetDelay ();
+        }
+    }
+  else
+    {
+      m_alphaTimer.Cancel (); // re-schedule timer
+      if (m_stopTime.GetNanoSeconds () == 0 || Simulator::Now () < m_stopTime)
+        {
+          m_alphaTimer.Schedule ();
+          m_rateTimer.Cancel (); // re-schedule timer
+          m_rateTimer.Schedule ();
+        }
     }
   m_bytesCounter = 0;
   m_rateUpdateIter = 0;
@@ -172,16 +289,16 @@ DcqcnCongestionOps::SetRateHyperAIRatio (double ratio)
   m_hraiRatio = ratio * 100.;
 }
 
-void
-DcqcnCongestionOps::SetStopTime (Time stopTime)
-{
-  m_stopTime = stopTime;
-}
-
 Time
 DcqcnCongestionOps::GetCNPInterval () const
 {
   return m_CNPInterval;
 }
 
+double
+DcqcnCongestionOps::GetAlpha () const
+{
+  return m_alpha;
+}
+
 } // namespace ns3
@@ -21,21 +21,24 @@
 #ifndef DCQCN_H
 #define DCQCN_H
 
-#include "ns3/data-rate.h"
-#include "ns3/object.h"
-#include "ns3/packet.h"
+#include "rocev2-congestion-ops.h"
 #include "ns3/timer.h"
 
 namespace ns3 {
 
-class RoCEv2SocketState;
-
 /**
  * The DCQCN implementation according to paper:
  *   Zhu, Yibo, et al. "Congestion control for large-scale RDMA deployments." ACM SIGCOMM.
  *   \url https://dl.acm.org/doi/abs/10.1145/2829988.2787484
+ *
+ * By default the alpha timer and the rate timer are real simulator events.
+ * With the attribute LazyTimers set, no event is scheduled at all: the
+ * periods elapsed since the last update are counted and applied in Sync (),
+ * which is called whenever the sender is about to read the rate or a CNP
+ * arrives. The rate trajectory is the same as with real timers, except for
+ * the rounding of the alpha decay that is computed with std::pow.
  */
-class DcqcnCongestionOps : public Object
+class DcqcnCongestionOps : public RoCEv2CongestionOps
 {
 public:
 
@@ -46,7 +49,7 @@ public:
    */
   static TypeId GetTypeId (void);
   
-  DcqcnCongestionOps (Ptr<RoCEv2SocketState> sockState);
+  DcqcnCongestionOps ();
   ~DcqcnCongestionOps ();
   
   void SetRateAIRatio (double ratio);
@@ -55,21 +58,41 @@ public:
   /**
    * After configuring the DCQCN, call this function to start the timer.
    */
-  void SetReady ();
+  void SetReady () override;
+
+  /**
+   * In lazy-timer mode, apply the timer expirations that happened since the
+   * last call. Call it before reading the rate. No-op with real timers.
+   */
+  void Sync () override;
+
+  /**
+   * Cancel the timers, e.g., when the socket is closed.
+   */
+  void Stop () override;
+
+  /**
+   * Restore the initial state and restart the timer so that a recycled
+   * socket starts a new flow at line rate.
+   */
+  void Reset () override;
 
   /**
    * Update socket state when receiving a CNP.
    */
-  void UpdateStateWithCNP ();
+  void UpdateStateWithCNP () override;
 
   /**
    * When the sender sending out a packet, update the state if needed.
    */
-  void UpdateStateSend (Ptr<Packet> packet);
+  void UpdateStateSend (Ptr<Packet> packet) override;
 
-  void SetStopTime (Time stopTime);
+  Time GetCNPInterval () const override;
 
-  Time GetCNPInterval () const;
+  /**
+   * \return the alpha, i.e., the estimation of the congestion
+   */
+  double GetAlpha () const;
   
 private:
 
@@ -79,7 +102,17 @@ private:
 
   void UpdateRate ();
 
-  const Ptr<RoCEv2SocketState> m_sockState;
+  /**
+   * Count the expirations of a lazy timer up to now and move it forward.
+   * Like the real timers, a lazy timer is not re-armed after it expires at
+   * or after the stop time.
+   * \param next time of the next expiration, updated
+   * \param running whether the timer is armed, updated
+   * \param period the timer period
+   * \return number of expirations
+   */
+  uint64_t CountLazyExpirations (Time &next, bool &running, const Time &period) const;
+
   double m_alpha;
   const double m_g;
   double m_raiRatio; //!< RateAI / link rate for additive increase
@@ -95,7 +128,12 @@ private:
   double m_curRateRatio;
   Time m_CNPInterval;
   double m_minRateRatio;
-  Time m_stopTime;
+
+  bool m_lazyTimers; //!< compute timer effects lazily instead of scheduling events
+  bool m_alphaTimerArmed; //!< lazy counterpart of m_alphaTimer.IsRunning ()
+  bool m_rateTimerArmed; //!< lazy counterpart of m_rateTimer.IsRunning ()
+  Time m_alphaTimerNext; //!< next expiration of the lazy alpha timer
+  Time m_rateTimerNext; //!< next expiration of the lazy rate timer
   
 }; // class DcqcnCongestionOps
 
@@ -41,7 +41,7 @@ FifoQueueDiscEcn::GetTypeId ()
 }
 
 FifoQueueDiscEcn::FifoQueueDiscEcn ()
-    : m_ecnKMin (UINT32_MAX - 1), m_ecnKMax (UINT32_MAX), m_ecnPMax (0.)
+    : m_ecnKMin (UINT32_MAX - 1), m_ecnKMax (UINT32_MAX), m_ecnPMax (0.), m_ecnAlpha (0.)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -103,23 +103,47 @@ FifoQueueDiscEcn::ConfigECN (uint32_t kmin, uint32_t kmax, double pmax)
   m_rng->SetAttribute ("Max", DoubleValue (1.0));
 }
 
+void
+FifoQueueDiscEcn::ConfigDynamicEcn (double alpha, Callback<uint32_t> freeBytes)
+{
+  NS_LOG_FUNCTION (this << alpha);
+
+  if (alpha <= 0.)
+    {
+      NS_FATAL_ERROR ("ECN alpha should be positive");
+    }
+  m_ecnAlpha = alpha;
+  m_freeBytes = freeBytes;
+}
+
 bool
 FifoQueueDiscEcn::CheckShouldMarkECN (Ptr<Ipv4QueueDiscItem> item) const
 {
   NS_LOG_FUNCTION (this << item);
   uint32_t nbytes = GetNBytes () + item->GetPacket ()->GetSize ();
-  if (nbytes <= m_ecnKMin)
+  double kMin = m_ecnKMin;
+  double kMax = m_ecnKMax;
+  if (!m_freeBytes.IsNull ())
+    {
+      double cap = m_ecnAlpha * m_freeBytes ();
+      if (cap < kMax)
+        {
+          kMin *= cap / kMax;
+          kMax = cap;
+        }
+    }
+  if (nbytes <= kMin)
     {
       return false;
     }
-  else if (nbytes >= m_ecnKMax)
+  else if (nbytes >= kMax)
     {
       return true;
     }
   else
     { // mark ECN with probability
       // multiplied by 1024 to improve precision
-      double prob = m_ecnPMax * 1024 * (nbytes - m_ecnKMin) / (m_ecnKMax - m_ecnKMin);
+      double prob = m_ecnPMax * 1024 * (nbytes - kMin) / (kMax - kMin);
       return m_rng->GetValue () * 1024 < prob;
     }
 }
@@ -54,6 +54,13 @@ public:
   
   void ConfigECN (uint32_t kmin, uint32_t kmax, double pmax);
 
+  /**
+   * \brief Cap the ECN thresholds to a share of the free shared buffer.
+   * KMin and KMax are scaled down together whenever KMax is above alpha times
+   * the free bytes given by the callback.
+   */
+  void ConfigDynamicEcn (double alpha, Callback<uint32_t> freeBytes);
+
 private:
   virtual bool DoEnqueue (Ptr<QueueDiscItem> item) override;
   
@@ -62,6 +69,8 @@ private:
   uint32_t m_ecnKMin;
   uint32_t m_ecnKMax;
   double m_ecnPMax;
+  double m_ecnAlpha;
+  Callback<uint32_t> m_freeBytes; //!< free bytes of the shared buffer, null if not dynamic
   Ptr<UniformRandomVariable> m_rng;
   
 }; // class FifoQueueDiscEcn
@@ -0,0 +1,183 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#include "hpcc.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+#include "rocev2-socket.h"
+#include <algorithm>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("HpccCongestionOps");
+
+NS_OBJECT_ENSURE_REGISTERED (HpccCongestionOps);
+
+TypeId
+HpccCongestionOps::GetTypeId ()
+{
+  static TypeId tid =
+      TypeId ("ns3::HpccCongestionOps")
+          .SetParent<RoCEv2CongestionOps> ()
+          .SetGroupName ("Dcb")
+          .AddConstructor<HpccCongestionOps> ()
+          .AddAttribute ("BaseRtt", "The base RTT of the network, T of the paper",
+                         TimeValue (MicroSeconds (10)),
+                         MakeTimeAccessor (&HpccCongestionOps::m_baseRtt), MakeTimeChecker ())
+          .AddAttribute ("TargetUtilization", "The target utilization of the links, eta",
+                         DoubleValue (0.95), MakeDoubleAccessor (&HpccCongestionOps::m_eta),
+                         MakeDoubleChecker<double> (0., 1.))
+          .AddAttribute ("MaxStage", "Additive increase stages before a multiplicative update",
+                         UintegerValue (5), MakeUintegerAccessor (&HpccCongestionOps::m_maxStage),
+                         MakeUintegerChecker<uint32_t> ())
+          .AddAttribute ("RateAI", "The additive increase of the rate, W_AI / T",
+                         DataRateValue (DataRate ("50Mbps")),
+                         MakeDataRateAccessor (&HpccCongestionOps::m_rateAI),
+                         MakeDataRateChecker ());
+  return tid;
+}
+
+HpccCongestionOps::HpccCongestionOps ()
+    : m_eta (0.95), m_maxStage (5), m_window (0.), m_windowC (0.), m_u (1.), m_incStage (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+HpccCongestionOps::~HpccCongestionOps ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+HpccCongestionOps::SetReady ()
+{
+  NS_LOG_FUNCTION (this);
+  Reset ();
+}
+
+void
+HpccCongestionOps::Reset ()
+{
+  NS_LOG_FUNCTION (this);
+  // Start at line rate with a window of one BDP
+  m_windowC = m_lineRate.GetBitRate () * m_baseRtt.GetSeconds () / 8;
+  m_u = 1.;
+  m_incStage = 0;
+  m_hops.clear ();
+  ResetRounds ();
+  SetWindow (m_windowC);
+}
+
+bool
+HpccCongestionOps::RequiresInt () const
+{
+  return true;
+}
+
+void
+HpccCongestionOps::UpdateStateWithAck (const RoCEv2AckInfo &ack)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (ack.intHops == nullptr)
+    {
+      return;
+    }
+  const bool newRound = IsNewRound (ack);
+  if (m_hops.size () == ack.intHops->size ())
+    {
+      ComputeWindow (MeasureInflight (*ack.intHops), newRound);
+    }
+  // else the first ACK of the flow or the path changed, start measuring from here
+  m_hops = *ack.intHops;
+}
+
+double
+HpccCongestionOps::MeasureInflight (const std::vector<IntHop> &hops)
+{
+  const double T = m_baseRtt.GetSeconds ();
+  double u = 0.;
+  double tau = 0.;
+  for (size_t i = 0; i < hops.size (); i++)
+    {
+      const IntHop &hop = hops[i], &last = m_hops[i];
+      // the counters wrap around, so compare them by their differences
+      const uint32_t dts = hop.timestamp - last.timestamp;
+      if (dts == 0 || dts >= 0x80000000u)
+        {
+          continue; // no new sample of this hop
+        }
+      const double dt = dts * 1e-9;
+      const double txRate = static_cast<uint32_t> (hop.txBytes - last.txBytes) * 8. / dt;
+      const double B = hop.lineRate;
+      const double uHop = std::min (hop.qlen, last.qlen) * 8. / (B * T) + txRate / B;
+      if (uHop > u)
+        {
+          u = uHop;
+          tau = dt;
+        }
+    }
+  tau = std::min (tau, T);
+  m_u = (1 - tau / T) * m_u + tau / T * u;
+  return m_u;
+}
+
+void
+HpccCongestionOps::ComputeWindow (double u, bool updateWc)
+{
+  const double windowAI = m_rateAI.GetBitRate () * m_baseRtt.GetSeconds () / 8;
+  double window;
+  if (u >= m_eta || m_incStage >= m_maxStage)
+    {
+      window = m_windowC / (u / m_eta) + windowAI;
+      if (updateWc)
+        {
+          m_incStage = 0;
+        }
+    }
+  else
+    {
+      window = m_windowC + windowAI;
+      if (updateWc)
+        {
+          m_incStage++;
+        }
+    }
+  // The window never exceeds one BDP at line rate, nor drops below W_AI
+  const double maxWindow = m_lineRate.GetBitRate () * m_baseRtt.GetSeconds () / 8;
+  window = std::max (std::min (window, maxWindow), windowAI);
+  if (updateWc)
+    {
+      m_windowC = window;
+    }
+  SetWindow (window);
+  NS_LOG_DEBUG ("HPCC: U " << u << " window " << window << " bytes at time "
+                           << Simulator::Now ().GetMicroSeconds () << "us");
+}
+
+void
+HpccCongestionOps::SetWindow (double window)
+{
+  m_window = window;
+  m_sockState->SetWindow (static_cast<uint32_t> (window));
+  SetRate (DataRate (static_cast<uint64_t> (window * 8 / m_baseRtt.GetSeconds ())));
+}
+
+} // namespace ns3
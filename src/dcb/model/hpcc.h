@@ -0,0 +1,82 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#ifndef HPCC_H
+#define HPCC_H
+
+#include "rocev2-congestion-ops.h"
+
+namespace ns3 {
+
+/**
+ * The HPCC implementation according to paper:
+ *   Li, Yuliang, et al. "HPCC: High precision congestion control." ACM SIGCOMM.
+ *   \url https://dl.acm.org/doi/10.1145/3341302.3342085
+ *
+ * The window is computed from the INT hops of the ACKs: the utilization of
+ * the most loaded hop is estimated from its queue and tx rate, and the window
+ * is scaled to bring it to the target utilization.  The sender is paced at
+ * window / BaseRtt.  The sockets add an IntTrailer to their packets for it,
+ * which is filled only by the switches with INT enabled; ACKs without INT hops
+ * leave the window unchanged.
+ */
+class HpccCongestionOps : public RoCEv2CongestionOps
+{
+public:
+  static TypeId GetTypeId (void);
+
+  HpccCongestionOps ();
+  ~HpccCongestionOps ();
+
+  void SetReady () override;
+
+  void Reset () override;
+
+  void UpdateStateWithAck (const RoCEv2AckInfo &ack) override;
+
+  bool RequiresInt () const override;
+
+private:
+  /**
+   * \return the normalized inflight bytes U, moved towards the utilization
+   * of the most loaded hop since the last ACK
+   */
+  double MeasureInflight (const std::vector<IntHop> &hops);
+
+  /**
+   * Compute the window from U, and update the reference window once per RTT.
+   */
+  void ComputeWindow (double u, bool updateWc);
+
+  void SetWindow (double window);
+
+  Time m_baseRtt; //!< T of the paper, the base RTT of the network
+  double m_eta; //!< target utilization
+  uint32_t m_maxStage; //!< additive increase stages before a multiplicative update
+  DataRate m_rateAI; //!< W_AI / T
+
+  double m_window; //!< W in bytes
+  double m_windowC; //!< the reference window Wc in bytes
+  double m_u; //!< the normalized inflight bytes U
+  uint32_t m_incStage;
+  std::vector<IntHop> m_hops; //!< the INT hops of the last ACK
+}; // class HpccCongestionOps
+
+} // namespace ns3
+
+#endif // HPCC_H
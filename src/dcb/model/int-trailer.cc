@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#include "int-trailer.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("IntTrailer");
+
+NS_OBJECT_ENSURE_REGISTERED (IntTrailer);
+
+TypeId
+IntTrailer::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::IntTrailer")
+                          .SetParent<Trailer> ()
+                          .SetGroupName ("Dcb")
+                          .AddConstructor<IntTrailer> ();
+  return tid;
+}
+
+TypeId
+IntTrailer::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+IntTrailer::IntTrailer ()
+{
+  m_hops.reserve (MAX_HOPS);
+}
+
+uint32_t
+IntTrailer::GetSerializedSize (void) const
+{
+  return 2 + MAX_HOPS * HOP_SIZE;
+}
+
+void
+IntTrailer::Serialize (Buffer::Iterator end) const
+{
+  Buffer::Iterator i = end;
+  i.Prev (GetSerializedSize ());
+  i.WriteU8 (m_hops.size ());
+  i.WriteU8 (0); // reserved
+  for (const IntHop &hop : m_hops)
+    {
+      i.WriteHtonU32 (hop.timestamp);
+      i.WriteHtonU32 (hop.txBytes);
+      i.WriteHtonU32 (hop.qlen);
+      i.WriteHtonU32 (hop.lineRate / 1000000); // in Mbps
+    }
+  i.WriteU8 (0, (MAX_HOPS - m_hops.size ()) * HOP_SIZE);
+}
+
+uint32_t
+IntTrailer::Deserialize (Buffer::Iterator end)
+{
+  Buffer::Iterator i = end;
+  i.Prev (GetSerializedSize ());
+  const uint8_t nHops = i.ReadU8 ();
+  NS_ASSERT_MSG (nHops <= MAX_HOPS, "INT trailer with " << +nHops << " hops");
+  i.ReadU8 ();
+  m_hops.resize (nHops);
+  for (IntHop &hop : m_hops)
+    {
+      hop.timestamp = i.ReadNtohU32 ();
+      hop.txBytes = i.ReadNtohU32 ();
+      hop.qlen = i.ReadNtohU32 ();
+      hop.lineRate = static_cast<uint64_t> (i.ReadNtohU32 ()) * 1000000;
+    }
+  return GetSerializedSize ();
+}
+
+void
+IntTrailer::Print (std::ostream &os) const
+{
+  os << "INT hops=" << m_hops.size ();
+  for (const IntHop &hop : m_hops)
+    {
+      os << " [ts=" << hop.timestamp << " txBytes=" << hop.txBytes << " qlen=" << hop.qlen
+         << " rate=" << hop.lineRate << "]";
+    }
+}
+
+bool
+IntTrailer::AddHop (const IntHop &hop)
+{
+  if (m_hops.size () == MAX_HOPS)
+    {
+      return false;
+    }
+  m_hops.push_back (hop);
+  return true;
+}
+
+const std::vector<IntHop> &
+IntTrailer::GetHops () const
+{
+  return m_hops;
+}
+
+} // namespace ns3
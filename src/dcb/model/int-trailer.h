@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#ifndef INT_TRAILER_H
+#define INT_TRAILER_H
+
+#include "ns3/trailer.h"
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \brief Telemetry of one hop of a data packet, written by a switch at egress.
+ *
+ * The counters are 32-bit on the wire and wrap around, so only the
+ * difference of two samples of the same hop is meaningful.
+ */
+struct IntHop
+{
+  uint32_t timestamp; //!< when the packet left the port, in nanoseconds
+  uint32_t txBytes; //!< bytes sent by the port so far
+  uint32_t qlen; //!< bytes queued at the port
+  uint64_t lineRate; //!< rate of the port in bps
+}; // struct IntHop
+
+/**
+ * \brief In-band network telemetry of the path of a RoCEv2 packet.
+ *
+ * A sender that wants the telemetry adds an empty trailer to its data packets
+ * and sets the IntPresent bit of the BTH.  Every switch port with INT enabled
+ * appends one IntHop when the packet leaves it, and the receiver copies the
+ * trailer into the ACK of the packet.
+ *
+ * The trailer has room for MAX_HOPS hops from the start, so that the IP and
+ * UDP lengths stay valid along the path, and sits at the end of the packet,
+ * so that a switch rewrites it without touching the headers before it.  The
+ * hops of a longer path are not recorded.
+ */
+class IntTrailer : public Trailer
+{
+public:
+  static constexpr uint32_t MAX_HOPS = 5;
+
+  static TypeId GetTypeId (void);
+  virtual TypeId GetInstanceTypeId (void) const override;
+
+  IntTrailer ();
+
+  virtual uint32_t GetSerializedSize (void) const override;
+  virtual void Serialize (Buffer::Iterator end) const override;
+  virtual uint32_t Deserialize (Buffer::Iterator end) override;
+  virtual void Print (std::ostream &os) const override;
+
+  /**
+   * \brief Record the telemetry of a hop.
+   * \return false if the trailer is full and the hop is not recorded
+   */
+  bool AddHop (const IntHop &hop);
+
+  const std::vector<IntHop> &GetHops () const;
+
+private:
+  static constexpr uint32_t HOP_SIZE = 16;
+
+  std::vector<IntHop> m_hops;
+}; // class IntTrailer
+
+} // namespace ns3
+
+#endif // INT_TRAILER_H
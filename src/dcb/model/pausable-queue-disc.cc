@@ -21,10 +21,13 @@
 #include "pausable-queue-disc.h"
 #include "dcb-traffic-control.h"
 #include "fifo-queue-disc-ecn.h"
+#include "int-trailer.h"
+#include "rocev2-l4-protocol.h"
 #include "ns3/assert.h"
 #include "ns3/boolean.h"
 #include "ns3/fatal-error.h"
 #include "ns3/integer.h"
+#include "ns3/ipv4-queue-disc-item.h"
 #include "ns3/log-macros-enabled.h"
 #include "ns3/log.h"
 #include "ns3/object-base.h"
@@ -33,9 +36,13 @@
 #include "ns3/queue-item.h"
 #include "ns3/queue-size.h"
 #include "ns3/random-variable-stream.h"
+#include "ns3/rocev2-header.h"
+#include "ns3/trace-source-accessor.h"
 #include "ns3/type-id.h"
+#include "ns3/udp-l4-protocol.h"
 #include "ns3/uinteger.h"
 #include "ns3/simulator.h"
+#include <algorithm>
 
 namespace ns3 {
 
@@ -43,6 +50,28 @@ NS_LOG_COMPONENT_DEFINE ("PausableQueueDisc");
 
 NS_OBJECT_ENSURE_REGISTERED (PausableQueueDisc);
 
+namespace {
+
+const uint32_t MAX_CLASSES = 32; //!< the width of the class bitmasks
+const uint32_t NO_CLASS = MAX_CLASSES;
+
+/// Index of the highest set bit of a mask that is not 0
+inline uint32_t
+HighestBit (uint32_t mask)
+{
+  return 31 - __builtin_clz (mask);
+}
+
+/// Index of the first set bit after `after`, wrapping around, of a mask that is not 0
+inline uint32_t
+NextBit (uint32_t mask, uint32_t after)
+{
+  uint32_t higher = after >= MAX_CLASSES - 1 ? 0 : mask & (~0u << (after + 1));
+  return __builtin_ctz (higher ? higher : mask);
+}
+
+} // namespace
+
 TypeId
 PausableQueueDisc::GetTypeId ()
 {
@@ -57,18 +86,59 @@ PausableQueueDisc::GetTypeId ()
           .AddAttribute ("TrafficControlCallback", "Callback when deque completed",
                          CallbackValue (MakeNullCallback<void, uint32_t, uint32_t, Ptr<Packet>> ()),
                          MakeCallbackAccessor (&PausableQueueDisc::m_tcEgress),
-                         MakeCallbackChecker ());
+                         MakeCallbackChecker ())
+          .AddAttribute ("EtsQuantum",
+                         "Bytes an ETS class may send per round for each unit of its weight",
+                         UintegerValue (1500),
+                         MakeUintegerAccessor (&PausableQueueDisc::m_etsQuantum),
+                         MakeUintegerChecker<uint32_t> (1))
+          .AddAttribute ("IntEnabled",
+                         "Append an INT hop to the RoCEv2 data packets that carry an INT trailer",
+                         BooleanValue (false),
+                         MakeBooleanAccessor (&PausableQueueDisc::m_intEnabled),
+                         MakeBooleanChecker ())
+          .AddTraceSource ("ClassBytesInQueue",
+                           "Bytes in the queue of a class, fired when it changes",
+                           MakeTraceSourceAccessor (&PausableQueueDisc::m_classBytesTrace),
+                           "ns3::PausableQueueDisc::ClassBytesTracedCallback")
+          .AddTraceSource ("Paused", "Whether a class is paused, fired when it changes",
+                           MakeTraceSourceAccessor (&PausableQueueDisc::m_pausedTrace),
+                           "ns3::PausableQueueDisc::PausedTracedCallback");
   return tid;
 }
 
 PausableQueueDisc::PausableQueueDisc ()
-    : m_fcEnabled (false), m_portIndex (0x7fffffff), m_queueSize ("1000p")
+    : m_fcEnabled (false), m_portIndex (0x7fffffff), m_queueSize ("1000p"),
+      m_backlogMask (0),
+      m_pausedMask (0),
+      m_pauseEnds (MAX_CLASSES, Time::Max ()),
+      m_pauseWakeupTime (Time::Max ()),
+      m_ignoredMask (0),
+      m_droppingMask (0),
+      m_strictMask (~0u),
+      m_etsWeights (MAX_CLASSES, 0),
+      m_etsQuantum (1500),
+      m_etsDeficits (MAX_CLASSES, 0),
+      m_etsCurrent (NO_CLASS),
+      m_intEnabled (false)
 {
   NS_LOG_FUNCTION (this);
 }
 
 PausableQueueDisc::PausableQueueDisc (uint32_t port)
-    : m_fcEnabled (false), m_portIndex (port), m_queueSize ("1000p")
+    : m_fcEnabled (false), m_portIndex (port), m_queueSize ("1000p"),
+      m_backlogMask (0),
+      m_pausedMask (0),
+      m_pauseEnds (MAX_CLASSES, Time::Max ()),
+      m_pauseWakeupTime (Time::Max ()),
+      m_ignoredMask (0),
+      m_droppingMask (0),
+      m_strictMask (~0u),
+      m_etsWeights (MAX_CLASSES, 0),
+      m_etsQuantum (1500),
+      m_etsDeficits (MAX_CLASSES, 0),
+      m_etsCurrent (NO_CLASS),
+      m_intEnabled (false)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -78,6 +148,15 @@ PausableQueueDisc::~PausableQueueDisc ()
   NS_LOG_FUNCTION (this);
 }
 
+void
+PausableQueueDisc::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_classQueues.clear ();
+  m_pauseWakeup.Cancel ();
+  QueueDisc::DoDispose ();
+}
+
 Ptr<PausableQueueDiscClass>
 PausableQueueDisc::GetQueueDiscClass (std::size_t i) const
 {
@@ -132,6 +211,139 @@ PausableQueueDisc::SetPaused (uint8_t priority, bool paused)
 {
   NS_LOG_FUNCTION (this);
   GetQueueDiscClass (priority)->SetPaused (paused);
+  const uint32_t oldMask = m_pausedMask;
+  if (paused)
+    {
+      m_pausedMask |= 1u << priority;
+    }
+  else
+    {
+      m_pausedMask &= ~(1u << priority);
+    }
+  if (oldMask != m_pausedMask)
+    {
+      m_pausedTrace (priority, paused);
+    }
+}
+
+bool
+PausableQueueDisc::IsPaused (uint8_t priority) const
+{
+  return m_pausedMask & (1u << priority);
+}
+
+void
+PausableQueueDisc::PauseUntil (uint8_t priority, Time end)
+{
+  NS_LOG_FUNCTION (this << (uint32_t) priority << end);
+  SetPaused (priority, true);
+  m_pauseEnds[priority] = end;
+  if (end < m_pauseWakeupTime)
+    {
+      // only a pause ending before all others moves the wakeup
+      m_pauseWakeup.Cancel ();
+      m_pauseWakeup =
+          Simulator::Schedule (end - Simulator::Now (), &PausableQueueDisc::PauseWakeup, this);
+      m_pauseWakeupTime = end;
+    }
+}
+
+void
+PausableQueueDisc::Resume (uint8_t priority)
+{
+  NS_LOG_FUNCTION (this << (uint32_t) priority);
+  // the wakeup of the pause is left to fire, which is cheaper than cancelling it
+  SetPaused (priority, false);
+  Run ();
+}
+
+Time
+PausableQueueDisc::ExpirePauses ()
+{
+  const Time now = Simulator::Now ();
+  Time earliest = Time::Max ();
+  for (uint32_t mask = m_pausedMask; mask != 0; mask &= mask - 1)
+    {
+      const uint32_t i = __builtin_ctz (mask);
+      if (m_pauseEnds[i] <= now)
+        {
+          SetPaused (i, false);
+        }
+      else
+        {
+          earliest = std::min (earliest, m_pauseEnds[i]);
+        }
+    }
+  return earliest;
+}
+
+void
+PausableQueueDisc::PauseWakeup ()
+{
+  NS_LOG_FUNCTION (this);
+  m_pauseWakeupTime = ExpirePauses ();
+  if (m_pauseWakeupTime != Time::Max ())
+    {
+      m_pauseWakeup = Simulator::Schedule (m_pauseWakeupTime - Simulator::Now (),
+                                           &PausableQueueDisc::PauseWakeup, this);
+    }
+  Run ();
+}
+
+void
+PausableQueueDisc::SetPfcIgnored (uint8_t priority, bool ignored)
+{
+  NS_LOG_FUNCTION (this << (uint32_t) priority << ignored);
+  if (ignored)
+    {
+      m_ignoredMask |= 1u << priority;
+      Run (); // the class may have packets waiting for the pause to end
+    }
+  else
+    {
+      m_ignoredMask &= ~(1u << priority);
+    }
+}
+
+void
+PausableQueueDisc::SetDropping (uint8_t priority, bool dropping)
+{
+  NS_LOG_FUNCTION (this << (uint32_t) priority << dropping);
+  if (!dropping)
+    {
+      m_droppingMask &= ~(1u << priority);
+      return;
+    }
+  m_droppingMask |= 1u << priority;
+  const Ptr<QueueDisc> &qdisc = m_classQueues[priority];
+  while (Ptr<QueueDiscItem> item = qdisc->Dequeue ())
+    {
+      if (!m_tcEgress.IsNull ())
+        {
+          m_tcEgress (m_portIndex, priority, item->GetPacket ());
+        }
+      DropAfterDequeue (item, PFC_WATCHDOG_DROP);
+    }
+  m_backlogMask &= ~(1u << priority);
+  m_etsDeficits[priority] = 0;
+  m_classBytesTrace (priority, 0);
+}
+
+void
+PausableQueueDisc::SetEtsWeight (uint8_t priority, uint32_t weight)
+{
+  NS_LOG_FUNCTION (this << (uint32_t) priority << weight);
+  NS_ASSERT_MSG (priority < MAX_CLASSES, "Priority should be less than " << MAX_CLASSES);
+  m_etsWeights[priority] = weight;
+  if (weight == 0)
+    {
+      m_strictMask |= 1u << priority;
+    }
+  else
+    {
+      m_strictMask &= ~(1u << priority);
+    }
+  m_etsDeficits[priority] = 0;
 }
 
 void
@@ -148,67 +360,183 @@ PausableQueueDisc::DoEnqueue (Ptr<QueueDiscItem> item)
 
   // TODO: Use Classify to call PacketFilter
 
-  // Get priority from packet tag.
-  // We use tag rather than DSCP field to get the priority because in this way
+  // Get priority from the switch metadata of the packet.
+  // We use metadata rather than DSCP field to get the priority because in this way
   // we can use different strategies to set priority.
-  CoSTag cosTag;
-  if (item->GetPacket ()->RemovePacketTag (cosTag))
+  const Packet::SwitchMetadata &metadata = item->GetPacket ()->GetSwitchMetadata ();
+  if (metadata.valid)
     {
-      uint8_t priority = cosTag.GetCoS () & 0x0f;
+      uint8_t priority = metadata.priority & 0x0f;
       NS_ASSERT_MSG (priority < 8, "Priority should be 0~7 but here we have " << priority);
-      Ptr<PausableQueueDiscClass> qdiscClass = GetQueueDiscClass (priority);
-      bool retval = qdiscClass->GetQueueDisc ()->Enqueue (item);
-      if (!retval)
+      if (m_droppingMask & (1u << priority))
+        {
+          if (!m_tcEgress.IsNull ())
+            {
+              m_tcEgress (m_portIndex, priority, item->GetPacket ());
+            }
+          DropBeforeEnqueue (item, PFC_WATCHDOG_DROP);
+          return false;
+        }
+      const Ptr<QueueDisc> &qdisc = m_classQueues[priority];
+      bool retval = qdisc->Enqueue (item);
+      if (retval)
+        {
+          m_backlogMask |= 1u << priority;
+          m_classBytesTrace (priority, qdisc->GetNBytes ());
+        }
+      else
         {
           NS_LOG_WARN ("PausableQueueDisc: enqueue failed on node "
-                       << Simulator::GetContext ()
-                       << ", queue size=" << qdiscClass->GetQueueDisc ()->GetCurrentSize ());
+                       << Simulator::GetContext () << ", queue size=" << qdisc->GetCurrentSize ());
         }
       return retval;
     }
-  NS_FATAL_ERROR ("No priority tag set one the item" << item);
+  NS_FATAL_ERROR ("No switch metadata set on the item" << item);
   return false;
 }
 
+uint32_t
+PausableQueueDisc::GetEligibleMask () const
+{
+  return m_fcEnabled ? m_backlogMask & ~(m_pausedMask & ~m_ignoredMask) : m_backlogMask;
+}
+
+uint32_t
+PausableQueueDisc::SelectEtsClass (uint32_t eligible, std::vector<uint32_t> &deficits,
+                                   uint32_t &current) const
+{
+  // The class holding the turn keeps it while its deficit covers its head
+  // packet, otherwise the turn goes to the next eligible class which gets
+  // its quantum for this round.
+  bool newTurn = current == NO_CLASS || !(eligible & (1u << current));
+  while (true)
+    {
+      if (newTurn)
+        {
+          current = NextBit (eligible, current);
+          deficits[current] += m_etsWeights[current] * m_etsQuantum;
+        }
+      if (deficits[current] >= m_classQueues[current]->Peek ()->GetSize ())
+        {
+          return current;
+        }
+      newTurn = true;
+    }
+}
+
 Ptr<QueueDiscItem>
 PausableQueueDisc::DoDequeue ()
 {
   NS_LOG_FUNCTION (this);
-  Ptr<QueueDiscItem> item = 0;
 
-  for (uint32_t i = GetNQueueDiscClasses (); i -- > 0; )
+  if (m_pausedMask != 0 && Simulator::Now () >= m_pauseWakeupTime)
     {
-      Ptr<PausableQueueDiscClass> qdclass = GetQueueDiscClass (i);
-      if ((!m_fcEnabled || !qdclass->IsPaused ()) &&
-          (item = qdclass->GetQueueDisc ()->Dequeue ()) != 0)
-        {
-          NS_LOG_LOGIC ("Popoed from priority " << i << ": " << item);
-          m_tcEgress (m_portIndex, i, item->GetPacket ());
-          return item;
-        }
+      ExpirePauses (); // the wakeup may be later in this time step
+    }
+  const uint32_t eligible = GetEligibleMask ();
+  if (eligible == 0)
+    {
+      NS_LOG_LOGIC ("Queue empty or paused");
+      return nullptr;
+    }
+
+  const uint32_t strict = eligible & m_strictMask;
+  const bool isEts = strict == 0;
+  const uint32_t i =
+      isEts ? SelectEtsClass (eligible, m_etsDeficits, m_etsCurrent) : HighestBit (strict);
+  Ptr<QueueDiscItem> item = m_classQueues[i]->Dequeue ();
+  NS_ASSERT_MSG (item, "Class " << i << " is marked as backlogged but is empty");
+  if (m_classQueues[i]->GetNPackets () == 0)
+    {
+      m_backlogMask &= ~(1u << i);
+    }
+  if (isEts)
+    {
+      // an emptied class does not keep its deficit for later rounds
+      m_etsDeficits[i] = (m_backlogMask & (1u << i)) ? m_etsDeficits[i] - item->GetSize () : 0;
+    }
+  NS_LOG_LOGIC ("Popped from priority " << i << ": " << item);
+  m_classBytesTrace (i, m_classQueues[i]->GetNBytes ());
+  if (m_intEnabled)
+    {
+      AddIntHop (item);
     }
-  NS_LOG_LOGIC ("Queue empty");
+  m_tcEgress (m_portIndex, i, item->GetPacket ());
   return item;
 }
 
+void
+PausableQueueDisc::AddIntHop (Ptr<QueueDiscItem> item)
+{
+  Ptr<Ipv4QueueDiscItem> ipItem = DynamicCast<Ipv4QueueDiscItem> (item);
+  UdpRoCEv2Header udpRoCE;
+  Ptr<Packet> packet = item->GetPacket ();
+  if (!ipItem || ipItem->GetHeader ().GetProtocol () != UdpL4Protocol::PROT_NUMBER ||
+      packet->GetSize () < udpRoCE.GetSerializedSize ())
+    {
+      return;
+    }
+  packet->PeekHeader (udpRoCE);
+  const RoCEv2Header &roce = udpRoCE.GetRoCE ();
+  // ACKs carry the hops of their data packets back to the sender
+  if (udpRoCE.GetUdp ().GetDestinationPort () != RoCEv2L4Protocol::PROT_NUMBER ||
+      !roce.GetIntPresent () || roce.GetOpcode () == RoCEv2Header::Opcode::RC_ACK)
+    {
+      return;
+    }
+
+  IntHop hop;
+  hop.timestamp = Simulator::Now ().GetNanoSeconds ();
+  hop.txBytes = GetStats ().nTotalDequeuedBytes;
+  hop.qlen = GetNBytes ();
+  hop.lineRate = m_lineRate.GetBitRate ();
+  IntTrailer intTrailer;
+  packet->RemoveTrailer (intTrailer);
+  intTrailer.AddHop (hop);
+  packet->AddTrailer (intTrailer);
+}
+
+void
+PausableQueueDisc::SetIntEnabled (bool enable)
+{
+  NS_LOG_FUNCTION (this << enable);
+  m_intEnabled = enable;
+}
+
+void
+PausableQueueDisc::SetLineRate (DataRate rate)
+{
+  NS_LOG_FUNCTION (this << rate);
+  m_lineRate = rate;
+}
+
 Ptr<const QueueDiscItem>
 PausableQueueDisc::DoPeek ()
 {
   NS_LOG_FUNCTION (this);
-  Ptr<const QueueDiscItem> item;
 
-  for (uint32_t i = 0; i < GetNQueueDiscClasses (); i++)
+  const uint32_t eligible = GetEligibleMask ();
+  if (eligible == 0)
     {
-      Ptr<PausableQueueDiscClass> qdclass = GetQueueDiscClass (i);
-      if ((!m_fcEnabled || !qdclass->IsPaused ()) &&
-          (item = qdclass->GetQueueDisc ()->Dequeue ()) != 0)
-        {
-          NS_LOG_LOGIC ("Peeked from priority " << i << ": " << item);
-          return item;
-        }
+      NS_LOG_LOGIC ("Queue empty or paused");
+      return nullptr;
     }
 
-  NS_LOG_LOGIC ("Queue empty");
+  const uint32_t strict = eligible & m_strictMask;
+  uint32_t i;
+  if (strict != 0)
+    {
+      i = HighestBit (strict);
+    }
+  else
+    {
+      // select on copies so that peeking does not change the round robin state
+      std::vector<uint32_t> deficits (m_etsDeficits);
+      uint32_t current = m_etsCurrent;
+      i = SelectEtsClass (eligible, deficits, current);
+    }
+  Ptr<const QueueDiscItem> item = m_classQueues[i]->Peek ();
+  NS_LOG_LOGIC ("Peeked from priority " << i << ": " << item);
   return item;
 }
 
@@ -241,6 +569,11 @@ PausableQueueDisc::CheckConfig (void)
           AddQueueDiscClass (c);
         }
     }
+  if (GetNQueueDiscClasses () > MAX_CLASSES)
+    {
+      NS_LOG_ERROR ("PausableQueueDisc cannot have more than " << MAX_CLASSES << " classes");
+      return false;
+    }
   return true;
 }
 
@@ -248,6 +581,16 @@ void
 PausableQueueDisc::InitializeParams (void)
 {
   NS_LOG_FUNCTION (this);
+  m_classQueues.clear ();
+  m_backlogMask = 0;
+  for (std::size_t i = 0; i < GetNQueueDiscClasses (); i++)
+    {
+      m_classQueues.push_back (QueueDisc::GetQueueDiscClass (i)->GetQueueDisc ());
+      if (m_classQueues.back ()->GetNPackets () > 0)
+        {
+          m_backlogMask |= 1u << i;
+        }
+    }
 }
 
 TypeId
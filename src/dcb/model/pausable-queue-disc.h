@@ -21,9 +21,14 @@
 #ifndef PAUSABLE_QUEUE_DISC_H
 #define PAUSABLE_QUEUE_DISC_H
 
+#include "ns3/data-rate.h"
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
 #include "ns3/queue-disc.h"
 #include "ns3/queue-item.h"
+#include "ns3/traced-callback.h"
 #include "ns3/type-id.h"
+#include <vector>
 
 namespace ns3 {
 
@@ -45,6 +50,16 @@ private:
   bool m_isPaused;  
 }; // PausableQueueDiscClass
 
+/**
+ * \brief Egress queue disc of a DCB port with one class per priority.
+ *
+ * Classes are either strict priority, where a higher index is served first,
+ * or ETS (IEEE 802.1Qaz) classes sharing the bandwidth left by the strict ones
+ * with deficit round robin in proportion to their weights.  All classes are
+ * strict by default.  Backlogged and paused classes are tracked in bitmasks so
+ * that choosing the class to serve is a few bit operations whatever the number
+ * of classes.
+ */
 class PausableQueueDisc : public QueueDisc
 {
 
@@ -71,10 +86,79 @@ public:
 
   void SetPaused (uint8_t priority, bool paused);
 
+  bool IsPaused (uint8_t priority) const;
+
+  /**
+   * \brief Pause a class until a time, as a PFC pause frame does.
+   *
+   * Each pause frame replaces the current end, so a shorter pause also
+   * shortens it.  The pauses of all classes share one wakeup event that
+   * fires at the earliest end, so refreshing a pause schedules nothing, and
+   * the ends are also checked when dequeuing.
+   */
+  void PauseUntil (uint8_t priority, Time end);
+
+  /**
+   * \brief Resume a paused class and send its packets.
+   */
+  void Resume (uint8_t priority);
+
+  /**
+   * \brief Serve a class whether it is paused or not, as a PFC watchdog does
+   * when the peer keeps pausing it.  The pause state is still tracked.
+   */
+  void SetPfcIgnored (uint8_t priority, bool ignored);
+
+  /**
+   * \brief Drop the packets queued in a class and those enqueued to it
+   * afterwards, as a PFC watchdog does to a stuck class.  The dropped packets
+   * release their buffer like sent ones do.
+   */
+  void SetDropping (uint8_t priority, bool dropping);
+
+  /**
+   * \brief Set the ETS weight of a class.
+   * \param priority the index of the class
+   * \param weight the share of the class in the deficit round robin, or 0 to
+   *        make it a strict priority class
+   */
+  void SetEtsWeight (uint8_t priority, uint32_t weight);
+
+  /**
+   * \brief Append an IntHop to the IntTrailer of the RoCEv2 data packets
+   * leaving this port.
+   */
+  void SetIntEnabled (bool enable);
+
+  /**
+   * \brief Set the rate of the port, reported in the INT hops.
+   */
+  void SetLineRate (DataRate rate);
+
   typedef Callback<void, uint32_t, uint8_t, Ptr<Packet>> TCEgressCallback;
 
   void RegisterTrafficControlCallback (TCEgressCallback cb);
 
+  /**
+   * TracedCallback signature for the length of a class after it changed.
+   * \param [in] priority the index of the class
+   * \param [in] bytes the bytes in the queue of the class
+   */
+  typedef void (*ClassBytesTracedCallback) (uint8_t priority, uint32_t bytes);
+
+  /**
+   * TracedCallback signature for the pause state of a class after it changed.
+   * \param [in] priority the index of the class
+   * \param [in] paused whether the class is paused
+   */
+  typedef void (*PausedTracedCallback) (uint8_t priority, bool paused);
+
+  // Reasons for dropping packets
+  static constexpr const char *PFC_WATCHDOG_DROP = "PFC watchdog drop";
+
+protected:
+  virtual void DoDispose (void) override;
+
 private:
   virtual bool DoEnqueue (Ptr<QueueDiscItem> item) override;
 
@@ -86,6 +170,34 @@ private:
 
   virtual void InitializeParams (void) override;
 
+  /**
+   * \brief Choose the ETS class to serve by deficit round robin.
+   * \param eligible the mask of backlogged and unpaused ETS classes, not 0
+   * \param deficits the deficit counter of each class, updated
+   * \param current the class holding the round robin turn, updated
+   * \return the index of the class to serve
+   */
+  uint32_t SelectEtsClass (uint32_t eligible, std::vector<uint32_t> &deficits,
+                           uint32_t &current) const;
+
+  /// The mask of classes that may be served now
+  uint32_t GetEligibleMask (void) const;
+
+  /**
+   * \brief Resume the classes whose pauses ended.
+   * \return the earliest end of the pauses left, or Time::Max () if none
+   */
+  Time ExpirePauses (void);
+
+  /// Resume the classes whose pauses ended and send their packets
+  void PauseWakeup (void);
+
+  /**
+   * \brief Record this port in the IntTrailer of the packet, if it is a RoCEv2
+   * data packet that has one.
+   */
+  void AddIntHop (Ptr<QueueDiscItem> item);
+
   bool m_fcEnabled;
 
   TCEgressCallback m_tcEgress;
@@ -94,6 +206,26 @@ private:
 
   QueueSize m_queueSize;
 
+  std::vector<Ptr<QueueDisc>> m_classQueues; //!< queue disc of each class, cached
+  uint32_t m_backlogMask; //!< bit i is set if class i is not empty
+  uint32_t m_pausedMask; //!< bit i is set if class i is paused
+  std::vector<Time> m_pauseEnds; //!< when the pause of each class ends
+  EventId m_pauseWakeup; //!< fires at the earliest end of the pauses
+  Time m_pauseWakeupTime; //!< the time of m_pauseWakeup, or Time::Max () if none
+  uint32_t m_ignoredMask; //!< bit i is set if the pauses of class i are ignored
+  uint32_t m_droppingMask; //!< bit i is set if the packets of class i are dropped
+  uint32_t m_strictMask; //!< bit i is set if class i is a strict priority class
+  std::vector<uint32_t> m_etsWeights; //!< ETS weight of each class
+  uint32_t m_etsQuantum; //!< bytes added to the deficit per unit of weight per round
+  std::vector<uint32_t> m_etsDeficits; //!< deficit counter of each ETS class
+  uint32_t m_etsCurrent; //!< the ETS class holding the round robin turn
+
+  bool m_intEnabled;
+  DataRate m_lineRate; //!< the rate of the port, for INT
+
+  TracedCallback<uint8_t, uint32_t> m_classBytesTrace;
+  TracedCallback<uint8_t, bool> m_pausedTrace;
+
 }; // class PausableQueueDisc
 
 } // namespace ns3
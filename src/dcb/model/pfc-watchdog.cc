@@ -0,0 +1,333 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#include "pfc-watchdog.h"
+#include "dcb-net-device.h"
+#include "ns3/boolean.h"
+#include "ns3/channel.h"
+#include "ns3/enum.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/trace-source-accessor.h"
+#include <algorithm>
+#include <sstream>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("PfcWatchdog");
+
+NS_OBJECT_ENSURE_REGISTERED (PfcWatchdog);
+
+TypeId
+PfcWatchdog::GetTypeId (void)
+{
+  static TypeId tid =
+      TypeId ("ns3::PfcWatchdog")
+          .SetParent<Object> ()
+          .SetGroupName ("Dcb")
+          .AddConstructor<PfcWatchdog> ()
+          .AddAttribute ("DeadlockTime",
+                         "How long all ports of a loop stay paused before it is a deadlock",
+                         TimeValue (MicroSeconds (100)),
+                         MakeTimeAccessor (&PfcWatchdog::m_deadlockTime), MakeTimeChecker ())
+          .AddAttribute ("StopOnDeadlock", "Stop the simulation at the first deadlock",
+                         BooleanValue (false), MakeBooleanAccessor (&PfcWatchdog::m_stopOnDeadlock),
+                         MakeBooleanChecker ())
+          .AddAttribute ("DetectionTime",
+                         "How long a port stays paused before it is in a pause storm, "
+                         "0 to not detect pause storms",
+                         TimeValue (MilliSeconds (10)),
+                         MakeTimeAccessor (&PfcWatchdog::m_detectionTime), MakeTimeChecker ())
+          .AddAttribute ("RestorationTime",
+                         "How long a port in a pause storm stays not paused before it is restored",
+                         TimeValue (MilliSeconds (10)),
+                         MakeTimeAccessor (&PfcWatchdog::m_restorationTime), MakeTimeChecker ())
+          .AddAttribute ("StormAction", "What to do with a priority of a port in a pause storm",
+                         EnumValue (PfcWatchdog::ALERT),
+                         MakeEnumAccessor (&PfcWatchdog::m_stormAction),
+                         MakeEnumChecker (PfcWatchdog::ALERT, "Alert", PfcWatchdog::FORWARD,
+                                          "Forward", PfcWatchdog::DROP, "Drop"))
+          .AddTraceSource ("Deadlock", "A loop of paused ports that did not resolve",
+                           MakeTraceSourceAccessor (&PfcWatchdog::m_deadlockTrace),
+                           "ns3::PfcWatchdog::DeadlockTracedCallback")
+          .AddTraceSource ("PauseStorm", "A port entered or left a pause storm",
+                           MakeTraceSourceAccessor (&PfcWatchdog::m_pauseStormTrace),
+                           "ns3::PfcWatchdog::PauseStormTracedCallback");
+  return tid;
+}
+
+PfcWatchdog::PfcWatchdog () : m_stamp (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+PfcWatchdog::~PfcWatchdog ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+PfcWatchdog::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (Port &p : m_ports)
+    {
+      for (uint8_t c = 0; c < 8; c++)
+        {
+          p.stormEvent[c].Cancel ();
+          p.deadlockEvent[c].Cancel ();
+        }
+    }
+  m_ports.clear ();
+  m_nodePorts.clear ();
+  Object::DoDispose ();
+}
+
+void
+PfcWatchdog::Install (Ptr<Node> node)
+{
+  NS_LOG_FUNCTION (this << node);
+  for (uint32_t i = 0; i < node->GetNDevices (); i++)
+    {
+      Ptr<DcbNetDevice> dev = DynamicCast<DcbNetDevice> (node->GetDevice (i));
+      if (!dev || !dev->GetQueueDisc ())
+        {
+          continue;
+        }
+      Port p;
+      p.qdisc = dev->GetQueueDisc ();
+      p.node = node->GetId ();
+      p.port = dev->GetIfIndex ();
+      p.peerNode = NO_PEER;
+      p.peerPort = 0;
+      p.pausedMask = 0;
+      p.stormMask = 0;
+      Ptr<Channel> channel = dev->GetChannel ();
+      for (std::size_t j = 0; channel && j < channel->GetNDevices (); j++)
+        {
+          Ptr<NetDevice> peer = channel->GetDevice (j);
+          if (peer != dev)
+            {
+              p.peerNode = peer->GetNode ()->GetId ();
+              p.peerPort = peer->GetIfIndex ();
+            }
+        }
+
+      const uint32_t v = m_ports.size ();
+      m_ports.push_back (p);
+      m_nodePorts[p.node].push_back (v);
+      p.qdisc->TraceConnectWithoutContext ("Paused",
+                                           MakeCallback (&PfcWatchdog::PortPaused, this).Bind (v));
+    }
+  m_visitStamp.resize (m_ports.size (), 0);
+  m_visitParent.resize (m_ports.size (), 0);
+}
+
+void
+PfcWatchdog::Install (NodeContainer nodes)
+{
+  for (NodeContainer::Iterator i = nodes.Begin (); i != nodes.End (); i++)
+    {
+      Install (*i);
+    }
+}
+
+void
+PfcWatchdog::PortPaused (uint32_t v, uint8_t priority, bool paused)
+{
+  NS_LOG_FUNCTION (this << v << (uint32_t) priority << paused);
+  NS_ASSERT_MSG (priority < 8, "Priority should be 0~7 but here we have " << +priority);
+  Port &p = m_ports[v];
+  const uint8_t bit = 1 << priority;
+  if (!paused)
+    {
+      p.pausedMask &= ~bit;
+      p.pausedSince[priority] = Simulator::Now (); // now the time it was resumed
+      return;
+    }
+  p.pausedMask |= bit;
+  p.pausedSince[priority] = Simulator::Now ();
+
+  if (m_detectionTime.IsStrictlyPositive () && !(p.stormMask & bit) &&
+      !p.stormEvent[priority].IsRunning ())
+    {
+      p.stormEvent[priority] =
+          Simulator::Schedule (m_detectionTime, &PfcWatchdog::CheckStorm, this, v, priority);
+    }
+
+  // A new loop passes through the port that was just paused, so searching
+  // from it is enough to find all loops as they form.
+  std::vector<uint32_t> loop = FindLoop (v, priority);
+  if (!loop.empty ())
+    {
+      NS_LOG_INFO ("PFC: a loop of " << loop.size () << " paused ports at priority " << +priority
+                                     << " closed by node " << p.node << " port " << p.port);
+      Simulator::Cancel (p.deadlockEvent[priority]);
+      p.deadlockEvent[priority] = Simulator::Schedule (m_deadlockTime, &PfcWatchdog::CheckDeadlock,
+                                                       this, v, priority, loop, Simulator::Now ());
+    }
+}
+
+std::vector<uint32_t>
+PfcWatchdog::FindLoop (uint32_t v, uint8_t priority)
+{
+  const uint8_t bit = 1 << priority;
+  m_stamp++;
+  m_visitStamp[v] = m_stamp;
+  std::vector<uint32_t> stack{v};
+  while (!stack.empty ())
+    {
+      const uint32_t u = stack.back ();
+      stack.pop_back ();
+      const Port &p = m_ports[u];
+      auto peer = m_nodePorts.find (p.peerNode);
+      if (peer == m_nodePorts.end ())
+        {
+          continue; // a host, a node not watched or no link
+        }
+      // the peer paused u because its buffer holds packets waiting at its other ports
+      for (uint32_t w : peer->second)
+        {
+          const Port &next = m_ports[w];
+          if (next.port == p.peerPort || !(next.pausedMask & bit))
+            {
+              continue;
+            }
+          if (w == v)
+            {
+              std::vector<uint32_t> loop;
+              for (uint32_t x = u; x != v; x = m_visitParent[x])
+                {
+                  loop.push_back (x);
+                }
+              loop.push_back (v);
+              std::reverse (loop.begin (), loop.end ());
+              return loop;
+            }
+          if (m_visitStamp[w] != m_stamp)
+            {
+              m_visitStamp[w] = m_stamp;
+              m_visitParent[w] = u;
+              stack.push_back (w);
+            }
+        }
+    }
+  return {};
+}
+
+void
+PfcWatchdog::CheckDeadlock (uint32_t v, uint8_t priority, std::vector<uint32_t> loop,
+                            Time foundTime)
+{
+  NS_LOG_FUNCTION (this << v << (uint32_t) priority);
+  const uint8_t bit = 1 << priority;
+  std::vector<PausedPort> ports;
+  std::ostringstream oss;
+  oss << "PFC deadlock at " << Simulator::Now ().As (Time::US) << " on priority " << +priority
+      << ":";
+  for (uint32_t u : loop)
+    {
+      const Port &p = m_ports[u];
+      if (!(p.pausedMask & bit) || p.pausedSince[priority] > foundTime)
+        {
+          NS_LOG_INFO ("PFC: the loop closed by node " << m_ports[v].node << " port "
+                                                       << m_ports[v].port << " resolved");
+          return;
+        }
+      ports.push_back ({p.node, p.port, p.pausedSince[priority]});
+      oss << " node " << p.node << " port " << p.port << " (paused since "
+          << p.pausedSince[priority].As (Time::US) << ") ->";
+    }
+  oss << " node " << m_ports[v].node << " port " << m_ports[v].port;
+  NS_LOG_WARN (oss.str ());
+  m_deadlockTrace (priority, ports);
+  if (m_stopOnDeadlock)
+    {
+      NS_LOG_WARN ("PFC: stop the simulation on the deadlock");
+      Simulator::Stop ();
+    }
+}
+
+void
+PfcWatchdog::CheckStorm (uint32_t v, uint8_t priority)
+{
+  NS_LOG_FUNCTION (this << v << (uint32_t) priority);
+  Port &p = m_ports[v];
+  const uint8_t bit = 1 << priority;
+  if (!(p.pausedMask & bit))
+    {
+      return;
+    }
+  const Time left = p.pausedSince[priority] + m_detectionTime - Simulator::Now ();
+  if (left.IsStrictlyPositive ())
+    {
+      // paused again since the check was scheduled
+      p.stormEvent[priority] =
+          Simulator::Schedule (left, &PfcWatchdog::CheckStorm, this, v, priority);
+      return;
+    }
+
+  NS_LOG_WARN ("PFC: pause storm on node " << p.node << " port " << p.port << " priority "
+                                           << +priority);
+  p.stormMask |= bit;
+  m_pauseStormTrace (p.node, p.port, priority, true);
+  if (m_stormAction == FORWARD)
+    {
+      p.qdisc->SetPfcIgnored (priority, true);
+    }
+  else if (m_stormAction == DROP)
+    {
+      p.qdisc->SetDropping (priority, true);
+    }
+  p.stormEvent[priority] =
+      Simulator::Schedule (m_restorationTime, &PfcWatchdog::CheckRestoration, this, v, priority);
+}
+
+void
+PfcWatchdog::CheckRestoration (uint32_t v, uint8_t priority)
+{
+  NS_LOG_FUNCTION (this << v << (uint32_t) priority);
+  Port &p = m_ports[v];
+  const uint8_t bit = 1 << priority;
+  Time left = m_restorationTime;
+  if (!(p.pausedMask & bit))
+    {
+      left = p.pausedSince[priority] + m_restorationTime - Simulator::Now ();
+    }
+  if (left.IsStrictlyPositive ())
+    {
+      p.stormEvent[priority] =
+          Simulator::Schedule (left, &PfcWatchdog::CheckRestoration, this, v, priority);
+      return;
+    }
+
+  NS_LOG_INFO ("PFC: node " << p.node << " port " << p.port << " priority " << +priority
+                            << " restored from the pause storm");
+  p.stormMask &= ~bit;
+  if (m_stormAction == FORWARD)
+    {
+      p.qdisc->SetPfcIgnored (priority, false);
+    }
+  else if (m_stormAction == DROP)
+    {
+      p.qdisc->SetDropping (priority, false);
+    }
+  m_pauseStormTrace (p.node, p.port, priority, false);
+}
+
+} // namespace ns3
@@ -0,0 +1,154 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#ifndef PFC_WATCHDOG_H
+#define PFC_WATCHDOG_H
+
+#include "pausable-queue-disc.h"
+#include "ns3/event-id.h"
+#include "ns3/node-container.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/traced-callback.h"
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \brief Detects PFC deadlocks and pause storms.
+ *
+ * The watchdog follows the pause state of the egress queue of each priority of
+ * the ports it is installed on, which DcbPfcPort::ReceivePfc drives.  A paused
+ * port waits for the ports of its peer switch that the peer's buffer drains
+ * to, so the paused ports form a "who waits for whom" graph per priority.
+ * Each time a port is paused, a search from it over the paused ports finds
+ * whether it closes a loop, i.e., a cyclic buffer dependency.  A loop all of
+ * whose ports are still paused after DeadlockTime is reported as a deadlock
+ * and may stop the simulation.
+ *
+ * A port paused without a break for DetectionTime is in a pause storm.  Like
+ * the watchdog of a switch, it may then ignore the pauses or drop the packets
+ * of the priority until the port was not paused for RestorationTime.
+ *
+ * Only the ports of the nodes the watchdog is installed on are watched, and a
+ * loop through a node simulated by another MPI process is not found.
+ */
+class PfcWatchdog : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+
+  PfcWatchdog ();
+  virtual ~PfcWatchdog ();
+
+  /// What to do with a priority of a port in a pause storm
+  enum StormAction {
+    ALERT, //!< only report the storm
+    FORWARD, //!< ignore the pauses and keep sending
+    DROP, //!< drop the queued and arriving packets
+  };
+
+  /// A paused port in a deadlock loop
+  struct PausedPort
+  {
+    uint32_t node;
+    uint32_t port;
+    Time pausedSince;
+  }; // struct PausedPort
+
+  /**
+   * \brief Watch the DcbNetDevices of a node.
+   */
+  void Install (Ptr<Node> node);
+  void Install (NodeContainer nodes);
+
+  /**
+   * TracedCallback signature for a deadlock.
+   * \param [in] priority the priority of the loop
+   * \param [in] loop the ports of the loop, each waiting for the next one
+   */
+  typedef void (*DeadlockTracedCallback) (uint8_t priority, const std::vector<PausedPort> &loop);
+
+  /**
+   * TracedCallback signature for a pause storm.
+   * \param [in] node the ID of the node
+   * \param [in] port the index of the paused port
+   * \param [in] priority the paused priority
+   * \param [in] storm true when the storm is detected, false when the port is restored
+   */
+  typedef void (*PauseStormTracedCallback) (uint32_t node, uint32_t port, uint8_t priority,
+                                            bool storm);
+
+protected:
+  virtual void DoDispose (void) override;
+
+private:
+  static constexpr uint32_t NO_PEER = 0xffffffff;
+
+  struct Port
+  {
+    Ptr<PausableQueueDisc> qdisc;
+    uint32_t node;
+    uint32_t port;
+    uint32_t peerNode; //!< the node at the other end of the link, or NO_PEER
+    uint32_t peerPort;
+    uint8_t pausedMask;
+    uint8_t stormMask; //!< the priorities in a pause storm
+    /// when each priority was paused, or resumed if it is not paused
+    std::array<Time, 8> pausedSince;
+    std::array<EventId, 8> stormEvent;
+    std::array<EventId, 8> deadlockEvent;
+  }; // struct Port
+
+  /**
+   * \brief Called by the Paused trace of the queue disc of a port.
+   */
+  void PortPaused (uint32_t v, uint8_t priority, bool paused);
+
+  /**
+   * \brief Search a loop of ports paused at a priority through a port.
+   * \return the ports of the loop starting from v, empty if there is none
+   */
+  std::vector<uint32_t> FindLoop (uint32_t v, uint8_t priority);
+
+  void CheckDeadlock (uint32_t v, uint8_t priority, std::vector<uint32_t> loop, Time foundTime);
+  void CheckStorm (uint32_t v, uint8_t priority);
+  void CheckRestoration (uint32_t v, uint8_t priority);
+
+  std::vector<Port> m_ports;
+  /// the ports of each node, by node ID
+  std::unordered_map<uint32_t, std::vector<uint32_t>> m_nodePorts;
+  std::vector<uint32_t> m_visitStamp; //!< the search that last visited each port
+  std::vector<uint32_t> m_visitParent; //!< the port each port is reached from
+  uint32_t m_stamp;
+
+  Time m_deadlockTime;
+  bool m_stopOnDeadlock;
+  Time m_detectionTime;
+  Time m_restorationTime;
+  StormAction m_stormAction;
+
+  TracedCallback<uint8_t, const std::vector<PausedPort> &> m_deadlockTrace;
+  TracedCallback<uint32_t, uint32_t, uint8_t, bool> m_pauseStormTrace;
+}; // class PfcWatchdog
+
+} // namespace ns3
+
+#endif // PFC_WATCHDOG_H
@@ -0,0 +1,139 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#include "rocev2-congestion-ops.h"
+#include "rocev2-socket.h"
+#include "ns3/log.h"
+#include <algorithm>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("RoCEv2CongestionOps");
+
+NS_OBJECT_ENSURE_REGISTERED (RoCEv2CongestionOps);
+
+TypeId
+RoCEv2CongestionOps::GetTypeId ()
+{
+  static TypeId tid = TypeId ("ns3::RoCEv2CongestionOps").SetParent<Object> ().SetGroupName ("Dcb");
+  return tid;
+}
+
+RoCEv2CongestionOps::RoCEv2CongestionOps () : m_roundEndPsn (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+RoCEv2CongestionOps::~RoCEv2CongestionOps ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+RoCEv2CongestionOps::SetSockState (Ptr<RoCEv2SocketState> sockState)
+{
+  m_sockState = sockState;
+}
+
+void
+RoCEv2CongestionOps::SetLineRate (DataRate rate)
+{
+  m_lineRate = rate;
+}
+
+void
+RoCEv2CongestionOps::SetStopTime (Time stopTime)
+{
+  m_stopTime = stopTime;
+}
+
+void
+RoCEv2CongestionOps::SetReady ()
+{
+}
+
+void
+RoCEv2CongestionOps::Sync ()
+{
+}
+
+void
+RoCEv2CongestionOps::Stop ()
+{
+}
+
+void
+RoCEv2CongestionOps::UpdateStateSend (Ptr<Packet> packet)
+{
+}
+
+void
+RoCEv2CongestionOps::UpdateStateWithCNP ()
+{
+}
+
+void
+RoCEv2CongestionOps::UpdateStateWithAck (const RoCEv2AckInfo &ack)
+{
+}
+
+Time
+RoCEv2CongestionOps::GetCNPInterval () const
+{
+  return MicroSeconds (4);
+}
+
+bool
+RoCEv2CongestionOps::RequiresInt () const
+{
+  return false;
+}
+
+void
+RoCEv2CongestionOps::SetRate (DataRate rate)
+{
+  const double ratio = static_cast<double> (rate.GetBitRate ()) / m_lineRate.GetBitRate ();
+  m_sockState->SetRateRatioPercent (std::min (ratio * 100., 100.));
+}
+
+bool
+RoCEv2CongestionOps::IsNewRound (const RoCEv2AckInfo &ack)
+{
+  if (ack.psn == m_roundEndPsn || PsnAfter (ack.psn, m_roundEndPsn))
+    {
+      m_roundEndPsn = ack.nextPsn;
+      return true;
+    }
+  return false;
+}
+
+void
+RoCEv2CongestionOps::ResetRounds ()
+{
+  m_roundEndPsn = 0;
+}
+
+// static
+bool
+RoCEv2CongestionOps::PsnAfter (uint32_t a, uint32_t b)
+{
+  const uint32_t diff = (a - b) & 0xffffff;
+  return diff != 0 && diff < 0x800000;
+}
+
+} // namespace ns3
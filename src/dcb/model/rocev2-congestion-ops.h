@@ -0,0 +1,152 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#ifndef ROCEV2_CONGESTION_OPS_H
+#define ROCEV2_CONGESTION_OPS_H
+
+#include "int-trailer.h"
+#include "ns3/data-rate.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/packet.h"
+#include <vector>
+
+namespace ns3 {
+
+class RoCEv2SocketState;
+
+/**
+ * \brief What a sender learns from an ACK.
+ */
+struct RoCEv2AckInfo
+{
+  uint32_t psn; //!< the acked PSN
+  uint32_t nextPsn; //!< PSN of the next packet the sender will send
+  uint32_t ackedBytes; //!< payload bytes newly acked
+  Time rtt; //!< RTT of the acked packet, zero if unknown
+  /// the telemetry of the path of the acked packet, nullptr if it has none
+  const std::vector<IntHop> *intHops;
+}; // struct RoCEv2AckInfo
+
+/**
+ * \brief The interface of the congestion control of RoCEv2Socket.
+ *
+ * An implementation controls the sender through the RoCEv2SocketState: a
+ * rate, as a percentage of the line rate, at which packets are paced, and a
+ * window of bytes in flight, 0 for no limit.  It is told of every packet sent,
+ * every ACK and every CNP, and may override only the hooks it needs.
+ *
+ * RoCEv2Socket creates the implementation named by its CongestionControl
+ * attribute, so it should be registered with a default constructor.
+ */
+class RoCEv2CongestionOps : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+
+  RoCEv2CongestionOps ();
+  virtual ~RoCEv2CongestionOps ();
+
+  void SetSockState (Ptr<RoCEv2SocketState> sockState);
+
+  /**
+   * The rate of the device the socket is bound to, set before SetReady.
+   */
+  void SetLineRate (DataRate rate);
+
+  void SetStopTime (Time stopTime);
+
+  /**
+   * After configuring the congestion control, start it.
+   */
+  virtual void SetReady ();
+
+  /**
+   * Bring the state up to date before the sender reads it.
+   */
+  virtual void Sync ();
+
+  /**
+   * Cancel the timers, e.g., when the socket is closed.
+   */
+  virtual void Stop ();
+
+  /**
+   * Restore the initial state so that a recycled socket starts a new flow.
+   */
+  virtual void Reset () = 0;
+
+  /**
+   * When the sender sending out a packet, update the state if needed.
+   */
+  virtual void UpdateStateSend (Ptr<Packet> packet);
+
+  /**
+   * Update the state when receiving a CNP.
+   */
+  virtual void UpdateStateWithCNP ();
+
+  /**
+   * Update the state when receiving an ACK that acks new packets.
+   */
+  virtual void UpdateStateWithAck (const RoCEv2AckInfo &ack);
+
+  /**
+   * The minimum interval between two CNPs of a flow sent by a receiver.
+   */
+  virtual Time GetCNPInterval () const;
+
+  /**
+   * Whether the sender should collect INT hops for this congestion control.
+   */
+  virtual bool RequiresInt () const;
+
+protected:
+  /**
+   * Set the rate of the sender, capped to the line rate.
+   */
+  void SetRate (DataRate rate);
+
+  /**
+   * \brief Whether an ACK ends the round of packets that were sent when the
+   * last round ended, i.e., whether one RTT passed since then.  Starts a new
+   * round if it does.
+   */
+  bool IsNewRound (const RoCEv2AckInfo &ack);
+
+  /**
+   * Start counting rounds again from the first packet of a flow.
+   */
+  void ResetRounds ();
+
+  /**
+   * \return whether the 24-bit PSN a is after b
+   */
+  static bool PsnAfter (uint32_t a, uint32_t b);
+
+  Ptr<RoCEv2SocketState> m_sockState;
+  DataRate m_lineRate;
+  Time m_stopTime;
+
+private:
+  uint32_t m_roundEndPsn; //!< the current round ends when this PSN is acked
+}; // class RoCEv2CongestionOps
+
+} // namespace ns3
+
+#endif // ROCEV2_CONGESTION_OPS_H
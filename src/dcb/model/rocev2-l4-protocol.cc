@@ -44,7 +44,7 @@ RoCEv2L4Protocol::GetTypeId (void)
   return tid;
 }
 
-RoCEv2L4Protocol::RoCEv2L4Protocol ()
+RoCEv2L4Protocol::RoCEv2L4Protocol () : m_flowGeneration (0)
 {
   NS_LOG_FUNCTION (this);  
   m_innerEndPoints = new InnerEndPointDemux (0x100, 0x7fffff);
@@ -144,6 +144,13 @@ RoCEv2L4Protocol::Allocate (uint32_t srcPort, uint32_t dstPort)
   return m_innerEndPoints->Allocate (srcPort, dstPort);
 }
 
+uint8_t
+RoCEv2L4Protocol::NextFlowGeneration ()
+{
+  m_flowGeneration = (m_flowGeneration + 1) & 0b11'1111;
+  return m_flowGeneration;
+}
+
 uint32_t
 RoCEv2L4Protocol::ParseInnerPort (Ptr<Packet> packet, Ipv4Header header, uint16_t port,
                                   Ptr<Ipv4Interface> incomingIntf)
@@ -204,7 +211,8 @@ RoCEv2L4Protocol::GenerateCNP (uint32_t srcQP, uint32_t dstQP)
 
 // static
 Ptr<Packet>
-RoCEv2L4Protocol::GenerateACK (uint32_t srcQP, uint32_t dstQP, uint32_t expectedPSN)
+RoCEv2L4Protocol::GenerateACK (uint32_t srcQP, uint32_t dstQP, uint32_t expectedPSN,
+                               const IntTrailer *intTrailer)
 {
   RoCEv2Header rocev2Header{};
   rocev2Header.SetOpcode (RoCEv2Header::Opcode::RC_ACK);
@@ -214,6 +222,11 @@ RoCEv2L4Protocol::GenerateACK (uint32_t srcQP, uint32_t dstQP, uint32_t expected
   AETHeader aeth;
   aeth.SetSyndromeType (AETHeader::SyndromeType::FC_DISABLED); // TODO: support flow control
   Ptr<Packet> packet = Create<Packet> (12);
+  if (intTrailer)
+    {
+      packet->AddTrailer (*intTrailer);
+      rocev2Header.SetIntPresent (true);
+    }
   packet->AddHeader (aeth);
   packet->AddHeader(rocev2Header);
   return packet;
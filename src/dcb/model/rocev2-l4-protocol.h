@@ -26,6 +26,8 @@
 
 namespace ns3 {
 
+class IntTrailer;
+
 class RoCEv2L4Protocol : public UdpBasedL4Protocol
 {
 
@@ -58,8 +60,20 @@ public:
 
   virtual Ptr<Socket> CreateSocket () override;
 
+  /**
+   * \return the generation of a new flow sent from this node, see
+   * RoCEv2Header::GetFlowGeneration.  Consecutive flows get consecutive
+   * generations, so a QP reused by another flow gets another generation
+   * unless a multiple of 64 flows started in between.
+   */
+  uint8_t NextFlowGeneration ();
+
   static Ptr<Packet> GenerateCNP (uint32_t srcQP, uint32_t dstQP);
-  static Ptr<Packet> GenerateACK (uint32_t srcQP, uint32_t dstQP, uint32_t expectedPSN);
+  /**
+   * \param intTrailer the INT trailer of the acked packet to reflect, if not null
+   */
+  static Ptr<Packet> GenerateACK (uint32_t srcQP, uint32_t dstQP, uint32_t expectedPSN,
+                                  const IntTrailer *intTrailer = nullptr);
   static Ptr<Packet> GenerateNACK (uint32_t srcQP, uint32_t dstQP, uint32_t expectedPSN);
 
   // protected:
@@ -77,6 +91,7 @@ private:
                                    Ptr<Ipv4Interface> incomingIntf) override;
 
   std::map<uint32_t, uint32_t> m_qpMapper; //!< map destQP to stcQP
+  uint8_t m_flowGeneration; //!< generation of the last flow started
 
 }; // class RoCEv2L4Protocol
 
@@ -22,8 +22,11 @@
 #include "dcb-net-device.h"
 #include "dcqcn.h"
 #include "ns3/assert.h"
+#include "ns3/boolean.h"
 #include "ns3/fatal-error.h"
+#include "ns3/type-id.h"
 #include "ns3/nstime.h"
+#include "ns3/object-factory.h"
 #include "ns3/packet.h"
 #include "rocev2-l4-protocol.h"
 #include "udp-based-l4-protocol.h"
@@ -44,19 +47,52 @@ NS_OBJECT_ENSURE_REGISTERED (RoCEv2Socket);
 TypeId
 RoCEv2Socket::GetTypeId ()
 {
-  static TypeId tid = TypeId ("ns3::RoCEv2Socket")
-                          .SetParent<UdpBasedSocket> ()
-                          .SetGroupName ("Dcb")
-                          .AddConstructor<RoCEv2Socket> ();
+  static TypeId tid =
+      TypeId ("ns3::RoCEv2Socket")
+          .SetParent<UdpBasedSocket> ()
+          .SetGroupName ("Dcb")
+          .AddConstructor<RoCEv2Socket> ()
+          .AddAttribute ("RetransmitTimeout",
+                         "Go back to the oldest unacked packet if the window does not move for "
+                         "this long. Zero disables it, which is fine with PFC enabled.",
+                         TimeValue (Time (0)), MakeTimeAccessor (&RoCEv2Socket::m_rto),
+                         MakeTimeChecker ())
+          .AddAttribute ("CompletedFlowTimeout",
+                         "How long the receiver remembers a completed flow to ACK its "
+                         "retransmissions again if the final ACK is lost. It should be longer "
+                         "than the RetransmitTimeout of the senders. Zero disables it, which is "
+                         "fine with PFC enabled.",
+                         TimeValue (MilliSeconds (10)),
+                         MakeTimeAccessor (&RoCEv2Socket::m_completedFlowTimeout),
+                         MakeTimeChecker ())
+          .AddAttribute ("CongestionControl",
+                         "The type of the congestion control, a subclass of RoCEv2CongestionOps",
+                         TypeIdValue (DcqcnCongestionOps::GetTypeId ()),
+                         MakeTypeIdAccessor (&RoCEv2Socket::SetCongestionControl,
+                                             &RoCEv2Socket::GetCongestionControl),
+                         MakeTypeIdChecker ())
+          .AddAttribute ("IntEnabled",
+                         "Collect the INT hops of the path in every data packet. They are "
+                         "always collected if the congestion control needs them.",
+                         BooleanValue (false), MakeBooleanAccessor (&RoCEv2Socket::m_intEnabled),
+                         MakeBooleanChecker ())
+          .AddTraceSource ("IntHops", "The INT hops of the path of a packet, carried by its ACK",
+                           MakeTraceSourceAccessor (&RoCEv2Socket::m_intHopsTrace),
+                           "ns3::RoCEv2Socket::IntHopsTracedCallback");
   return tid;
 }
 
 RoCEv2Socket::RoCEv2Socket ()
-    : UdpBasedSocket (), m_isSending (false), m_senderNextPSN (0), m_psnEnd (0)
+    : UdpBasedSocket (),
+      m_isSending (false),
+      m_isLastPacketNext (false),
+      m_allPushed (false),
+      m_flowGeneration (0),
+      m_intEnabled (false)
 {
   NS_LOG_FUNCTION (this);
   m_sockState = CreateObject<RoCEv2SocketState> ();
-  m_ccOps = CreateObject<DcqcnCongestionOps> (m_sockState);
+  SetCongestionControl (DcqcnCongestionOps::GetTypeId ());
   m_flowStartTime = Simulator::Now ();
 }
 
@@ -70,8 +106,28 @@ RoCEv2Socket::DoSendTo (Ptr<Packet> payload, Ipv4Address daddr, Ptr<Ipv4Route> r
 {
   NS_LOG_FUNCTION (this << payload << daddr << route);
 
-  RoCEv2Header rocev2Header = CreateNextProtocolHeader ();
-  m_buffer.Push (rocev2Header.GetPSN (), std::move (rocev2Header), payload, daddr, route);
+  // Only the size of the payload is kept. All packets of a socket share the
+  // same destination and route.
+  m_daddr = daddr;
+  m_route = route;
+  // the PSN wraps to 0 after 2^24 packets, which is not the first of the flow
+  const bool isFirst = m_buffer.GetPushedCount () == 0;
+  if (isFirst)
+    {
+      m_flowGeneration = DynamicCast<RoCEv2L4Protocol> (m_innerProto)->NextFlowGeneration ();
+    }
+  RoCEv2Header::Opcode opcode;
+  if (m_isLastPacketNext)
+    {
+      opcode = isFirst ? RoCEv2Header::Opcode::RC_SEND_ONLY : RoCEv2Header::Opcode::RC_SEND_LAST;
+      m_isLastPacketNext = false;
+      m_allPushed = true;
+    }
+  else
+    {
+      opcode = isFirst ? RoCEv2Header::Opcode::RC_SEND_FIRST : RoCEv2Header::Opcode::RC_SEND_MIDDLE;
+    }
+  m_buffer.Push (payload->GetSize (), opcode);
   SendPendingPacket ();
 }
 
@@ -86,23 +142,40 @@ RoCEv2Socket::SendPendingPacket ()
     }
   // rateRatio is controled by congestion control
   // rateRatio = sending rate calculated by CC / line rate, which is between [0.0., 1.0]
+  m_ccOps->Sync ();
   const double rateRatio =
       m_sockState->GetRateRatioPercent (); // in percentage, i.e., maximum is 100.0
   if (rateRatio > 1e-6)
     {
+      // A window-based CC lets at least one packet out
+      const uint32_t window = m_sockState->GetWindow ();
+      if (window != 0 && m_buffer.GetBytesInFlight () != 0 &&
+          m_buffer.GetBytesInFlight () + m_buffer.GetNextShouldSentSize () > window)
+        {
+          return; // sent again when an ACK opens the window
+        }
       m_isSending = true;
-      [[maybe_unused]] const auto &[_, rocev2Header, payload, daddr, route] =
-          m_buffer.GetNextShouldSent ();
-      const uint32_t sz = payload->GetSize () + 8 + 20 + 14;
-      // DCQCN is a rate based CC.
-      // Send packet and delay a bit time to control the sending rate.
+      DcbTxBuffer::DcbTxBufferItem &item = m_buffer.GetNextShouldSent ();
+      item.m_sendTime = Simulator::Now ();
+      Ptr<Packet> packet = Create<Packet> (item.m_payloadSize);
+      if (IsIntEnabled ())
+        {
+          packet->AddTrailer (IntTrailer ()); // filled by the switches
+        }
+      const uint32_t sz = packet->GetSize () + 8 + 20 + 14;
+      // Pace the packets at the rate of the CC.
       Time delay = m_deviceRate.CalculateBytesTxTime (sz * 100 / rateRatio);
-      m_ccOps->UpdateStateSend (payload);
-      Ptr<Packet> packet = payload->Copy (); // do not modify the payload in the buffer
-      packet->AddHeader (rocev2Header);
-      m_innerProto->Send (packet, route->GetSource (), daddr, m_endPoint->GetLocalPort (),
-                          m_endPoint->GetPeerPort (), route);
-      Simulator::Schedule (delay, &RoCEv2Socket::FinishSendPendingPacket, this);
+      AddSocketTags (packet);
+      m_ccOps->UpdateStateSend (packet);
+      packet->AddHeader (CreateProtocolHeader (item));
+      m_innerProto->Send (packet, m_route->GetSource (), m_daddr, m_endPoint->GetLocalPort (),
+                          m_endPoint->GetPeerPort (), m_route);
+      m_sendEvent = Simulator::Schedule (delay, &RoCEv2Socket::FinishSendPendingPacket, this);
+      if (!m_rto.IsZero () && !m_rtoEvent.IsRunning ())
+        {
+          m_lastProgress = Simulator::Now ();
+          m_rtoEvent = Simulator::Schedule (m_rto, &RoCEv2Socket::RetransmitTimeout, this);
+        }
     }
 }
 
@@ -134,7 +207,16 @@ RoCEv2Socket::ForwardUp (Ptr<Packet> packet, Ipv4Header header, uint32_t port,
                     << rocev2Header.GetDestQP ());
       break;
     default:
-      HandleDataPacket (packet, header, port, incomingInterface, rocev2Header);
+      if (rocev2Header.GetIntPresent ())
+        {
+          IntTrailer intTrailer;
+          packet->RemoveTrailer (intTrailer);
+          HandleDataPacket (packet, header, port, incomingInterface, rocev2Header, &intTrailer);
+        }
+      else
+        {
+          HandleDataPacket (packet, header, port, incomingInterface, rocev2Header, nullptr);
+        }
     }
 }
 
@@ -145,24 +227,48 @@ RoCEv2Socket::HandleACK (Ptr<Packet> packet, const RoCEv2Header &roce)
 
   AETHeader aeth;
   packet->RemoveHeader (aeth);
+  IntTrailer intTrailer;
+  if (roce.GetIntPresent ())
+    {
+      packet->RemoveTrailer (intTrailer);
+      m_intHopsTrace (roce.GetPSN (), intTrailer.GetHops ());
+    }
 
   switch (aeth.GetSyndromeType ())
     {
       case AETHeader::SyndromeType::FC_DISABLED: { // normal ACK
-        uint32_t psn = m_buffer.Pop ().m_psn; // packet acked, pop out from buffer
-        if (psn != roce.GetPSN ())
+        // ACKs are cumulative, so a lost ACK is covered by the next one
+        const DcbTxBuffer::DcbTxBufferItem *acked = m_buffer.FindPSN (roce.GetPSN ());
+        const Time rtt = acked ? Simulator::Now () - acked->m_sendTime : Time (0);
+        const uint32_t bytesInFlight = m_buffer.GetBytesInFlight ();
+        if (m_buffer.AckUntil (roce.GetPSN ()) == 0)
           {
-            NS_FATAL_ERROR ("RoCEv2 socket receive an ACK with PSN not expected");
+            break; // duplicated ACK
           }
-        if (psn + 1 == m_psnEnd)
+        m_lastProgress = Simulator::Now ();
+        RoCEv2AckInfo ackInfo;
+        ackInfo.psn = roce.GetPSN ();
+        ackInfo.nextPsn = m_buffer.GetNextPSN ();
+        ackInfo.ackedBytes = bytesInFlight - m_buffer.GetBytesInFlight ();
+        ackInfo.rtt = rtt;
+        ackInfo.intHops = roce.GetIntPresent () ? &intTrailer.GetHops () : nullptr;
+        m_ccOps->UpdateStateWithAck (ackInfo);
+        if (m_allPushed && m_buffer.Size () == 0)
           { // last ACk received, flow finshed
+            m_rtoEvent.Cancel ();
             NotifyFlowCompletes ();
             // a delay to handle remaining packets (e.g., CNP)
             // FIXME: do not use magic number
             NS_LOG_DEBUG ("RoCEv2Socket will close at "
                           << (Simulator::Now () + MicroSeconds (50)).GetMicroSeconds ()
                           << "us node " << Simulator::GetContext () << " qp " << roce.GetDestQP ());
-            Simulator::Schedule (MicroSeconds (50), &RoCEv2Socket::Close, this);
+            // hold a reference so that the socket outlives its flow until closed
+            Simulator::Schedule (MicroSeconds (50), &RoCEv2Socket::Close,
+                                 Ptr<RoCEv2Socket> (this));
+          }
+        else
+          {
+            SendPendingPacket (); // the ACK may open the window
           }
         break;
       }
@@ -178,7 +284,8 @@ RoCEv2Socket::HandleACK (Ptr<Packet> packet, const RoCEv2Header &roce)
 
 void
 RoCEv2Socket::HandleDataPacket (Ptr<Packet> packet, Ipv4Header header, uint32_t port,
-                                Ptr<Ipv4Interface> incomingInterface, const RoCEv2Header &roce)
+                                Ptr<Ipv4Interface> incomingInterface, const RoCEv2Header &roce,
+                                const IntTrailer *intTrailer)
 {
   NS_LOG_FUNCTION (this << packet);
 
@@ -189,9 +296,28 @@ RoCEv2Socket::HandleDataPacket (Ptr<Packet> packet, Ipv4Header header, uint32_t
   // TODO: fork the socket instead of using one as the receiver, i.e., m_receiverFlowInfo should be removed.
   if (flowInfoIter == m_receiverFlowInfo.end ())
     {
-      auto pp = m_receiverFlowInfo.emplace (std::move (flowId), FlowInfo{dstQP});
+      ExpireCompletedFlows ();
+      std::map<FlowIdentifier, CompletedFlow>::iterator completedIter =
+          m_completedFlows.find (flowId);
+      if (completedIter != m_completedFlows.end ())
+        {
+          const uint32_t psn = roce.GetPSN ();
+          // another generation is a new flow of a reused QP
+          const bool isNewFlow = roce.GetFlowGeneration () != completedIter->second.generation;
+          if (!isNewFlow && ((completedIter->second.lastPSN - psn) & 0xffffff) < 0x800000)
+            { // retransmitted because the final ACK is lost, ACK again so that the sender completes
+              NS_LOG_LOGIC ("RoCEv2 receiver " << Simulator::GetContext ()
+                                               << " receives PSN " << psn
+                                               << " of a completed flow");
+              Ptr<Packet> ack = RoCEv2L4Protocol::GenerateACK (dstQP, srcQP, psn);
+              m_innerProto->Send (ack, header.GetDestination (), header.GetSource (), dstQP,
+                                  srcQP, 0);
+              return;
+            }
+          m_completedFlows.erase (completedIter);
+        }
+      auto pp = m_receiverFlowInfo.emplace (flowId, FlowInfo{dstQP});
       flowInfoIter = std::move (pp.first);
-      // TODO: erase flowInfo after flow finishes
     }
 
   // Check ECN
@@ -207,34 +333,116 @@ RoCEv2Socket::HandleDataPacket (Ptr<Packet> packet, Ipv4Header header, uint32_t
   if (psn == expectedPSN)
     {
       flowInfoIter->second.nextPSN = (expectedPSN + 1) & 0xffffff;
+      flowInfoIter->second.nackSent = false;
       if (roce.GetAckQ ())
         { // send ACK
-          Ptr<Packet> ack = RoCEv2L4Protocol::GenerateACK (dstQP, srcQP, psn);
+          Ptr<Packet> ack = RoCEv2L4Protocol::GenerateACK (dstQP, srcQP, psn, intTrailer);
           m_innerProto->Send (ack, header.GetDestination (), header.GetSource (), dstQP, srcQP, 0);
         }
+      const RoCEv2Header::Opcode opcode = roce.GetOpcode ();
+      if (opcode == RoCEv2Header::Opcode::RC_SEND_LAST ||
+          opcode == RoCEv2Header::Opcode::RC_SEND_ONLY)
+        { // all packets of the flow received, tear down the flow
+          flowInfoIter->second.lastCNPEvent.Cancel ();
+          m_receiverFlowInfo.erase (flowInfoIter);
+          if (!m_completedFlowTimeout.IsZero ())
+            {
+              m_completedFlows[flowId] = {psn, roce.GetFlowGeneration (), Simulator::Now ()};
+              m_completedOrder.emplace_back (Simulator::Now (), flowId);
+              ExpireCompletedFlows ();
+            }
+        }
     }
-  else if (psn > expectedPSN)
-    { // packet out-of-order, send NACK
-      NS_LOG_LOGIC ("RoCEv2 receiver " << Simulator::GetContext () << "send NACK of flow " << srcQP
-                                       << "->" << dstQP);
-      Ptr<Packet> nack = RoCEv2L4Protocol::GenerateNACK (dstQP, srcQP, expectedPSN);
-      m_innerProto->Send (nack, header.GetDestination (), header.GetSource (), dstQP, srcQP,
-                          nullptr);
+  else if (((psn - expectedPSN) & 0xffffff) < 0x800000)
+    { // packet out-of-order, send NACK once until the expected packet arrives
+      if (!flowInfoIter->second.nackSent)
+        {
+          NS_LOG_LOGIC ("RoCEv2 receiver " << Simulator::GetContext () << "send NACK of flow "
+                                           << srcQP << "->" << dstQP);
+          Ptr<Packet> nack = RoCEv2L4Protocol::GenerateNACK (dstQP, srcQP, expectedPSN);
+          m_innerProto->Send (nack, header.GetDestination (), header.GetSource (), dstQP, srcQP,
+                              nullptr);
+          flowInfoIter->second.nackSent = true;
+        }
+      return; // dropped, will be retransmitted
     }
   else
-    {
-      NS_LOG_WARN ("RoCEv2 socket receives smaller PSN than expected, something wrong");
+    { // duplicated packet retransmitted by go-back-N, ACK again in case the ACK is lost
+      NS_LOG_LOGIC ("RoCEv2 receiver " << Simulator::GetContext () << " receives duplicated PSN "
+                                       << psn);
+      Ptr<Packet> ack =
+          RoCEv2L4Protocol::GenerateACK (dstQP, srcQP, (expectedPSN - 1) & 0xffffff);
+      m_innerProto->Send (ack, header.GetDestination (), header.GetSource (), dstQP, srcQP, 0);
+      return;
     }
 
   UdpBasedSocket::ForwardUp (packet, header, port, incomingInterface);
 }
 
 void
-RoCEv2Socket::GoBackN (uint32_t lostPSN) const
+RoCEv2Socket::GoBackN (uint32_t lostPSN)
 {
-  // DcbTxBuffer::DcbTxBufferItemI item = m_buffer.FindPSN(lostPSN);
-  NS_LOG_WARN ("Go-back-N not implemented. Packet lost or out-of-order happens. Sender is node "
-               << Simulator::GetContext () << " at time " << Simulator::Now ());
+  NS_LOG_FUNCTION (this << lostPSN);
+
+  if (m_buffer.Size () == 0)
+    {
+      return; // NACK of a flow already completed
+    }
+  // NACK carries the PSN expected by the receiver, so everything before it is received
+  if (lostPSN != m_buffer.Front ().m_psn)
+    {
+      m_buffer.AckUntil ((lostPSN - 1) & 0xffffff);
+    }
+  if (m_buffer.GoBackTo (lostPSN))
+    {
+      NS_LOG_LOGIC ("RoCEv2 sender " << Simulator::GetContext () << " goes back to PSN "
+                                     << lostPSN << " at time " << Simulator::Now ());
+      m_lastProgress = Simulator::Now ();
+      SendPendingPacket ();
+    }
+}
+
+void
+RoCEv2Socket::RetransmitTimeout ()
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_buffer.Size () == m_buffer.GetSizeToBeSent ())
+    {
+      return; // nothing in flight, rearmed by the next transmission
+    }
+  const Time deadline = m_lastProgress + m_rto;
+  if (Simulator::Now () < deadline)
+    { // the window moved since the timer was set
+      m_rtoEvent = Simulator::Schedule (deadline - Simulator::Now (),
+                                        &RoCEv2Socket::RetransmitTimeout, this);
+      return;
+    }
+  NS_LOG_LOGIC ("RoCEv2 sender " << Simulator::GetContext () << " timeout, go back to PSN "
+                                 << m_buffer.Front ().m_psn);
+  m_buffer.GoBackTo (m_buffer.Front ().m_psn);
+  m_lastProgress = Simulator::Now ();
+  m_rtoEvent = Simulator::Schedule (m_rto, &RoCEv2Socket::RetransmitTimeout, this);
+  SendPendingPacket ();
+}
+
+void
+RoCEv2Socket::ExpireCompletedFlows ()
+{
+  const Time now = Simulator::Now ();
+  while (!m_completedOrder.empty () &&
+         m_completedOrder.front ().first + m_completedFlowTimeout <= now)
+    {
+      std::map<FlowIdentifier, CompletedFlow>::iterator it =
+          m_completedFlows.find (m_completedOrder.front ().second);
+      // the QP may have completed a later flow, which is expired later
+      if (it != m_completedFlows.end () &&
+          it->second.completeTime == m_completedOrder.front ().first)
+        {
+          m_completedFlows.erase (it);
+        }
+      m_completedOrder.pop_front ();
+    }
 }
 
 void
@@ -298,10 +506,7 @@ RoCEv2Socket::BindToNetDevice (Ptr<NetDevice> netdevice)
   if (dcbDev)
     {
       m_deviceRate = dcbDev->GetDataRate ();
-      // double rai =
-      //     static_cast<double> (DataRate ("100Mbps").GetBitRate ()) / m_deviceRate.GetBitRate ();
-      // m_ccOps->SetRateAIRatio (rai);
-      // m_ccOps->SetRateHyperAIRatio (10 * rai);
+      m_ccOps->SetLineRate (m_deviceRate);
       m_ccOps->SetReady ();
     }
 }
@@ -318,12 +523,41 @@ RoCEv2Socket::BindToLocalPort (uint32_t port)
   return 0;
 }
 
+int
+RoCEv2Socket::Close ()
+{
+  NS_LOG_FUNCTION (this);
+
+  m_ccOps->Stop ();
+  m_rtoEvent.Cancel ();
+  m_sendEvent.Cancel ();
+  m_isSending = false;
+  return UdpBasedSocket::Close ();
+}
+
 void
 RoCEv2Socket::FinishSending ()
 {
   NS_LOG_FUNCTION (this);
 
-  m_psnEnd = m_senderNextPSN;
+  m_isLastPacketNext = true;
+}
+
+void
+RoCEv2Socket::Reset ()
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT_MSG (m_buffer.Size () == 0, "Reset a RoCEv2Socket with unacked packets");
+
+  UdpBasedSocket::Reset ();
+  m_buffer.Clear ();
+  m_route = nullptr;
+  m_sendEvent.Cancel ();
+  m_isSending = false;
+  m_isLastPacketNext = false;
+  m_allPushed = false;
+  m_flowStartTime = Simulator::Now ();
+  m_ccOps->Reset ();
 }
 
 void
@@ -332,27 +566,61 @@ RoCEv2Socket::SetStopTime (Time stopTime)
   m_ccOps->SetStopTime (stopTime);
 }
 
+void
+RoCEv2Socket::SetCongestionControl (TypeId tid)
+{
+  NS_LOG_FUNCTION (this << tid);
+  NS_ASSERT_MSG (!m_boundnetdevice, "Set the congestion control before binding the socket");
+  ObjectFactory factory (tid.GetName ());
+  m_ccOps = factory.Create<RoCEv2CongestionOps> ();
+  if (!m_ccOps)
+    {
+      NS_FATAL_ERROR (tid.GetName () << " is not a RoCEv2CongestionOps");
+    }
+  m_ccOps->SetSockState (m_sockState);
+}
+
+TypeId
+RoCEv2Socket::GetCongestionControl () const
+{
+  return m_ccOps->GetInstanceTypeId ();
+}
+
 Time
 RoCEv2Socket::GetFlowStartTime () const
 {
   return m_flowStartTime;
 }
 
+void
+RoCEv2Socket::SetRetransmitTimeout (Time rto)
+{
+  NS_LOG_FUNCTION (this << rto);
+  m_rto = rto;
+}
+
 RoCEv2Header
-RoCEv2Socket::CreateNextProtocolHeader ()
+RoCEv2Socket::CreateProtocolHeader (const DcbTxBuffer::DcbTxBufferItem &item) const
 {
   NS_LOG_FUNCTION (this);
 
   RoCEv2Header rocev2Header;
-  rocev2Header.SetOpcode (RoCEv2Header::Opcode::RC_SEND_ONLY); // TODO: custom opcode
+  rocev2Header.SetOpcode (item.m_opcode);
   rocev2Header.SetDestQP (m_endPoint->GetPeerPort ());
   rocev2Header.SetSrcQP (m_endPoint->GetLocalPort ());
-  rocev2Header.SetPSN (m_senderNextPSN);
+  rocev2Header.SetPSN (item.m_psn);
   rocev2Header.SetAckQ (true);
-  m_senderNextPSN = (m_senderNextPSN + 1) % 0xffffff;
+  rocev2Header.SetIntPresent (IsIntEnabled ());
+  rocev2Header.SetFlowGeneration (m_flowGeneration);
   return rocev2Header;
 }
 
+bool
+RoCEv2Socket::IsIntEnabled () const
+{
+  return m_intEnabled || m_ccOps->RequiresInt ();
+}
+
 NS_OBJECT_ENSURE_REGISTERED (DcbTxBuffer);
 
 TypeId
@@ -365,41 +633,42 @@ DcbTxBuffer::GetTypeId (void)
   return tid;
 }
 
-DcbTxBuffer::DcbTxBuffer () : m_sentIdx (0)
+DcbTxBuffer::DcbTxBuffer () : m_ring (64), m_head (0), m_next (0), m_tail (0), m_bytesInFlight (0)
 {
 }
 
-void
-DcbTxBuffer::Push (uint32_t psn, RoCEv2Header header, Ptr<Packet> packet, Ipv4Address daddr,
-                   Ptr<Ipv4Route> route)
+uint32_t
+DcbTxBuffer::Push (uint32_t payloadSize, RoCEv2Header::Opcode opcode)
 {
-  m_buffer.emplace_back (psn, header, packet, daddr, route);
+  if (m_tail - m_head == m_ring.size ())
+    { // full, double the ring and keep every packet at position (seq & mask)
+      std::vector<DcbTxBufferItem> ring (m_ring.size () * 2);
+      for (uint64_t seq = m_head; seq < m_tail; seq++)
+        {
+          ring[seq & (ring.size () - 1)] = m_ring[seq & (m_ring.size () - 1)];
+        }
+      m_ring.swap (ring);
+    }
+  const uint32_t psn = m_tail & PSN_MASK;
+  m_ring[m_tail & (m_ring.size () - 1)] = {psn, payloadSize, opcode};
+  m_tail++;
+  return psn;
 }
 
 const DcbTxBuffer::DcbTxBufferItem &
 DcbTxBuffer::Front () const
 {
-  return m_buffer.front ();
+  return m_ring[m_head & (m_ring.size () - 1)];
 }
 
-DcbTxBuffer::DcbTxBufferItem
-DcbTxBuffer::Pop ()
-{
-  DcbTxBuffer::DcbTxBufferItem item = std::move (m_buffer.front ());
-  m_buffer.pop_front ();
-  if (m_sentIdx)
-    {
-      m_sentIdx--;
-    }
-  return item;
-}
-
-const DcbTxBuffer::DcbTxBufferItem &
+DcbTxBuffer::DcbTxBufferItem &
 DcbTxBuffer::GetNextShouldSent ()
 {
-  if (m_buffer.size () - m_sentIdx)
+  if (m_next < m_tail)
     {
-      return m_buffer.at (m_sentIdx++);
+      DcbTxBufferItem &item = m_ring[m_next++ & (m_ring.size () - 1)];
+      m_bytesInFlight += item.m_payloadSize;
+      return item;
     }
   NS_FATAL_ERROR ("DcbTxBuffer has no packet to be sent.");
 }
@@ -407,39 +676,99 @@ DcbTxBuffer::GetNextShouldSent ()
 uint32_t
 DcbTxBuffer::Size () const
 {
-  return m_buffer.size ();
+  return m_tail - m_head;
 }
 
 uint32_t
 DcbTxBuffer::GetSizeToBeSent () const
 {
-  return m_buffer.size () - m_sentIdx;
+  return m_tail - m_next;
+}
+
+uint32_t
+DcbTxBuffer::GetNextShouldSentSize () const
+{
+  return m_ring[m_next & (m_ring.size () - 1)].m_payloadSize;
+}
+
+uint32_t
+DcbTxBuffer::GetBytesInFlight () const
+{
+  return m_bytesInFlight;
+}
+
+uint32_t
+DcbTxBuffer::GetNextPSN () const
+{
+  return m_next & PSN_MASK;
+}
+
+uint32_t
+DcbTxBuffer::GetTailPSN () const
+{
+  return m_tail & PSN_MASK;
+}
+
+uint64_t
+DcbTxBuffer::GetPushedCount () const
+{
+  return m_tail;
 }
 
-DcbTxBuffer::DcbTxBufferItemI
+uint64_t
+DcbTxBuffer::OffsetOf (uint32_t psn) const
+{
+  return (psn - m_head) & PSN_MASK;
+}
+
+const DcbTxBuffer::DcbTxBufferItem *
 DcbTxBuffer::FindPSN (uint32_t psn) const
 {
-  for (auto it = m_buffer.cbegin (); it != m_buffer.cend (); it++)
+  const uint64_t offset = OffsetOf (psn);
+  if (offset < Size ())
     {
-      if (psn == (*it).m_psn)
-        {
-          return it;
-        }
+      return &m_ring[(m_head + offset) & (m_ring.size () - 1)];
     }
-  return End ();
+  return nullptr;
 }
 
-DcbTxBuffer::DcbTxBufferItemI
-DcbTxBuffer::End () const
+uint32_t
+DcbTxBuffer::AckUntil (uint32_t psn)
 {
-  return m_buffer.cend ();
+  const uint64_t offset = OffsetOf (psn);
+  if (offset >= m_next - m_head)
+    { // not sent, or acked before
+      return 0;
+    }
+  for (uint64_t seq = m_head; seq <= m_head + offset; seq++)
+    {
+      m_bytesInFlight -= m_ring[seq & (m_ring.size () - 1)].m_payloadSize;
+    }
+  m_head += offset + 1;
+  return offset + 1;
 }
 
-DcbTxBuffer::DcbTxBufferItem::DcbTxBufferItem (uint32_t psn, RoCEv2Header header,
-                                               Ptr<Packet> payload, Ipv4Address daddr,
-                                               Ptr<Ipv4Route> route)
-    : m_psn (psn), m_header (header), m_payload (payload), m_daddr (daddr), m_route (route)
+bool
+DcbTxBuffer::GoBackTo (uint32_t psn)
+{
+  const uint64_t offset = OffsetOf (psn);
+  if (offset >= m_next - m_head)
+    {
+      return false;
+    }
+  for (uint64_t seq = m_head + offset; seq < m_next; seq++)
+    {
+      m_bytesInFlight -= m_ring[seq & (m_ring.size () - 1)].m_payloadSize;
+    }
+  m_next = m_head + offset;
+  return true;
+}
+
+void
+DcbTxBuffer::Clear ()
 {
+  m_head = m_next = m_tail = 0;
+  m_bytesInFlight = 0;
 }
 
 NS_OBJECT_ENSURE_REGISTERED (RoCEv2SocketState);
@@ -454,7 +783,7 @@ RoCEv2SocketState::GetTypeId ()
   return tid;
 }
 
-RoCEv2SocketState::RoCEv2SocketState () : m_rateRatio (100.)
+RoCEv2SocketState::RoCEv2SocketState () : m_rateRatio (100.), m_window (0)
 {
 }
 
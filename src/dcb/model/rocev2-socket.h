@@ -21,31 +21,40 @@
 #ifndef ROCEV2_SOCKET_H
 #define ROCEV2_SOCKET_H
 
-#include "dcqcn.h"
+#include "rocev2-congestion-ops.h"
+#include "ns3/event-id.h"
 #include "ns3/ipv4-address.h"
 #include "ns3/traced-callback.h"
 #include "udp-based-socket.h"
 #include "ns3/rocev2-header.h"
+#include <deque>
+#include <vector>
 
 namespace ns3 {
 
-class DcqcnCongestionOps;
 class RoCEv2SocketState;
 
+/**
+ * \brief The transmit window of a RoCEv2 sender.
+ *
+ * A ring buffer indexed by PSN. Only the payload size and the opcode are kept
+ * for each packet: the payload is generated again from its size and the
+ * header is rebuilt from the PSN when the packet is (re)transmitted. The ring
+ * grows by doubling when full, so steady state sending allocates nothing.
+ *
+ * The window is [head, tail): packets in [head, next) are sent but not acked
+ * and packets in [next, tail) are waiting to be sent. Positions are kept as
+ * unwrapped sequence numbers and the 24-bit PSN is the lower bits.
+ */
 class DcbTxBuffer : public Object
 {
 public:
   struct DcbTxBufferItem
   {
-    DcbTxBufferItem (uint32_t psn, RoCEv2Header header, Ptr<Packet> p, Ipv4Address daddr,
-                     Ptr<Ipv4Route> route);
-
     uint32_t m_psn;
-    RoCEv2Header m_header;
-    Ptr<Packet> m_payload;
-    Ipv4Address m_daddr;
-    Ptr<Ipv4Route> m_route;
-
+    uint32_t m_payloadSize;
+    RoCEv2Header::Opcode m_opcode;
+    Time m_sendTime; //!< when the packet was last (re)transmitted
   }; // class DcbTxBufferItem
 
   /**
@@ -56,25 +65,75 @@ public:
 
   DcbTxBuffer ();
 
-  typedef std::deque<DcbTxBufferItem>::const_iterator DcbTxBufferItemI;
-
-  void Push (uint32_t psn, RoCEv2Header header, Ptr<Packet> payload, Ipv4Address daddr,
-             Ptr<Ipv4Route> route);
+  /**
+   * \brief Append a packet to the tail of the window.
+   * \return the PSN assigned to the packet
+   */
+  uint32_t Push (uint32_t payloadSize, RoCEv2Header::Opcode opcode);
   const DcbTxBufferItem &Front () const;
-  DcbTxBufferItem Pop ();
-  const DcbTxBufferItem &GetNextShouldSent ();
+  DcbTxBufferItem &GetNextShouldSent ();
+  /**
+   * Number of packets not acked yet, including those not sent
+   */
   uint32_t Size () const;
   /**
    * Number of packets left to be sent
    */
   uint32_t GetSizeToBeSent () const;
+  /**
+   * Payload size of the next packet to be sent, which should exist
+   */
+  uint32_t GetNextShouldSentSize () const;
+  /**
+   * Payload bytes of the packets sent but not acked
+   */
+  uint32_t GetBytesInFlight () const;
+  /**
+   * PSN of the next packet to be sent
+   */
+  uint32_t GetNextPSN () const;
+  /**
+   * PSN that will be assigned to the next pushed packet
+   */
+  uint32_t GetTailPSN () const;
+  /**
+   * Number of packets pushed so far, which unlike the PSN does not wrap
+   */
+  uint64_t GetPushedCount () const;
+
+  /**
+   * \return the packet with the PSN, or nullptr if it is not in the window
+   */
+  const DcbTxBufferItem *FindPSN (uint32_t psn) const;
+
+  /**
+   * \brief Release the sent packets up to and including psn (cumulative ACK).
+   * \return number of packets released, 0 if psn is not a sent packet
+   */
+  uint32_t AckUntil (uint32_t psn);
+
+  /**
+   * \brief Go back to psn so that it and all packets after it are sent again.
+   * \return false if psn is not a sent packet
+   */
+  bool GoBackTo (uint32_t psn);
 
-  DcbTxBufferItemI FindPSN (uint32_t psn) const;
-  DcbTxBufferItemI End () const;
+  void Clear ();
 
 private:
-  std::deque<DcbTxBufferItem> m_buffer;
-  uint32_t m_sentIdx;
+  /**
+   * \brief Offset of psn from the head, which is not less than Size () if psn is
+   * not in the window.
+   */
+  uint64_t OffsetOf (uint32_t psn) const;
+
+  static const uint32_t PSN_MASK = 0xffffff;
+
+  std::vector<DcbTxBufferItem> m_ring; //!< capacity is always a power of 2
+  uint64_t m_head; //!< sequence of the oldest packet not acked
+  uint64_t m_next; //!< sequence of the next packet to be sent
+  uint64_t m_tail; //!< sequence of the next packet to be pushed
+  uint32_t m_bytesInFlight; //!< payload bytes in [head, next)
 
 }; // class DcbTxBuffer
 
@@ -102,6 +161,21 @@ public:
     return m_rateRatio;
   }
 
+  /**
+   * \brief Limit the payload bytes in flight, 0 for no limit.
+   */
+  inline void
+  SetWindow (uint32_t bytes)
+  {
+    m_window = bytes;
+  }
+
+  inline uint32_t
+  GetWindow () const
+  {
+    return m_window;
+  }
+
 private:
   /**
    * Instead of directly store sending rate here, we store a rate ratio.
@@ -109,6 +183,7 @@ private:
    * In this way, this class is totally decoupled with others.
    */
   double m_rateRatio;
+  uint32_t m_window; //!< limit of the bytes in flight, 0 for no limit
 
 }; // class RoCEv2SocketState
 
@@ -130,12 +205,37 @@ public:
 
   int BindToLocalPort (uint32_t port);
 
+  virtual int Close (void) override;
+
   virtual void FinishSending () override;
 
-  void SetStopTime (Time stopTime); // for DCQCN
+  virtual void Reset () override;
+
+  void SetStopTime (Time stopTime); // for the congestion control
+
+  /**
+   * \brief Use a new congestion control of the type tid, a subclass of
+   * RoCEv2CongestionOps.
+   */
+  void SetCongestionControl (TypeId tid);
+  TypeId GetCongestionControl () const;
 
   Time GetFlowStartTime () const;
 
+  /**
+   * \brief Set the retransmission timeout. Zero disables it.
+   * Needed only when packets can be lost, i.e., PFC is disabled.
+   */
+  void SetRetransmitTimeout (Time rto);
+
+  /**
+   * TracedCallback signature for the INT hops carried by an ACK.
+   *
+   * \param [in] psn the acked PSN
+   * \param [in] hops the telemetry of the path of the acked packet
+   */
+  typedef void (*IntHopsTracedCallback) (uint32_t psn, const std::vector<IntHop> &hops);
+
 protected:
   virtual void DoSendTo (Ptr<Packet> p, Ipv4Address daddr, Ptr<Ipv4Route> route) override;
 
@@ -151,36 +251,73 @@ private:
     uint32_t dstQP;
     uint32_t nextPSN;
     bool receivedECN;
+    bool nackSent; //!< a NACK of nextPSN is sent, do not repeat it
     EventId lastCNPEvent;
     FlowInfo (uint32_t dst)
-        : dstQP (dst), nextPSN (0), receivedECN (false)
+        : dstQP (dst), nextPSN (0), receivedECN (false), nackSent (false)
     {
     }
   };
 
   typedef std::pair<Ipv4Address, uint32_t> FlowIdentifier;  
 
-  RoCEv2Header CreateNextProtocolHeader ();
+  struct CompletedFlow // for receiver
+  {
+    uint32_t lastPSN;
+    uint8_t generation; //!< see RoCEv2Header::GetFlowGeneration
+    Time completeTime;
+  };
+
+  RoCEv2Header CreateProtocolHeader (const DcbTxBuffer::DcbTxBufferItem &item) const;
   void HandleACK (Ptr<Packet> packet, const RoCEv2Header &roce);
+  /**
+   * \param intTrailer the INT trailer removed from the packet, null if it has none
+   */
   void HandleDataPacket (Ptr<Packet> packet, Ipv4Header header, uint32_t port,
-                         Ptr<Ipv4Interface> incomingInterface, const RoCEv2Header &roce);
-  void GoBackN (uint32_t lostPSN) const;
+                         Ptr<Ipv4Interface> incomingInterface, const RoCEv2Header &roce,
+                         const IntTrailer *intTrailer);
+  void GoBackN (uint32_t lostPSN);
+  /**
+   * \return whether the data packets sent carry an IntTrailer
+   */
+  bool IsIntEnabled () const;
+  void RetransmitTimeout ();
   void ScheduleNextCNP (std::map<FlowIdentifier, FlowInfo>::iterator flowInfoIter, Ipv4Header header);
+  /**
+   * \brief Forget the flows completed more than m_completedFlowTimeout ago.
+   */
+  void ExpireCompletedFlows ();
 
   // Time CalcTxTime (uint32_t bytes);
 
-  Ptr<DcqcnCongestionOps> m_ccOps; //!< DCQCN congestion control
-  Ptr<RoCEv2SocketState> m_sockState; //!< DCQCN socket state
+  Ptr<RoCEv2CongestionOps> m_ccOps; //!< congestion control
+  Ptr<RoCEv2SocketState> m_sockState; //!< socket state controlled by m_ccOps
   DcbTxBuffer m_buffer;
+  Ipv4Address m_daddr; //!< destination of the packets in m_buffer
+  Ptr<Ipv4Route> m_route; //!< route of the packets in m_buffer
   DataRate m_deviceRate;
   bool m_isSending;
+  EventId m_sendEvent; //!< the end of pacing the packet being sent, which clears m_isSending
+  bool m_isLastPacketNext; //!< whether the next packet sent is the last one of the flow
+  bool m_allPushed; //!< the last packet of the flow is in m_buffer, used to check if flow completes
+  uint8_t m_flowGeneration; //!< generation of the flow being sent
 
-  uint32_t m_senderNextPSN;
   std::map<FlowIdentifier, FlowInfo> m_receiverFlowInfo;
-  uint32_t m_psnEnd; //!< the last PSN + 1, used to check if flow completes
+  /// the recently completed flows, to ACK their retransmissions if the final ACK is lost
+  std::map<FlowIdentifier, CompletedFlow> m_completedFlows;
+  /// the completed flows in the order of completion, to expire them
+  std::deque<std::pair<Time, FlowIdentifier>> m_completedOrder;
+  Time m_completedFlowTimeout; //!< how long a completed flow is remembered
+
+  Time m_rto; //!< retransmission timeout, zero means disabled
+  Time m_lastProgress; //!< last time the window moved forward
+  EventId m_rtoEvent;
 
   Time m_flowStartTime;
 
+  bool m_intEnabled; //!< add an IntTrailer even if the congestion control does not need it
+  TracedCallback<uint32_t, const std::vector<IntHop> &> m_intHopsTrace;
+
 }; // class RoCEv2Socket
 
 } // namespace ns3
@@ -0,0 +1,153 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#include "swift.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+#include "rocev2-socket.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("SwiftCongestionOps");
+
+NS_OBJECT_ENSURE_REGISTERED (SwiftCongestionOps);
+
+TypeId
+SwiftCongestionOps::GetTypeId ()
+{
+  static TypeId tid =
+      TypeId ("ns3::SwiftCongestionOps")
+          .SetParent<RoCEv2CongestionOps> ()
+          .SetGroupName ("Dcb")
+          .AddConstructor<SwiftCongestionOps> ()
+          .AddAttribute ("BaseTarget", "The target delay without hop scaling",
+                         TimeValue (MicroSeconds (25)),
+                         MakeTimeAccessor (&SwiftCongestionOps::m_baseTarget), MakeTimeChecker ())
+          .AddAttribute ("HopScaling", "The target delay added per hop of the path",
+                         TimeValue (MicroSeconds (1)),
+                         MakeTimeAccessor (&SwiftCongestionOps::m_hopScaling), MakeTimeChecker ())
+          .AddAttribute ("AdditiveIncrease", "Additive increase in packets per RTT",
+                         DoubleValue (1.), MakeDoubleAccessor (&SwiftCongestionOps::m_ai),
+                         MakeDoubleChecker<double> (0.))
+          .AddAttribute ("Beta", "Multiplicative decrease factor", DoubleValue (0.8),
+                         MakeDoubleAccessor (&SwiftCongestionOps::m_beta),
+                         MakeDoubleChecker<double> (0., 1.))
+          .AddAttribute ("MaxMdf", "Maximum multiplicative decrease per RTT", DoubleValue (0.5),
+                         MakeDoubleAccessor (&SwiftCongestionOps::m_maxMdf),
+                         MakeDoubleChecker<double> (0., 1.))
+          .AddAttribute ("MinCwnd", "Minimum window in packets", DoubleValue (0.001),
+                         MakeDoubleAccessor (&SwiftCongestionOps::m_minCwnd),
+                         MakeDoubleChecker<double> (0.))
+          .AddAttribute ("MaxCwnd", "Maximum window in packets", DoubleValue (1000.),
+                         MakeDoubleAccessor (&SwiftCongestionOps::m_maxCwnd),
+                         MakeDoubleChecker<double> (1.))
+          .AddAttribute ("InitialCwnd", "Window of a new flow in packets", DoubleValue (100.),
+                         MakeDoubleAccessor (&SwiftCongestionOps::m_initCwnd),
+                         MakeDoubleChecker<double> (1.))
+          .AddAttribute ("Mss", "Payload bytes of a full packet", UintegerValue (1000),
+                         MakeUintegerAccessor (&SwiftCongestionOps::m_mss),
+                         MakeUintegerChecker<uint32_t> (1));
+  return tid;
+}
+
+SwiftCongestionOps::SwiftCongestionOps ()
+    : m_ai (1.),
+      m_beta (0.8),
+      m_maxMdf (0.5),
+      m_minCwnd (0.001),
+      m_maxCwnd (1000.),
+      m_initCwnd (100.),
+      m_mss (1000),
+      m_cwnd (100.)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SwiftCongestionOps::~SwiftCongestionOps ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SwiftCongestionOps::SetReady ()
+{
+  NS_LOG_FUNCTION (this);
+  Reset ();
+}
+
+void
+SwiftCongestionOps::Reset ()
+{
+  NS_LOG_FUNCTION (this);
+  m_lastDecrease = Time (0);
+  SetCwnd (m_initCwnd, Time (0));
+}
+
+void
+SwiftCongestionOps::UpdateStateWithAck (const RoCEv2AckInfo &ack)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (ack.rtt.IsZero ())
+    {
+      return;
+    }
+  Time target = m_baseTarget;
+  if (ack.intHops)
+    {
+      target += m_hopScaling * static_cast<int64_t> (ack.intHops->size ());
+    }
+
+  const double acked = static_cast<double> (ack.ackedBytes) / m_mss;
+  double cwnd = m_cwnd;
+  if (ack.rtt < target)
+    {
+      cwnd += cwnd >= 1. ? m_ai / cwnd * acked : m_ai * acked;
+    }
+  else if (Simulator::Now () - m_lastDecrease >= ack.rtt)
+    {
+      const double excess = (ack.rtt - target).GetSeconds () / ack.rtt.GetSeconds ();
+      cwnd *= std::max (1 - m_beta * excess, 1 - m_maxMdf);
+      m_lastDecrease = Simulator::Now ();
+    }
+  SetCwnd (cwnd, ack.rtt);
+}
+
+void
+SwiftCongestionOps::SetCwnd (double cwnd, Time rtt)
+{
+  m_cwnd = std::max (std::min (cwnd, m_maxCwnd), m_minCwnd);
+  if (m_cwnd >= 1. || rtt.IsZero ())
+    {
+      m_sockState->SetWindow (static_cast<uint32_t> (std::round (std::max (m_cwnd, 1.) * m_mss)));
+      SetRate (m_lineRate);
+    }
+  else
+    { // one packet every rtt / cwnd
+      m_sockState->SetWindow (m_mss);
+      SetRate (DataRate (static_cast<uint64_t> (m_cwnd * m_mss * 8 / rtt.GetSeconds ())));
+    }
+  NS_LOG_DEBUG ("Swift: RTT " << rtt.GetMicroSeconds () << "us cwnd " << m_cwnd
+                              << " at time " << Simulator::Now ().GetMicroSeconds () << "us");
+}
+
+} // namespace ns3
@@ -0,0 +1,71 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#ifndef SWIFT_H
+#define SWIFT_H
+
+#include "rocev2-congestion-ops.h"
+
+namespace ns3 {
+
+/**
+ * The Swift implementation according to paper:
+ *   Kumar, Gautam, et al. "Swift: Delay is simple and effective for congestion
+ *   control in the datacenter." ACM SIGCOMM.
+ *   \url https://dl.acm.org/doi/10.1145/3387514.3406591
+ *
+ * A window of packets grows additively while the RTT is below the target
+ * delay and shrinks at most once per RTT in proportion to the excess delay.
+ * A window below one packet is enforced by pacing.  The target delay is scaled
+ * by the hops of the path when the ACKs carry INT hops; there is no flow-based
+ * scaling and no reaction to retransmissions.
+ */
+class SwiftCongestionOps : public RoCEv2CongestionOps
+{
+public:
+  static TypeId GetTypeId (void);
+
+  SwiftCongestionOps ();
+  ~SwiftCongestionOps ();
+
+  void SetReady () override;
+
+  void Reset () override;
+
+  void UpdateStateWithAck (const RoCEv2AckInfo &ack) override;
+
+private:
+  void SetCwnd (double cwnd, Time rtt);
+
+  Time m_baseTarget; //!< the target delay without hop scaling
+  Time m_hopScaling; //!< the target delay added per hop
+  double m_ai; //!< additive increase in packets per RTT
+  double m_beta; //!< multiplicative decrease factor
+  double m_maxMdf; //!< maximum multiplicative decrease per RTT
+  double m_minCwnd; //!< in packets
+  double m_maxCwnd; //!< in packets
+  double m_initCwnd; //!< in packets
+  uint32_t m_mss; //!< bytes of a full packet
+
+  double m_cwnd; //!< the window in packets
+  Time m_lastDecrease;
+}; // class SwiftCongestionOps
+
+} // namespace ns3
+
+#endif // SWIFT_H
@@ -0,0 +1,159 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#include "timely.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+#include "rocev2-socket.h"
+#include <algorithm>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("TimelyCongestionOps");
+
+NS_OBJECT_ENSURE_REGISTERED (TimelyCongestionOps);
+
+TypeId
+TimelyCongestionOps::GetTypeId ()
+{
+  static TypeId tid =
+      TypeId ("ns3::TimelyCongestionOps")
+          .SetParent<RoCEv2CongestionOps> ()
+          .SetGroupName ("Dcb")
+          .AddConstructor<TimelyCongestionOps> ()
+          .AddAttribute ("Alpha", "EWMA weight of a new RTT difference", DoubleValue (0.875),
+                         MakeDoubleAccessor (&TimelyCongestionOps::m_alpha),
+                         MakeDoubleChecker<double> (0., 1.))
+          .AddAttribute ("Beta", "Multiplicative decrease factor", DoubleValue (0.8),
+                         MakeDoubleAccessor (&TimelyCongestionOps::m_beta),
+                         MakeDoubleChecker<double> (0., 1.))
+          .AddAttribute ("Delta", "Additive increase step", DataRateValue (DataRate ("10Mbps")),
+                         MakeDataRateAccessor (&TimelyCongestionOps::m_delta),
+                         MakeDataRateChecker ())
+          .AddAttribute ("TLow", "Below this RTT the rate always increases",
+                         TimeValue (MicroSeconds (50)),
+                         MakeTimeAccessor (&TimelyCongestionOps::m_tLow), MakeTimeChecker ())
+          .AddAttribute ("THigh", "Above this RTT the rate always decreases",
+                         TimeValue (MicroSeconds (500)),
+                         MakeTimeAccessor (&TimelyCongestionOps::m_tHigh), MakeTimeChecker ())
+          .AddAttribute ("MinRtt", "The RTT that normalizes the RTT gradient",
+                         TimeValue (MicroSeconds (20)),
+                         MakeTimeAccessor (&TimelyCongestionOps::m_minRtt), MakeTimeChecker ())
+          .AddAttribute ("HaiThreshold",
+                         "Rounds of non-positive gradient before increasing by 5 steps",
+                         UintegerValue (5),
+                         MakeUintegerAccessor (&TimelyCongestionOps::m_haiThreshold),
+                         MakeUintegerChecker<uint32_t> ())
+          .AddAttribute ("MinRate", "The minimum rate", DataRateValue (DataRate ("100Mbps")),
+                         MakeDataRateAccessor (&TimelyCongestionOps::m_minRate),
+                         MakeDataRateChecker ());
+  return tid;
+}
+
+TimelyCongestionOps::TimelyCongestionOps ()
+    : m_alpha (0.875),
+      m_beta (0.8),
+      m_haiThreshold (5),
+      m_rate (0.),
+      m_rttDiff (0.),
+      m_negGradientCount (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+TimelyCongestionOps::~TimelyCongestionOps ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+TimelyCongestionOps::SetReady ()
+{
+  NS_LOG_FUNCTION (this);
+  Reset ();
+}
+
+void
+TimelyCongestionOps::Reset ()
+{
+  NS_LOG_FUNCTION (this);
+  m_rate = m_lineRate.GetBitRate ();
+  m_prevRtt = Time (0);
+  m_rttDiff = 0.;
+  m_negGradientCount = 0;
+  ResetRounds ();
+  SetRate (m_lineRate);
+}
+
+void
+TimelyCongestionOps::UpdateStateWithAck (const RoCEv2AckInfo &ack)
+{
+  NS_LOG_FUNCTION (this);
+
+  // One update per RTT, as the paper updates once per completion of a segment
+  if (!ack.rtt.IsZero () && IsNewRound (ack))
+    {
+      UpdateRate (ack.rtt);
+    }
+}
+
+void
+TimelyCongestionOps::UpdateRate (Time rtt)
+{
+  if (m_prevRtt.IsZero ())
+    {
+      m_prevRtt = rtt;
+      return;
+    }
+  const double newRttDiff = (rtt - m_prevRtt).GetSeconds ();
+  m_prevRtt = rtt;
+  m_rttDiff = (1 - m_alpha) * m_rttDiff + m_alpha * newRttDiff;
+  const double gradient = m_rttDiff / m_minRtt.GetSeconds ();
+
+  const double delta = m_delta.GetBitRate ();
+  if (rtt < m_tLow)
+    {
+      m_rate += delta;
+      m_negGradientCount = 0;
+    }
+  else if (rtt > m_tHigh)
+    {
+      m_rate *= 1 - m_beta * (1 - m_tHigh.GetSeconds () / rtt.GetSeconds ());
+      m_negGradientCount = 0;
+    }
+  else if (gradient <= 0)
+    {
+      m_negGradientCount++;
+      m_rate += m_negGradientCount >= m_haiThreshold ? 5 * delta : delta;
+    }
+  else
+    {
+      m_rate *= 1 - m_beta * std::min (gradient, 1.);
+      m_negGradientCount = 0;
+    }
+  m_rate = std::max (std::min (m_rate, static_cast<double> (m_lineRate.GetBitRate ())),
+                     static_cast<double> (m_minRate.GetBitRate ()));
+  SetRate (DataRate (static_cast<uint64_t> (m_rate)));
+  NS_LOG_DEBUG ("TIMELY: RTT " << rtt.GetMicroSeconds () << "us gradient " << gradient
+                               << " rate " << m_rate << "bps at time "
+                               << Simulator::Now ().GetMicroSeconds () << "us");
+}
+
+} // namespace ns3
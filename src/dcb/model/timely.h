@@ -0,0 +1,69 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#ifndef TIMELY_H
+#define TIMELY_H
+
+#include "rocev2-congestion-ops.h"
+
+namespace ns3 {
+
+/**
+ * The TIMELY implementation according to paper:
+ *   Mittal, Radhika, et al. "TIMELY: RTT-based congestion control for the
+ *   datacenter." ACM SIGCOMM.
+ *   \url https://dl.acm.org/doi/10.1145/2829988.2787510
+ *
+ * The rate is updated once per RTT from the RTT of the acked packet and its
+ * gradient, measured by the sender from the time the packet was sent.
+ */
+class TimelyCongestionOps : public RoCEv2CongestionOps
+{
+public:
+  static TypeId GetTypeId (void);
+
+  TimelyCongestionOps ();
+  ~TimelyCongestionOps ();
+
+  void SetReady () override;
+
+  void Reset () override;
+
+  void UpdateStateWithAck (const RoCEv2AckInfo &ack) override;
+
+private:
+  void UpdateRate (Time rtt);
+
+  double m_alpha; //!< EWMA weight of a new RTT difference
+  double m_beta; //!< multiplicative decrease factor
+  DataRate m_delta; //!< additive increase step
+  Time m_tLow; //!< below this RTT the rate always increases
+  Time m_tHigh; //!< above this RTT the rate always decreases
+  Time m_minRtt; //!< normalizes the RTT gradient
+  uint32_t m_haiThreshold; //!< rounds of negative gradient before hyper additive increase
+  DataRate m_minRate;
+
+  double m_rate; //!< current rate in bps
+  Time m_prevRtt; //!< zero before the first RTT sample
+  double m_rttDiff; //!< EWMA of the RTT differences in seconds
+  uint32_t m_negGradientCount; //!< consecutive rounds with a non-positive gradient
+}; // class TimelyCongestionOps
+
+} // namespace ns3
+
+#endif // TIMELY_H
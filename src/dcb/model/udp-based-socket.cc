@@ -164,6 +164,7 @@ UdpBasedSocket::Close (void)
   // m_endPoint->SetDestroyCallback (MakeNullCallback<void> ());
   m_innerProto->DeAllocate (m_endPoint);
   m_endPoint = 0;
+  NotifyNormalClose ();
   return 0;
 }
 
@@ -265,23 +266,7 @@ UdpBasedSocket::DoSend (Ptr<Packet> p)
           m_errno = ERROR_MSGSIZE;
           return -1;
         }
-      uint8_t tos = GetIpTos ();
-      uint8_t priority = GetPriority ();
-      if (tos)
-        {
-          SocketIpTosTag ipTosTag;
-          ipTosTag.SetTos (tos);
-          // This packet may already have a SocketIpTosTag (see BUG 2440)
-          p->ReplacePacketTag (ipTosTag);
-          priority = IpTos2Priority (tos);
-        }
-
-      if (priority)
-        {
-          SocketPriorityTag priorityTag;
-          priorityTag.SetPriority (priority);
-          p->ReplacePacketTag (priorityTag);
-        }
+      AddSocketTags (p);
       Ptr<Ipv4> ipv4 = m_node->GetObject<Ipv4> ();
       // Not supporting:
       //   1. multicast
@@ -340,6 +325,28 @@ UdpBasedSocket::DoSend (Ptr<Packet> p)
   return -1;
 }
 
+void
+UdpBasedSocket::AddSocketTags (Ptr<Packet> p) const
+{
+  uint8_t tos = GetIpTos ();
+  uint8_t priority = GetPriority ();
+  if (tos)
+    {
+      SocketIpTosTag ipTosTag;
+      ipTosTag.SetTos (tos);
+      // This packet may already have a SocketIpTosTag (see BUG 2440)
+      p->ReplacePacketTag (ipTosTag);
+      priority = IpTos2Priority (tos);
+    }
+
+  if (priority)
+    {
+      SocketPriorityTag priorityTag;
+      priorityTag.SetPriority (priority);
+      p->ReplacePacketTag (priorityTag);
+    }
+}
+
 void
 UdpBasedSocket::DoSendTo (Ptr<Packet> p, Ipv4Address daddr, Ptr<Ipv4Route> route)
 {
@@ -529,6 +536,19 @@ UdpBasedSocket::FinishSending ()
   NS_LOG_FUNCTION (this);
 }
 
+void
+UdpBasedSocket::Reset ()
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT_MSG (m_endPoint == 0, "Only a closed UdpBasedSocket can be reset");
+
+  m_shutdownSend = false;
+  m_shutdownRecv = false;
+  m_connected = false;
+  m_rxUsed = 0;
+  m_deliveryQueue = {};
+}
+
 void
 UdpBasedSocket::SetFlowCompleteCallback (Callback<void, Ptr<UdpBasedSocket>> cb)
 {
@@ -344,8 +344,18 @@ public:
   void SetRcvBufSize (uint32_t size);
   uint32_t GetRcvBufSize () const;
 
+  /**
+   * \brief Tell the socket that the next packet passed to Send is the last one of the flow.
+   */
   virtual void FinishSending ();
 
+  /**
+   * \brief Bring a closed socket back to its initial state so that it can be
+   * bound and connected again for a new flow.
+   * The bound net device and the callbacks are kept.
+   */
+  virtual void Reset ();
+
   virtual uint32_t GetSrcPort () const;
   virtual uint32_t GetDstPort () const;
 
@@ -373,6 +383,12 @@ protected:
 
   virtual void DoSendTo (Ptr<Packet> p, Ipv4Address daddr, Ptr<Ipv4Route> route);
 
+  /**
+   * \brief Add the IP TOS and priority tags of this socket to a packet.
+   * \param p the packet
+   */
+  void AddSocketTags (Ptr<Packet> p) const;
+
   virtual void NotifyFlowCompletes ();
 
   Ptr<Node> m_node; //!< the associated node
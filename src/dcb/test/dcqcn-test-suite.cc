@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/dcqcn.h"
+#include "ns3/packet.h"
+#include "ns3/rocev2-socket.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \brief Test that DCQCN with lazy timers follows the same rate and alpha as
+ * with real timers.
+ *
+ * Two DcqcnCongestionOps, one of each mode, get the same CNPs and sent bytes
+ * and are compared at times between them, including after the stop time.
+ * The events avoid the expirations of the timers, whose order with an event
+ * at the same time differs between the modes.
+ */
+class DcqcnLazyTimersTest : public TestCase
+{
+public:
+  DcqcnLazyTimersTest ();
+
+private:
+  virtual void DoRun (void);
+
+  Ptr<DcqcnCongestionOps> CreateDcqcn (bool lazy, Ptr<RoCEv2SocketState> sockState);
+
+  void ReceiveCnp ();
+  void SendBytes (uint32_t packets);
+  void Compare ();
+
+  static constexpr uint32_t PACKET_SIZE = 1000; //!< bytes of each packet sent
+
+  Ptr<DcqcnCongestionOps> m_timer; //!< with real timers
+  Ptr<DcqcnCongestionOps> m_lazy; //!< with lazy timers
+  Ptr<RoCEv2SocketState> m_timerState; //!< the socket state of m_timer
+  Ptr<RoCEv2SocketState> m_lazyState; //!< the socket state of m_lazy
+};
+
+DcqcnLazyTimersTest::DcqcnLazyTimersTest ()
+    : TestCase ("DCQCN with lazy timers has the same rate and alpha as with real timers")
+{
+}
+
+Ptr<DcqcnCongestionOps>
+DcqcnLazyTimersTest::CreateDcqcn (bool lazy, Ptr<RoCEv2SocketState> sockState)
+{
+  Ptr<DcqcnCongestionOps> dcqcn = CreateObject<DcqcnCongestionOps> ();
+  dcqcn->SetAttribute ("LazyTimers", BooleanValue (lazy));
+  sockState->SetRateRatioPercent (100.);
+  dcqcn->SetSockState (sockState);
+  dcqcn->SetStopTime (MicroSeconds (500));
+  dcqcn->SetReady ();
+  return dcqcn;
+}
+
+void
+DcqcnLazyTimersTest::ReceiveCnp ()
+{
+  m_timer->UpdateStateWithCNP ();
+  m_lazy->UpdateStateWithCNP ();
+}
+
+void
+DcqcnLazyTimersTest::SendBytes (uint32_t packets)
+{
+  for (uint32_t i = 0; i < packets; i++)
+    {
+      m_timer->UpdateStateSend (Create<Packet> (PACKET_SIZE));
+      m_lazy->UpdateStateSend (Create<Packet> (PACKET_SIZE));
+    }
+}
+
+void
+DcqcnLazyTimersTest::Compare ()
+{
+  m_timer->Sync ();
+  m_lazy->Sync ();
+  const double rate = m_timerState->GetRateRatioPercent ();
+  const double alpha = m_timer->GetAlpha ();
+  NS_TEST_EXPECT_MSG_EQ_TOL (m_lazyState->GetRateRatioPercent (), rate, rate * 1e-9,
+                             "The rates differ at " << Simulator::Now ().As (Time::US));
+  NS_TEST_EXPECT_MSG_EQ_TOL (m_lazy->GetAlpha (), alpha, alpha * 1e-9,
+                             "The alphas differ at " << Simulator::Now ().As (Time::US));
+}
+
+void
+DcqcnLazyTimersTest::DoRun (void)
+{
+  m_timerState = CreateObject<RoCEv2SocketState> ();
+  m_lazyState = CreateObject<RoCEv2SocketState> ();
+  m_timer = CreateDcqcn (false, m_timerState);
+  m_lazy = CreateDcqcn (true, m_lazyState);
+
+  // A CNP restarts the timers, which then expire at the same offset within a
+  // microsecond, so each event is at an offset other than that of the last CNP
+  for (uint64_t ns : {3300, 10550, 50810, 51930, 53070, 200420, 499160})
+    {
+      Simulator::Schedule (NanoSeconds (ns), &DcqcnLazyTimersTest::ReceiveCnp, this);
+    }
+  // 200 packets are one update of the byte counter
+  for (uint64_t ns : {12700, 60700, 61700, 62700, 300700})
+    {
+      Simulator::Schedule (NanoSeconds (ns), &DcqcnLazyTimersTest::SendBytes, this, 200);
+    }
+  for (uint64_t ns : {5050, 11050, 30050, 50700, 55050, 61050, 120050, 250050, 400050, 499700,
+                      600050, 1000050})
+    {
+      Simulator::Schedule (NanoSeconds (ns), &DcqcnLazyTimersTest::Compare, this);
+    }
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_LT (m_timerState->GetRateRatioPercent (), 100.,
+                         "The rate should not recover after the stop time");
+  Simulator::Destroy ();
+}
+
+/**
+ * \brief TestSuite for DcqcnCongestionOps
+ */
+class DcqcnTestSuite : public TestSuite
+{
+public:
+  DcqcnTestSuite ();
+};
+
+DcqcnTestSuite::DcqcnTestSuite () : TestSuite ("dcb-dcqcn", UNIT)
+{
+  AddTestCase (new DcqcnLazyTimersTest, TestCase::QUICK);
+}
+
+static DcqcnTestSuite g_dcqcnTestSuite; //!< The testsuite
@@ -0,0 +1,271 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+#include "ns3/dcb-channel.h"
+#include "ns3/dcb-host-stack-helper.h"
+#include "ns3/dcb-net-device.h"
+#include "ns3/drop-tail-queue.h"
+#include "ns3/error-model.h"
+#include "ns3/ethernet-header.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/ipv4.h"
+#include "ns3/pointer.h"
+#include "ns3/rocev2-header.h"
+#include "ns3/rocev2-l4-protocol.h"
+#include "ns3/rocev2-socket.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/udp-based-socket.h"
+#include "ns3/udp-header.h"
+#include <set>
+
+using namespace ns3;
+
+/**
+ * \brief Drops the first ACK of some PSNs, the other packets pass.
+ */
+class DropAckErrorModel : public ErrorModel
+{
+public:
+  /**
+   * \param psns the PSNs whose first ACK is dropped
+   */
+  DropAckErrorModel (const std::set<uint32_t> &psns);
+
+  /**
+   * \return the number of ACKs dropped
+   */
+  uint32_t GetDropped () const;
+
+private:
+  virtual bool DoCorrupt (Ptr<Packet> p);
+  virtual void DoReset (void);
+
+  std::set<uint32_t> m_psns; //!< the PSNs whose ACK is not dropped yet
+  uint32_t m_dropped; //!< the number of ACKs dropped
+};
+
+DropAckErrorModel::DropAckErrorModel (const std::set<uint32_t> &psns)
+    : m_psns (psns), m_dropped (0)
+{
+}
+
+uint32_t
+DropAckErrorModel::GetDropped () const
+{
+  return m_dropped;
+}
+
+bool
+DropAckErrorModel::DoCorrupt (Ptr<Packet> p)
+{
+  if (m_psns.empty ())
+    {
+      return false;
+    }
+  Ptr<Packet> copy = p->Copy ();
+  EthernetHeader ethHeader;
+  Ipv4Header ipv4Header;
+  UdpHeader udpHeader;
+  RoCEv2Header roce;
+  copy->RemoveHeader (ethHeader);
+  copy->RemoveHeader (ipv4Header);
+  copy->RemoveHeader (udpHeader);
+  copy->RemoveHeader (roce);
+  if (roce.GetOpcode () == RoCEv2Header::Opcode::RC_ACK && m_psns.erase (roce.GetPSN ()))
+    {
+      m_dropped++;
+      return true;
+    }
+  return false;
+}
+
+void
+DropAckErrorModel::DoReset (void)
+{
+  m_dropped = 0;
+}
+
+/**
+ * \brief Test that a flow completes when its final ACKs are lost.
+ *
+ * The sender retransmits the packets whose ACK is lost after the
+ * retransmission timeout.  The receiver, which has torn down the flow, should
+ * ACK them again instead of taking them as a new flow, even from PSN 0 when
+ * every ACK is lost.
+ */
+class RoCEv2FinalAckLossTest : public TestCase
+{
+public:
+  /**
+   * \param name the name of the test case
+   * \param lostAcks the PSNs whose first ACK is lost
+   */
+  RoCEv2FinalAckLossTest (const std::string &name, const std::set<uint32_t> &lostAcks);
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Create a host with a DcbNetDevice.
+   */
+  Ptr<Node> CreateHost (Ipv4Address address);
+  Ptr<RoCEv2Socket> CreateSocket (Ptr<Node> node);
+
+  void SendFlow (Ptr<RoCEv2Socket> socket);
+  void Receive (Ptr<Socket> socket);
+  void FlowCompletes (Ptr<UdpBasedSocket> socket);
+
+  static const uint32_t PACKETS = 4; //!< packets of the flow
+  static const uint32_t PACKET_SIZE = 1000; //!< bytes of each packet
+
+  std::set<uint32_t> m_lostAcks; //!< the PSNs whose first ACK is lost
+  uint32_t m_receivedBytes; //!< bytes delivered to the receiver
+  Time m_completeTime; //!< when the sender gets the final ACK
+};
+
+RoCEv2FinalAckLossTest::RoCEv2FinalAckLossTest (const std::string &name,
+                                                const std::set<uint32_t> &lostAcks)
+    : TestCase (name), m_lostAcks (lostAcks), m_receivedBytes (0)
+{
+}
+
+Ptr<Node>
+RoCEv2FinalAckLossTest::CreateHost (Ipv4Address address)
+{
+  Ptr<Node> node = CreateObject<Node> ();
+  Ptr<DcbNetDevice> dev = CreateObject<DcbNetDevice> ();
+  node->AddDevice (dev);
+  dev->SetAddress (Mac48Address::Allocate ());
+  dev->SetQueue (CreateObject<DropTailQueue<Packet>> ());
+
+  DcbHostStackHelper hostStack;
+  hostStack.Install (node);
+
+  Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
+  const int32_t interface = ipv4->AddInterface (dev);
+  ipv4->AddAddress (interface, Ipv4InterfaceAddress (address, "255.0.0.0"));
+  ipv4->SetUp (interface);
+
+  Ptr<UdpBasedSocketFactory> socketFactory = node->GetObject<UdpBasedSocketFactory> ();
+  socketFactory->AddUdpBasedProtocol (node, dev, RoCEv2L4Protocol::GetTypeId ());
+  return node;
+}
+
+Ptr<RoCEv2Socket>
+RoCEv2FinalAckLossTest::CreateSocket (Ptr<Node> node)
+{
+  Ptr<RoCEv2Socket> socket =
+      DynamicCast<RoCEv2Socket> (Socket::CreateSocket (node, UdpBasedSocketFactory::GetTypeId ()));
+  socket->BindToNetDevice (node->GetDevice (0));
+  return socket;
+}
+
+void
+RoCEv2FinalAckLossTest::SendFlow (Ptr<RoCEv2Socket> socket)
+{
+  for (uint32_t i = 0; i < PACKETS; i++)
+    {
+      if (i == PACKETS - 1)
+        {
+          socket->FinishSending ();
+        }
+      socket->Send (Create<Packet> (PACKET_SIZE), 0);
+    }
+}
+
+void
+RoCEv2FinalAckLossTest::Receive (Ptr<Socket> socket)
+{
+  Ptr<Packet> packet;
+  while ((packet = socket->Recv ()))
+    {
+      m_receivedBytes += packet->GetSize ();
+    }
+}
+
+void
+RoCEv2FinalAckLossTest::FlowCompletes (Ptr<UdpBasedSocket> socket)
+{
+  m_completeTime = Simulator::Now ();
+}
+
+void
+RoCEv2FinalAckLossTest::DoRun (void)
+{
+  const Time rto = MicroSeconds (100);
+
+  Ptr<Node> sender = CreateHost (Ipv4Address ("10.0.0.1"));
+  Ptr<Node> receiver = CreateHost (Ipv4Address ("10.0.0.2"));
+  Ptr<DcbChannel> channel = CreateObject<DcbChannel> ();
+  channel->SetAttribute ("Delay", TimeValue (MicroSeconds (1)));
+  StaticCast<DcbNetDevice> (sender->GetDevice (0))->Attach (channel);
+  StaticCast<DcbNetDevice> (receiver->GetDevice (0))->Attach (channel);
+
+  Ptr<DropAckErrorModel> errorModel = Create<DropAckErrorModel> (m_lostAcks);
+  sender->GetDevice (0)->SetAttribute ("ReceiveErrorModel", PointerValue (errorModel));
+
+  Ptr<RoCEv2Socket> receiverSocket = CreateSocket (receiver);
+  receiverSocket->BindToLocalPort (RoCEv2L4Protocol::DefaultServicePort ());
+  receiverSocket->ShutdownSend ();
+  receiverSocket->SetRecvCallback (MakeCallback (&RoCEv2FinalAckLossTest::Receive, this));
+
+  Ptr<RoCEv2Socket> senderSocket = CreateSocket (sender);
+  senderSocket->SetRetransmitTimeout (rto);
+  senderSocket->SetFlowCompleteCallback (MakeCallback (&RoCEv2FinalAckLossTest::FlowCompletes, this));
+  senderSocket->Bind ();
+  senderSocket->Connect (
+      InetSocketAddress (Ipv4Address ("10.0.0.2"), RoCEv2L4Protocol::DefaultServicePort ()));
+  Simulator::Schedule (Seconds (0), &RoCEv2FinalAckLossTest::SendFlow, this, senderSocket);
+
+  Simulator::Stop (MilliSeconds (10));
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (errorModel->GetDropped (), m_lostAcks.size (),
+                         "The ACKs should be dropped");
+  NS_TEST_EXPECT_MSG_EQ (m_receivedBytes, PACKETS * PACKET_SIZE,
+                         "The receiver should get every byte exactly once");
+  NS_TEST_EXPECT_MSG_GT (m_completeTime, rto, "The flow should complete after a retransmission");
+  NS_TEST_EXPECT_MSG_LT (m_completeTime, 2 * rto, "The flow should complete after one timeout");
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \brief TestSuite for RoCEv2Socket
+ */
+class RoCEv2SocketTestSuite : public TestSuite
+{
+public:
+  RoCEv2SocketTestSuite ();
+};
+
+RoCEv2SocketTestSuite::RoCEv2SocketTestSuite () : TestSuite ("dcb-rocev2-socket", UNIT)
+{
+  AddTestCase (new RoCEv2FinalAckLossTest ("Retransmissions after the final ACK is lost are "
+                                           "ACKed again",
+                                           {3}),
+               TestCase::QUICK);
+  AddTestCase (new RoCEv2FinalAckLossTest ("A flow whose ACKs are all lost is not delivered "
+                                           "twice",
+                                           {0, 1, 2, 3}),
+               TestCase::QUICK);
+}
+
+static RoCEv2SocketTestSuite g_rocev2SocketTestSuite; //!< The testsuite
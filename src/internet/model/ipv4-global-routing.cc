@@ -16,6 +16,7 @@
 // Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 //
 
+#include <algorithm>
 #include <cstring>
 #include <vector>
 #include <iomanip>
@@ -67,7 +68,8 @@ Ipv4GlobalRouting::GetTypeId (void)
 
 Ipv4GlobalRouting::Ipv4GlobalRouting () 
   : m_randomEcmpRouting (EcmpMode::NONE),
-    m_respondToInterfaceEvents (false)
+    m_respondToInterfaceEvents (false),
+    m_indexValid (false)
 {
   NS_LOG_FUNCTION (this);
 
@@ -88,6 +90,7 @@ Ipv4GlobalRouting::AddHostRouteTo (Ipv4Address dest,
   Ipv4RoutingTableEntry *route = new Ipv4RoutingTableEntry ();
   *route = Ipv4RoutingTableEntry::CreateHostRouteTo (dest, nextHop, interface);
   m_hostRoutes.push_back (route);
+  m_indexValid = false;
 }
 
 void 
@@ -98,6 +101,7 @@ Ipv4GlobalRouting::AddHostRouteTo (Ipv4Address dest,
   Ipv4RoutingTableEntry *route = new Ipv4RoutingTableEntry ();
   *route = Ipv4RoutingTableEntry::CreateHostRouteTo (dest, interface);
   m_hostRoutes.push_back (route);
+  m_indexValid = false;
 }
 
 void 
@@ -113,6 +117,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo (Ipv4Address network,
                                                         nextHop,
                                                         interface);
   m_networkRoutes.push_back (route);
+  m_indexValid = false;
 }
 
 void 
@@ -126,6 +131,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo (Ipv4Address network,
                                                         networkMask,
                                                         interface);
   m_networkRoutes.push_back (route);
+  m_indexValid = false;
 }
 
 void 
@@ -141,66 +147,140 @@ Ipv4GlobalRouting::AddASExternalRouteTo (Ipv4Address network,
                                                         nextHop,
                                                         interface);
   m_ASexternalRoutes.push_back (route);
+  m_indexValid = false;
 }
 
 
-Ptr<Ipv4Route>
-Ipv4GlobalRouting::LookupGlobal (Ipv4Header header, Ptr<const Packet> p, Ptr<NetDevice> oif)
+void
+Ipv4GlobalRouting::BuildIndex (void)
 {
-  NS_LOG_FUNCTION (this << header << oif);
-  
-  Ipv4Address dest = header.GetDestination ();
-  NS_LOG_LOGIC ("Looking for route for destination " << dest);
-  Ptr<Ipv4Route> rtentry = 0;
-  // store all available routes that bring packets to their destination
-  typedef std::vector<Ipv4RoutingTableEntry*> RouteVec_t;
-  RouteVec_t allRoutes;
+  NS_LOG_FUNCTION (this);
+  m_hostRouteIndex.clear ();
+  m_networkTrie.assign (1, TrieNode ());
+  m_irregularNetworkRoutes.clear ();
 
-  NS_LOG_LOGIC ("Number of m_hostRoutes = " << m_hostRoutes.size ());
   for (HostRoutesCI i = m_hostRoutes.begin (); 
        i != m_hostRoutes.end (); 
        i++) 
     {
       NS_ASSERT ((*i)->IsHost ());
-      if ((*i)->GetDest () == dest)
+      m_hostRouteIndex[(*i)->GetDest ().Get ()].push_back (*i);
+    }
+
+  uint32_t seq = 0;
+  for (NetworkRoutesCI j = m_networkRoutes.begin (); 
+       j != m_networkRoutes.end (); 
+       j++, seq++) 
+    {
+      Ipv4Mask mask = (*j)->GetDestNetworkMask ();
+      uint16_t prefixLength = mask.GetPrefixLength ();
+      if (mask.Get () != (prefixLength == 0 ? 0 : 0xffffffffu << (32 - prefixLength)))
         {
-          if (oif != 0)
+          // a non-contiguous mask has no place in the trie
+          m_irregularNetworkRoutes.emplace_back (seq, *j);
+          continue;
+        }
+      uint32_t prefix = (*j)->GetDestNetwork ().CombineMask (mask).Get ();
+      uint32_t node = 0;
+      for (uint16_t bit = 0; bit < prefixLength; bit++)
+        {
+          uint32_t b = (prefix >> (31 - bit)) & 1;
+          if (m_networkTrie[node].child[b] == 0)
             {
-              if (oif != m_ipv4->GetNetDevice ((*i)->GetInterface ()))
-                {
-                  NS_LOG_LOGIC ("Not on requested interface, skipping");
-                  continue;
-                }
+              m_networkTrie[node].child[b] = m_networkTrie.size ();
+              m_networkTrie.emplace_back ();
             }
-          allRoutes.push_back (*i);
-          NS_LOG_LOGIC (allRoutes.size () << "Found global host route" << *i); 
+          node = m_networkTrie[node].child[b];
         }
+      m_networkTrie[node].routes.emplace_back (seq, *j);
     }
-  if (allRoutes.size () == 0) // if no host route is found
+  m_indexValid = true;
+}
+
+void
+Ipv4GlobalRouting::LookupNetworkRoutes (Ipv4Address dest, RouteVec_t &routes) const
+{
+  NS_LOG_FUNCTION (this << dest);
+  // Every prefix on the path from the root matches dest.  LookupGlobal has always
+  // used all matching network routes rather than the longest prefix only, so
+  // collect them all and keep the order of m_networkRoutes for ECMP.
+  std::vector<std::pair<uint32_t, Ipv4RoutingTableEntry *> > matched;
+  uint32_t addr = dest.Get ();
+  uint32_t node = 0;
+  for (uint16_t bit = 0; ; bit++)
+    {
+      const TrieNode &n = m_networkTrie[node];
+      matched.insert (matched.end (), n.routes.begin (), n.routes.end ());
+      if (bit == 32 || (node = n.child[(addr >> (31 - bit)) & 1]) == 0)
+        {
+          break;
+        }
+    }
+  for (const auto &route : m_irregularNetworkRoutes)
     {
-      NS_LOG_LOGIC ("Number of m_networkRoutes" << m_networkRoutes.size ());
-      for (NetworkRoutesI j = m_networkRoutes.begin (); 
-           j != m_networkRoutes.end (); 
-           j++) 
+      if (route.second->GetDestNetworkMask ().IsMatch (dest, route.second->GetDestNetwork ()))
         {
-          Ipv4Mask mask = (*j)->GetDestNetworkMask ();
-          Ipv4Address entry = (*j)->GetDestNetwork ();
-          if (mask.IsMatch (dest, entry)) 
+          matched.push_back (route);
+        }
+    }
+  std::sort (matched.begin (), matched.end ());
+  for (const auto &route : matched)
+    {
+      routes.push_back (route.second);
+    }
+}
+
+Ptr<Ipv4Route>
+Ipv4GlobalRouting::LookupGlobal (Ipv4Header header, Ptr<const Packet> p, Ptr<NetDevice> oif)
+{
+  NS_LOG_FUNCTION (this << header << oif);
+  
+  Ipv4Address dest = header.GetDestination ();
+  NS_LOG_LOGIC ("Looking for route for destination " << dest);
+  Ptr<Ipv4Route> rtentry = 0;
+  if (!m_indexValid)
+    {
+      BuildIndex ();
+    }
+  // store all available routes that bring packets to their destination.
+  // For a host route without output interface constraint, this is the
+  // precomputed ECMP group itself and nothing is copied.
+  RouteVec_t collected;
+  const RouteVec_t *allRoutes = &collected;
+
+  HostRouteIndex::const_iterator host = m_hostRouteIndex.find (dest.Get ());
+  if (host != m_hostRouteIndex.end ())
+    {
+      if (oif == 0)
+        {
+          allRoutes = &host->second;
+        }
+      else
+        {
+          for (Ipv4RoutingTableEntry *route : host->second)
             {
-              if (oif != 0)
+              if (oif == m_ipv4->GetNetDevice (route->GetInterface ()))
                 {
-                  if (oif != m_ipv4->GetNetDevice ((*j)->GetInterface ()))
-                    {
-                      NS_LOG_LOGIC ("Not on requested interface, skipping");
-                      continue;
-                    }
+                  collected.push_back (route);
                 }
-              allRoutes.push_back (*j);
-              NS_LOG_LOGIC (allRoutes.size () << "Found global network route" << *j);
             }
         }
+      NS_LOG_LOGIC (allRoutes->size () << " global host routes found");
+    }
+  if (allRoutes->size () == 0) // if no host route is found
+    {
+      LookupNetworkRoutes (dest, collected);
+      if (oif != 0)
+        {
+          collected.erase (std::remove_if (collected.begin (), collected.end (),
+                                           [this, oif] (Ipv4RoutingTableEntry *route) {
+                                             return oif != m_ipv4->GetNetDevice (route->GetInterface ());
+                                           }),
+                           collected.end ());
+        }
+      NS_LOG_LOGIC (collected.size () << " global network routes found");
     }
-  if (allRoutes.size () == 0)  // consider external if no host/network found
+  if (allRoutes->size () == 0)  // consider external if no host/network found
     {
       for (ASExternalRoutesI k = m_ASexternalRoutes.begin ();
            k != m_ASexternalRoutes.end ();
@@ -219,12 +299,12 @@ Ipv4GlobalRouting::LookupGlobal (Ipv4Header header, Ptr<const Packet> p, Ptr<Net
                       continue;
                     }
                 }
-              allRoutes.push_back (*k);
+              collected.push_back (*k);
               break;
             }
         }
     }
-  if (allRoutes.size () > 0 ) // if route(s) is found
+  if (allRoutes->size () > 0 ) // if route(s) is found
     {
       // pick up one of the routes uniformly at random if random
       // ECMP routing is enabled, or always select the first route
@@ -236,17 +316,17 @@ Ipv4GlobalRouting::LookupGlobal (Ipv4Header header, Ptr<const Packet> p, Ptr<Net
           selectIndex = 0;
           break;
         case PER_PACKET_ECMP:
-          selectIndex = m_rand->GetInteger (0, allRoutes.size ()-1);
+          selectIndex = m_rand->GetInteger (0, allRoutes->size ()-1);
           break;
         case PER_FLOW_ECMP:
           {
             switch (header.GetProtocol ())
               {
               case 0x6: // TcpL4Protocol::PROT_NUMBER
-                selectIndex = TcpEcmp (header, p, allRoutes.size ());
+                selectIndex = TcpEcmp (header, p, allRoutes->size ());
                 break;
               case 0x11: // UdpL4Protocol::PROT_NUMBER
-                selectIndex = UdpEcmp (header, p, allRoutes.size ());                  
+                selectIndex = UdpEcmp (header, p, allRoutes->size ());                  
                 break;
               default:
                 NS_FATAL_ERROR ("ECMP for this protocol has not been implemented.");
@@ -255,7 +335,7 @@ Ipv4GlobalRouting::LookupGlobal (Ipv4Header header, Ptr<const Packet> p, Ptr<Net
           }
         }
       
-      Ipv4RoutingTableEntry* route = allRoutes.at (selectIndex); 
+      Ipv4RoutingTableEntry* route = allRoutes->at (selectIndex); 
       // create a Ipv4Route object from the selected routing table entry
       rtentry = Create<Ipv4Route> ();
       rtentry->SetDestination (route->GetDest ());
@@ -283,6 +363,20 @@ Ipv4GlobalRouting::GetNRoutes (void) const
   return n;
 }
 
+std::map<Ipv4Address, std::vector<uint32_t> >
+Ipv4GlobalRouting::GetHostRouteInterfaces (void) const
+{
+  NS_LOG_FUNCTION (this);
+  std::map<Ipv4Address, std::vector<uint32_t> > interfaces;
+  for (HostRoutesCI i = m_hostRoutes.begin (); 
+       i != m_hostRoutes.end (); 
+       i++) 
+    {
+      interfaces[(*i)->GetDest ()].push_back ((*i)->GetInterface ());
+    }
+  return interfaces;
+}
+
 Ipv4RoutingTableEntry *
 Ipv4GlobalRouting::GetRoute (uint32_t index) const
 {
@@ -336,6 +430,7 @@ void
 Ipv4GlobalRouting::RemoveRoute (uint32_t index)
 {
   NS_LOG_FUNCTION (this << index);
+  m_indexValid = false;
   if (index < m_hostRoutes.size ())
     {
       uint32_t tmp = 0;
@@ -419,6 +514,10 @@ Ipv4GlobalRouting::DoDispose (void)
     {
       delete (*l);
     }
+  m_hostRouteIndex.clear ();
+  m_networkTrie.clear ();
+  m_irregularNetworkRoutes.clear ();
+  m_indexValid = false;
 
   Ipv4RoutingProtocol::DoDispose ();
 }
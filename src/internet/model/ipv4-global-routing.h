@@ -21,6 +21,10 @@
 #define IPV4_GLOBAL_ROUTING_H
 
 #include <list>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include <stdint.h>
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv4-header.h"
@@ -200,6 +204,18 @@ public:
    */
   Ipv4RoutingTableEntry *GetRoute (uint32_t i) const;
 
+  /**
+   * \brief Get the output interfaces of all host routes, grouped by destination.
+   *
+   * The interfaces of each destination are listed in the order LookupGlobal
+   * collects them, so indexing this list with the ECMP hash of a flow selects
+   * the same route as LookupGlobal does.  Walking the table this way is linear,
+   * whereas calling GetRoute () for every index is quadratic.
+   *
+   * \return a map from host address to the interfaces of its routes
+   */
+  std::map<Ipv4Address, std::vector<uint32_t> > GetHostRouteInterfaces (void) const;
+
   /**
    * \brief Remove a route from the global unicast routing table.
    *
@@ -277,6 +293,24 @@ private:
    * \return Ipv4Route to route the packet to reach dest address
    */
   Ptr<Ipv4Route> LookupGlobal (Ipv4Header header, Ptr<const Packet> p, Ptr<NetDevice> oif = 0);
+
+  /// container of the routes LookupGlobal selects among
+  typedef std::vector<Ipv4RoutingTableEntry *> RouteVec_t;
+
+  /**
+   * \brief Rebuild the lookup index from the route lists.
+   *
+   * Called by LookupGlobal on the first lookup after the routes changed.
+   */
+  void BuildIndex (void);
+
+  /**
+   * \brief Collect all network routes matching a destination from the trie.
+   * \param dest destination address
+   * \param routes the matching routes are appended here, in the order of m_networkRoutes
+   */
+  void LookupNetworkRoutes (Ipv4Address dest, RouteVec_t &routes) const;
+
   constexpr static const uint32_t HASH_BUF_SIZE = 12;
   union HashBuf {
     struct {
@@ -292,6 +326,23 @@ private:
   NetworkRoutes m_networkRoutes;       //!< Routes to networks
   ASExternalRoutes m_ASexternalRoutes; //!< External routes imported
 
+  /// Host routes by destination address: the ECMP group of each host, in the order of m_hostRoutes
+  typedef std::unordered_map<uint32_t, RouteVec_t> HostRouteIndex;
+  /// A network route and its position in m_networkRoutes
+  typedef std::pair<uint32_t, Ipv4RoutingTableEntry *> SeqRoute;
+
+  /// Node of the binary trie over network prefixes, the root is m_networkTrie[0]
+  struct TrieNode
+  {
+    uint32_t child[2] = {0, 0}; //!< indices of the children in m_networkTrie, 0 for none
+    std::vector<SeqRoute> routes; //!< network routes whose prefix ends at this node
+  };
+
+  bool m_indexValid;                     //!< whether the index reflects the route lists
+  HostRouteIndex m_hostRouteIndex;       //!< exact-match index of m_hostRoutes
+  std::vector<TrieNode> m_networkTrie;   //!< prefix trie of m_networkRoutes
+  std::vector<SeqRoute> m_irregularNetworkRoutes; //!< network routes with non-contiguous masks
+
   Ptr<Ipv4> m_ipv4; //!< associated IPv4 instance
 };
 
@@ -65,7 +65,7 @@ RoCEv2Header::Serialize (Buffer::Iterator start) const
   i.WriteHtonU16 (m_pKey);
   uint8_t h = (m_ub.fr << 7) | (m_ub.br << 6) | (m_ub.reserved);
   i.WriteHtonU32 ((h << 24) | m_ub.destQP);
-  h = (m_uc.ackQ << 7) | (m_uc.reserved);
+  h = (m_uc.ackQ << 7) | (m_uc.intPresent << 6) | (m_uc.reserved);
   i.WriteHtonU32 ((h << 24) | m_uc.psn);
 }
 
@@ -93,7 +93,8 @@ RoCEv2Header::Deserialize (Buffer::Iterator start)
   u = i.ReadNtohU32 ();
   h = u >> 24;
   m_uc.ackQ = h >> 7;
-  m_uc.reserved = h & 0b111'1111;
+  m_uc.intPresent = (h >> 6) & 0b1;
+  m_uc.reserved = h & 0b11'1111;
   m_uc.psn = u & 0xffffff;
 
   return GetSerializedSize ();
@@ -105,6 +106,15 @@ RoCEv2Header::Print (std::ostream &os) const
   std::string opcodeStr;
   switch (m_opcode)
     {
+    case Opcode::RC_SEND_FIRST:
+      opcodeStr = "RC_SEND_FIRST";
+      break;
+    case Opcode::RC_SEND_MIDDLE:
+      opcodeStr = "RC_SEND_MIDDLE";
+      break;
+    case Opcode::RC_SEND_LAST:
+      opcodeStr = "RC_SEND_LAST";
+      break;
     case Opcode::RC_SEND_ONLY:
       opcodeStr = "RC_SEND_ONLY";
       break;
@@ -184,6 +194,30 @@ RoCEv2Header::SetAckQ (bool ackRequested)
   m_uc.ackQ = ackRequested;
 }
 
+bool
+RoCEv2Header::GetIntPresent () const
+{
+  return m_uc.intPresent;
+}
+
+void
+RoCEv2Header::SetIntPresent (bool present)
+{
+  m_uc.intPresent = present;
+}
+
+uint8_t
+RoCEv2Header::GetFlowGeneration () const
+{
+  return m_ub.reserved;
+}
+
+void
+RoCEv2Header::SetFlowGeneration (uint8_t generation)
+{
+  m_ub.reserved = generation & 0b11'1111;
+}
+
 TypeId
 AETHeader::GetTypeId ()
 {
@@ -45,6 +45,9 @@ public:
   virtual void Print (std::ostream &os) const override;
 
   enum Opcode { // part of the opcodes for now
+    RC_SEND_FIRST  = 0b000'00000,
+    RC_SEND_MIDDLE = 0b000'00001,
+    RC_SEND_LAST   = 0b000'00010,
     RC_SEND_ONLY = 0b000'00100,
     RC_ACK       = 0b000'10001,
     UD_SEND_ONLY = 0b011'00100,
@@ -66,6 +69,19 @@ public:
   bool GetAckQ () const;
   void SetAckQ (bool ackRequested);
 
+  /**
+   * Whether an IntTrailer follows the payload, in a reserved bit.
+   */
+  bool GetIntPresent () const;
+  void SetIntPresent (bool present);
+
+  /**
+   * The 6-bit generation of the flow, in reserved bits, which tells a new
+   * flow of a reused QP from a retransmission of the last flow of the QP.
+   */
+  uint8_t GetFlowGeneration () const;
+  void SetFlowGeneration (uint8_t generation);
+
 private:
 
   Opcode m_opcode;
@@ -91,7 +107,8 @@ private:
   union {
     struct {
       uint8_t ackQ: 1; // Ackknowledge request
-      uint8_t reserved: 7; // reserved
+      uint8_t intPresent: 1; // INT trailer present, reserved in the spec
+      uint8_t reserved: 6; // reserved
       uint32_t psn: 24; // packet sequence number
     } __attribute__((__packed__));
     uint32_t u;
@@ -710,6 +710,39 @@ public:
    */
   Ptr<NixVector> GetNixVector (void) const; 
 
+  /**
+   * \brief Per-hop metadata of a DCB switch, from the ingress port to the
+   * egress port.
+   *
+   * Like the nix-vector, this is a fixed slot of the packet rather than a
+   * packet tag, so that the switch pipeline sets and reads it for every
+   * packet without allocating and searching the tag list.  It is copied
+   * with the packet, neither serialized nor printed, and only meaningful in
+   * the node that set it.
+   */
+  struct SwitchMetadata
+  {
+    uint32_t ingressPort = 0; //!< index of the device the packet came from
+    uint32_t flowHash = 0; //!< ECMP hash of the flow, 0 if not computed
+    uint8_t priority = 0; //!< class of service of the packet
+    bool valid = false; //!< whether the metadata was set by the switch
+  };
+
+  /**
+   * \brief Set the switch metadata of the packet.
+   *
+   * \warning For real this function is not const, see SetNixVector.
+   *
+   * \param metadata the switch metadata
+   */
+  inline void SetSwitchMetadata (const SwitchMetadata &metadata) const;
+  /**
+   * \brief Get the switch metadata of the packet.
+   *
+   * \returns the switch metadata, not valid if it was never set
+   */
+  inline const SwitchMetadata &GetSwitchMetadata (void) const;
+
   /**
    * TracedCallback signature for Ptr<Packet>
    *
@@ -791,6 +824,8 @@ private:
   /* Please see comments above about nix-vector */
   mutable Ptr<NixVector> m_nixVector; //!< the packet's Nix vector
 
+  mutable SwitchMetadata m_switchMetadata; //!< the metadata of the switch forwarding it
+
   static uint32_t m_globalUid; //!< Global counter of packets Uid
 };
 
@@ -858,6 +893,18 @@ Packet::GetSize (void) const
   return m_buffer.GetSize ();
 }
 
+void
+Packet::SetSwitchMetadata (const SwitchMetadata &metadata) const
+{
+  m_switchMetadata = metadata;
+}
+
+const Packet::SwitchMetadata &
+Packet::GetSwitchMetadata (void) const
+{
+  return m_switchMetadata;
+}
+
 } // namespace ns3
 
 #endif /* PACKET_H */
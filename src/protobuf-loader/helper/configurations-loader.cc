@@ -20,10 +20,19 @@
 
 #include "configurations-loader.h"
 #include "protobuf-topology-loader.h"
+#include "flow-replayer.h"
 #include "ns3/configurations.pb.h"
 #include "ns3/log.h"
 #include "ns3/fatal-error.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/tracer-extension.h"
 #include <fstream>
+#include <limits>
+#include <map>
+
+#ifdef NS3_MPI
+#include "ns3/mpi-interface.h"
+#endif
 
 namespace ns3 {
 
@@ -72,11 +81,13 @@ LoadTopology (const ns3_proto::Configurations &configurations)
 typedef std::function<void (const ns3_proto::Application &, Ptr<DcTopology>)> AppInstallFunc;
 static void InstallTraceApplication (const ns3_proto::Application &appConfig,
                                      Ptr<DcTopology> topology);
+static void InstallPreGeneratedApplication (const ns3_proto::Application &appConfig,
+                                            Ptr<DcTopology> topology);
   
 static std::map<std::string, AppInstallFunc> appInstallMapper = {
     {"TraceApplication", InstallTraceApplication},
     // {"PacketSink", ProtobufTopologyLoader::InstallPacketSink},
-    // {"PreGeneratedApplication", ProtobufTopologyLoader::InstallPreGeneratedApplication}
+    {"PreGeneratedApplication", InstallPreGeneratedApplication},
 };
 
 static std::map<std::string, TraceApplication::ProtocolGroup> protocolGroupMapper = {
@@ -107,6 +118,151 @@ InstallApplications (const ns3_proto::Configurations &conf, Ptr<DcTopology> topo
     }
 }
 
+/**
+ * Set the output directory to the directory of a path of the GlobalConfig.
+ * \return the file name of the path
+ */
+static std::string
+SetOutputDirectoryOf (const std::string &path)
+{
+  const std::size_t slash = path.rfind ('/');
+  if (slash == std::string::npos)
+    {
+      tracer_extension::ConfigOutputDirectory (".");
+      return path;
+    }
+  tracer_extension::ConfigOutputDirectory (path.substr (0, slash));
+  return path.substr (slash + 1);
+}
+
+void
+ConfigTracers (const ns3_proto::Configurations &conf)
+{
+  const ns3_proto::GlobalConfig &globalConfig = conf.globalconfig ();
+  if (globalConfig.has_outputfct ())
+    {
+      const std::string fileName = SetOutputDirectoryOf (globalConfig.outputfct ());
+      tracer_extension::ConfigTraceFCT (tracer_extension::Protocol::RoCEv2, fileName);
+    }
+  if (globalConfig.has_binarytrace ())
+    {
+      const std::string fileName = SetOutputDirectoryOf (globalConfig.binarytrace ());
+      tracer_extension::ConfigBinaryTrace (fileName);
+    }
+}
+
+TraceApplication::TraceCdf *
+GetTraceCdf (const std::string &name)
+{
+  auto p = appCdfMapper.find (name);
+  return p == appCdfMapper.end () ? nullptr : p->second;
+}
+
+namespace {
+
+/**
+ * The base RTT between the nodes of a topology, computed for a source on its
+ * first flow and kept afterwards.
+ */
+class PathRttTable : public SimpleRefCount<PathRttTable>
+{
+public:
+  PathRttTable (const ns3_proto::Configurations &conf, Ptr<DcTopology> topology);
+
+  /// A FctStatistics::BaseRttCallback
+  Time Get (uint32_t srcNode, uint32_t dstNode);
+
+private:
+  /// The RTT from a source to each node, by BFS, since routes take the fewest hops
+  const std::vector<Time> &GetFrom (uint32_t src);
+
+  std::vector<std::vector<std::pair<uint32_t, Time>>> m_links; //!< neighbors and delays by index
+  std::vector<uint32_t> m_indexOfId; //!< topology index by node ID
+  std::map<uint32_t, std::vector<Time>> m_rtts; //!< RTTs to each index by source index
+};
+
+PathRttTable::PathRttTable (const ns3_proto::Configurations &conf, Ptr<DcTopology> topology)
+    : m_links (topology->GetNNodes ())
+{
+  for (uint32_t i = 0; i < topology->GetNNodes (); i++)
+    {
+      const uint32_t id = topology->GetNode (i)->GetId ();
+      if (id >= m_indexOfId.size ())
+        {
+          m_indexOfId.resize (id + 1, std::numeric_limits<uint32_t>::max ());
+        }
+      m_indexOfId[id] = i;
+    }
+  for (const ns3_proto::Link &link : conf.topology ().links ())
+    {
+      const Time delay (link.delay ());
+      m_links[link.node1 ()].emplace_back (link.node2 (), delay);
+      m_links[link.node2 ()].emplace_back (link.node1 (), delay);
+    }
+}
+
+Time
+PathRttTable::Get (uint32_t srcNode, uint32_t dstNode)
+{
+  NS_ASSERT_MSG (srcNode < m_indexOfId.size () && dstNode < m_indexOfId.size (),
+                 "The nodes of the flow are not in the topology");
+  return GetFrom (m_indexOfId[srcNode])[m_indexOfId[dstNode]];
+}
+
+const std::vector<Time> &
+PathRttTable::GetFrom (uint32_t src)
+{
+  auto it = m_rtts.find (src);
+  if (it != m_rtts.end ())
+    {
+      return it->second;
+    }
+  // Of the paths with the fewest hops, take the one with the least delay
+  const uint32_t nNodes = m_links.size ();
+  std::vector<uint32_t> hops (nNodes, std::numeric_limits<uint32_t>::max ());
+  std::vector<Time> delays (nNodes);
+  std::vector<uint32_t> frontier = {src};
+  hops[src] = 0;
+  while (!frontier.empty ())
+    {
+      std::vector<uint32_t> next;
+      for (uint32_t node : frontier)
+        {
+          for (const auto &link : m_links[node])
+            {
+              const uint32_t neighbor = link.first;
+              const Time delay = delays[node] + link.second;
+              if (hops[neighbor] == std::numeric_limits<uint32_t>::max ())
+                {
+                  hops[neighbor] = hops[node] + 1;
+                  delays[neighbor] = delay;
+                  next.push_back (neighbor);
+                }
+              else if (hops[neighbor] == hops[node] + 1 && delay < delays[neighbor])
+                {
+                  delays[neighbor] = delay;
+                }
+            }
+        }
+      frontier.swap (next);
+    }
+  std::vector<Time> &rtts = m_rtts[src];
+  rtts.reserve (nNodes);
+  for (const Time &delay : delays)
+    {
+      rtts.push_back (2 * delay);
+    }
+  return rtts;
+}
+
+} // namespace
+
+FctStatistics::BaseRttCallback
+GetPathBaseRtt (const ns3_proto::Configurations &conf, Ptr<DcTopology> topology)
+{
+  return MakeCallback (&PathRttTable::Get, Create<PathRttTable> (conf, topology));
+}
+
 static void
 InstallTraceApplication (const ns3_proto::Application &appConfig, Ptr<DcTopology> topology)
 {
@@ -153,6 +309,12 @@ InstallTraceApplication (const ns3_proto::Application &appConfig, Ptr<DcTopology
                                   << " is not a host and thus could not install an application.");
         }
       Ptr<Node> node = topology->GetNode (nodeI).nodePtr;
+#ifdef NS3_MPI
+      if (MpiInterface::IsEnabled () && node->GetSystemId () != MpiInterface::GetSystemId ())
+        {
+          continue; // the node is simulated by another rank
+        }
+#endif
       if (!appConfig.has_load ())
         {
           NS_FATAL_ERROR ("Using TraceApplication needs to specify \"load\"");
@@ -164,6 +326,60 @@ InstallTraceApplication (const ns3_proto::Application &appConfig, Ptr<DcTopology
     }
 }
 
+/**
+ * Replay the flows of the Flows file `fileName` by a TraceApplication on each
+ * node of `nodeIndices`, which generates no random flow.
+ */
+static void
+InstallPreGeneratedApplication (const ns3_proto::Application &appConfig,
+                                Ptr<DcTopology> topology)
+{
+  TraceApplicationHelper appHelper (topology);
+  appHelper.SetRandomFlowsEnabled (false);
+
+  if (!appConfig.has_protocolgroup ())
+    {
+      NS_FATAL_ERROR ("Using PreGeneratedApplication needs to specify \"protocolGroup\"");
+    }
+  auto p = protocolGroupMapper.find (appConfig.protocolgroup ());
+  if (p == protocolGroupMapper.end ())
+    {
+      NS_FATAL_ERROR ("Cannot recognize protocol group \"" << appConfig.protocolgroup () << "\"");
+    }
+  appHelper.SetProtocolGroup (p->second);
+
+  if (!appConfig.has_filename ())
+    {
+      NS_FATAL_ERROR ("Using PreGeneratedApplication needs to specify \"fileName\" of the flows");
+    }
+  Ptr<FlowReplayer> replayer = CreateObject<FlowReplayer> ();
+  replayer->Open (appConfig.filename ());
+
+  const Time startTime (appConfig.starttime ());
+  const Time stopTime (appConfig.stoptime ());
+  for (const auto &nodeI : appConfig.nodeindices ())
+    {
+      if (!topology->IsHost (nodeI))
+        {
+          NS_FATAL_ERROR ("Node " << nodeI
+                                  << " is not a host and thus could not install an application.");
+        }
+      Ptr<Node> node = topology->GetNode (nodeI).nodePtr;
+#ifdef NS3_MPI
+      if (MpiInterface::IsEnabled () && node->GetSystemId () != MpiInterface::GetSystemId ())
+        {
+          replayer->AddRemoteNode (nodeI);
+          continue;
+        }
+#endif
+      ApplicationContainer app = appHelper.Install (node);
+      app.Start (startTime);
+      app.Stop (stopTime);
+      replayer->AddApplication (nodeI, DynamicCast<TraceApplication> (app.Get (0)));
+    }
+  replayer->Start (startTime, stopTime);
+}
+
 } // namespace configurations
 
 } // namespace ns3
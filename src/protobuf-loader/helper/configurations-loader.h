@@ -25,6 +25,7 @@
 #include "ns3/configurations.pb.h"
 #include "ns3/dc-topology.h"
 #include "ns3/dcb-trace-application.h"
+#include "ns3/fct-statistics.h"
 
 namespace ns3 {
 
@@ -44,6 +45,28 @@ namespace configurations {
 
   void InstallApplications (const ns3_proto::Configurations &conf, Ptr<DcTopology> topology);
 
+  /**
+   * \brief Configure the tracers by the GlobalConfig, i.e., the FCT log of
+   * outputFct and the binary trace of binaryTrace.  The files are paths
+   * under the outputDir of the configuration script, which becomes the output
+   * directory of tracer_extension.
+   */
+  void ConfigTracers (const ns3_proto::Configurations &conf);
+
+  /**
+   * \return the CDF of TraceApplication by the name used in the configurations,
+   * or nullptr if there is no such CDF
+   */
+  TraceApplication::TraceCdf *GetTraceCdf (const std::string &name);
+
+  /**
+   * \return the base RTT between two nodes of the topology for
+   * FctStatistics, i.e., twice the link delays of the path with the fewest
+   * hops between them, without transmission or queuing
+   */
+  FctStatistics::BaseRttCallback GetPathBaseRtt (const ns3_proto::Configurations &conf,
+                                                 Ptr<DcTopology> topology);
+
 } // namespace configurations
 
 } // namespace ns3
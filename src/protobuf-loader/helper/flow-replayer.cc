@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg (pavin0702@gmail.com)
+ */
+
+#include "flow-replayer.h"
+#include "ns3/fatal-error.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <fcntl.h>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("FlowReplayer");
+NS_OBJECT_ENSURE_REGISTERED (FlowReplayer);
+
+TypeId
+FlowReplayer::GetTypeId ()
+{
+  static TypeId tid =
+      TypeId ("ns3::FlowReplayer")
+          .SetParent<Object> ()
+          .SetGroupName ("ProtobufLoader")
+          .AddConstructor<FlowReplayer> ()
+          .AddAttribute ("Window", "The maximum number of flows scheduled at a time",
+                         UintegerValue (1024),
+                         MakeUintegerAccessor (&FlowReplayer::m_window),
+                         MakeUintegerChecker<uint32_t> (1));
+  return tid;
+}
+
+FlowReplayer::FlowReplayer () : m_window (1024), m_scheduled (0), m_lastArriveTime (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+FlowReplayer::~FlowReplayer ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+FlowReplayer::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+  m_input.reset ();
+  m_apps.clear ();
+  Object::DoDispose ();
+}
+
+void
+FlowReplayer::Open (const std::string &fileName)
+{
+  NS_LOG_FUNCTION (this << fileName);
+  const int fd = open (fileName.c_str (), O_RDONLY);
+  if (fd < 0)
+    {
+      NS_FATAL_ERROR ("Cannot open flows file \"" << fileName << "\"");
+    }
+  m_fileName = fileName;
+  m_input = std::make_unique<google::protobuf::io::FileInputStream> (fd);
+  m_input->SetCloseOnDelete (true);
+}
+
+void
+FlowReplayer::AddApplication (uint32_t node, Ptr<TraceApplication> app)
+{
+  m_apps[node] = app;
+}
+
+void
+FlowReplayer::AddRemoteNode (uint32_t node)
+{
+  m_remoteNodes.insert (node);
+}
+
+void
+FlowReplayer::Start (Time startTime, Time stopTime)
+{
+  NS_LOG_FUNCTION (this << startTime << stopTime);
+  NS_ASSERT_MSG (m_input, "FlowReplayer::Open should be called before Start");
+  m_startTime = startTime;
+  m_stopTime = stopTime;
+  // Read from startTime on, so that the flows of that time are started after
+  // the applications
+  Simulator::Schedule (startTime - Simulator::Now (), &FlowReplayer::Refill,
+                       Ptr<FlowReplayer> (this));
+}
+
+bool
+FlowReplayer::ReadNextFlow (ns3_proto::Flow &flow)
+{
+  // A Flows message is a sequence of its repeated field, i.e., of tagged and
+  // length-delimited Flow messages, so it is parsed one Flow at a time.
+  static const uint32_t flowsTag = (ns3_proto::Flows::kFlowsFieldNumber << 3) | 2;
+
+  // A CodedInputStream per flow gives back the bytes read ahead when destroyed
+  google::protobuf::io::CodedInputStream input (m_input.get ());
+  const uint32_t tag = input.ReadTag ();
+  if (tag == 0)
+    {
+      return false; // end of the file
+    }
+  uint32_t length;
+  if (tag != flowsTag || !input.ReadVarint32 (&length))
+    {
+      NS_FATAL_ERROR ("Flows file \"" << m_fileName << "\" is not a Flows message");
+    }
+  const auto limit = input.PushLimit (length);
+  if (!flow.ParseFromCodedStream (&input))
+    {
+      NS_FATAL_ERROR ("Cannot parse a flow in flows file \"" << m_fileName << "\"");
+    }
+  input.PopLimit (limit);
+  return true;
+}
+
+void
+FlowReplayer::Refill ()
+{
+  ns3_proto::Flow flow;
+  while (m_input && m_scheduled < m_window)
+    {
+      if (!ReadNextFlow (flow))
+        {
+          m_input.reset ();
+          break;
+        }
+      if (flow.arrivetime () < m_lastArriveTime)
+        {
+          NS_FATAL_ERROR ("Flows in \"" << m_fileName << "\" should be sorted by arriveTime");
+        }
+      m_lastArriveTime = flow.arrivetime ();
+      const Time arriveTime = m_startTime + NanoSeconds (flow.arrivetime ());
+      if (arriveTime >= m_stopTime)
+        {
+          m_input.reset (); // the rest arrive even later
+          break;
+        }
+
+      auto it = m_apps.find (flow.srcnode ());
+      if (it == m_apps.end ())
+        {
+          if (m_remoteNodes.count (flow.srcnode ()))
+            {
+              continue; // simulated by another rank
+            }
+          NS_FATAL_ERROR ("Node " << flow.srcnode ()
+                                  << " has no PreGeneratedApplication to send a flow");
+        }
+      Simulator::ScheduleWithContext (flow.srcnode (), arriveTime - Simulator::Now (),
+                                      &FlowReplayer::StartFlow, Ptr<FlowReplayer> (this),
+                                      it->second, flow.dstnode (), flow.size (),
+                                      flow.priority ());
+      m_scheduled++;
+    }
+}
+
+void
+FlowReplayer::StartFlow (Ptr<TraceApplication> app, uint32_t destNode, uint64_t size,
+                         uint8_t priority)
+{
+  NS_LOG_FUNCTION (this << app << destNode << size << +priority);
+  m_scheduled--;
+  app->StartFlow (destNode, size, priority);
+  Refill ();
+}
+
+} // namespace ns3
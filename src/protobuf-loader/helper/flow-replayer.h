@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg (pavin0702@gmail.com)
+ */
+
+#ifndef FLOW_REPLAYER_H
+#define FLOW_REPLAYER_H
+
+#include "ns3/dcb-trace-application.h"
+#include "ns3/flows.pb.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+namespace ns3 {
+
+/**
+ * \ingroup protobuf-loader
+ *
+ * \brief Replay the pre-generated flows of a Flows file on TraceApplications.
+ *
+ * The file is read one flow at a time and only `Window` flows are scheduled
+ * at any time: when a flow starts, the next one is read.  So a trace of any
+ * length is replayed in memory bounded by the window.  The flows should be
+ * sorted by arriveTime.
+ *
+ * Each flow is started by the TraceApplication of its source node, which
+ * should not generate random flows (see
+ * TraceApplicationHelper::SetRandomFlowsEnabled).
+ */
+class FlowReplayer : public Object
+{
+public:
+  static TypeId GetTypeId ();
+
+  FlowReplayer ();
+  ~FlowReplayer () override;
+
+  void Open (const std::string &fileName);
+
+  /**
+   * \brief The application of a source node simulated by this process.
+   */
+  void AddApplication (uint32_t node, Ptr<TraceApplication> app);
+
+  /**
+   * \brief A source node simulated by another MPI rank, whose flows are
+   * skipped here.
+   */
+  void AddRemoteNode (uint32_t node);
+
+  /**
+   * \brief Start replaying at startTime.  The arriveTime of a flow is relative
+   * to startTime and the flows arriving from stopTime on are not replayed.
+   */
+  void Start (Time startTime, Time stopTime);
+
+protected:
+  void DoDispose () override;
+
+private:
+  /**
+   * \brief Read the next flow from the file.
+   * \return false at the end of the file
+   */
+  bool ReadNextFlow (ns3_proto::Flow &flow);
+
+  /**
+   * \brief Read and schedule flows until the window is full.
+   */
+  void Refill ();
+
+  void StartFlow (Ptr<TraceApplication> app, uint32_t destNode, uint64_t size,
+                  uint8_t priority);
+
+  std::string m_fileName;
+  std::unique_ptr<google::protobuf::io::FileInputStream> m_input;
+  std::map<uint32_t, Ptr<TraceApplication>> m_apps;
+  std::set<uint32_t> m_remoteNodes;
+  uint32_t m_window; //!< maximum number of flows scheduled at a time
+  uint32_t m_scheduled; //!< number of flows scheduled but not started yet
+  uint64_t m_lastArriveTime; //!< to check the order of the flows
+  Time m_startTime;
+  Time m_stopTime;
+};
+
+} // namespace ns3
+
+#endif // FLOW_REPLAYER_H
@@ -20,11 +20,13 @@
 
 #include <fstream>
 #include <limits>
+#include <map>
 #include <vector>
 #include "ns3/application-container.h"
 #include "ns3/boolean.h"
 #include "ns3/configurations.pb.h"
 #include "ns3/data-rate.h"
+#include "ns3/dc-routing-helper.h"
 #include "ns3/dc-topology.h"
 #include "ns3/dcb-net-device.h"
 #include "ns3/global-router-interface.h"
@@ -39,13 +41,21 @@
 #include "ns3/queue-disc.h"
 #include "ns3/queue-size.h"
 #include "ns3/configurations.pb.h"
+#include "ns3/system-wall-clock-ms.h"
 #include "ns3/traced-value.h"
 #include "protobuf-topology-loader.h"
 #include "ns3/dcb-fc-helper.h"
 #include "ns3/dcb-pfc-port.h"
+#include "ns3/dcb-traffic-control.h"
 #include "ns3/ipv4-global-routing-helper.h"
 #include "ns3/ipv4-global-routing.h"
 
+#ifdef NS3_MPI
+#include "ns3/dcb-remote-channel.h"
+#include "ns3/mpi-interface.h"
+#include "ns3/mpi-receiver.h"
+#endif
+
 /**
  * \file
  * \ingroup protobuf-loader
@@ -59,13 +69,14 @@ NS_LOG_COMPONENT_DEFINE ("ProtobufTopologyLoader");
 namespace topology {
 
 static void AssignAddress (const Ptr<Node> node, const Ptr<NetDevice> device);
+static std::vector<uint32_t> AssignSystemIds (const ns3_proto::Topology &topoConfig);
 static void LoadHosts (const google::protobuf::RepeatedPtrField<ns3_proto::HostGroup> &hostGroups,
-                Ptr<DcTopology> topology);
+                       const std::vector<uint32_t> &systemIds, Ptr<DcTopology> topology);
 static void LoadSwitches (const google::protobuf::RepeatedPtrField<ns3_proto::SwitchGroup> &switchGroups,
-                   Ptr<DcTopology> topology);
+                          const std::vector<uint32_t> &systemIds, Ptr<DcTopology> topology);
 static void LoadLinks (const google::protobuf::RepeatedPtrField<ns3_proto::Link> &linksConfig,
                 Ptr<DcTopology> topology);
-static void InitGlobalRouting ();
+static void InitGlobalRouting (Ptr<DcTopology> topology);
 
 /**
  * \ingroup protobuf-loader
@@ -73,43 +84,178 @@ static void InitGlobalRouting ();
  */
 // static
 Ptr<DcTopology>
-LoadTopology (const ns3_proto::Configurations &configurations)
+LoadTopology (const ns3_proto::Configurations &configurations,
+              LoadPhaseTimes *phaseTimes /* = nullptr */)
 {
+  SystemWallClockMs clock;
+  auto phase = [&clock, phaseTimes] (const std::string &name) {
+    const int64_t ms = clock.End ();
+    NS_LOG_INFO ("Loading " << name << " takes " << ms << " ms");
+    if (phaseTimes)
+      {
+        phaseTimes->emplace_back (name, ms);
+      }
+    clock.Start ();
+  };
+
+  clock.Start ();
   const ns3_proto::Topology &topoConfig = configurations.topology ();
   Ptr<DcTopology> topology = CreateObject<DcTopology> (topoConfig.nodes ().num ());
 
   Ipv4AddressGenerator::Init ("10.0.0.0", "255.0.0.0", "0.0.0.1");
 
-  LoadHosts (topoConfig.nodes ().hostgroups (), topology);
-  LoadSwitches (topoConfig.nodes ().switchgroups (), topology);
+  const std::vector<uint32_t> systemIds = AssignSystemIds (topoConfig);
+  phase ("system IDs");
+  LoadHosts (topoConfig.nodes ().hostgroups (), systemIds, topology);
+  phase ("hosts");
+  LoadSwitches (topoConfig.nodes ().switchgroups (), systemIds, topology);
+  phase ("switches");
   LoadLinks (topoConfig.links (), topology);
-  InitGlobalRouting ();
+  phase ("links");
+  InitGlobalRouting (topology);
+  phase ("routing");
 
   // LogAllRoutes (topology); // TODO: remove me
 
   return topology;
 }
 
+/**
+ * Decide which MPI rank (system ID) each node belongs to.
+ *
+ * Without MPI every node is on system 0. Otherwise the IDs come from
+ * AllNodes.systemIds if given. If not, hosts are split into contiguous blocks
+ * of equal size, one block per rank, and every switch then joins the rank
+ * that most of its already-assigned neighbors belong to, tier by tier. Since
+ * hosts of a pod have continuous IDs, this keeps a pod (hosts, ToRs and
+ * aggregation switches) in one rank so that only the core links cross ranks.
+ */
+static std::vector<uint32_t>
+AssignSystemIds (const ns3_proto::Topology &topoConfig)
+{
+  const uint32_t nNodes = topoConfig.nodes ().num ();
+  std::vector<uint32_t> systemIds (nNodes, 0);
+#ifdef NS3_MPI
+  if (!MpiInterface::IsEnabled ())
+    {
+      return systemIds;
+    }
+  const uint32_t nSystems = MpiInterface::GetSize ();
+  const auto &configuredIds = topoConfig.nodes ().systemids ();
+  if (configuredIds.size () != 0)
+    {
+      if (static_cast<uint32_t> (configuredIds.size ()) != nNodes)
+        {
+          NS_FATAL_ERROR ("AllNodes.systemIds has " << configuredIds.size ()
+                                                    << " entries but there are " << nNodes
+                                                    << " nodes");
+        }
+      for (uint32_t i = 0; i < nNodes; i++)
+        {
+          if (configuredIds[i] >= nSystems)
+            {
+              NS_FATAL_ERROR ("Node " << i << " is assigned to system " << configuredIds[i]
+                                      << " but only " << nSystems << " MPI ranks are running");
+            }
+          systemIds[i] = configuredIds[i];
+        }
+      return systemIds;
+    }
+  if (nSystems == 1)
+    {
+      return systemIds;
+    }
+
+  const uint32_t kUnassigned = std::numeric_limits<uint32_t>::max ();
+  std::fill (systemIds.begin (), systemIds.end (), kUnassigned);
+
+  uint32_t nHosts = 0;
+  for (const ns3_proto::HostGroup &hostGroup : topoConfig.nodes ().hostgroups ())
+    {
+      nHosts += hostGroup.nodesnum ();
+    }
+  uint32_t hostRank = 0;
+  for (const ns3_proto::HostGroup &hostGroup : topoConfig.nodes ().hostgroups ())
+    {
+      const uint32_t baseIndex = hostGroup.baseindex ();
+      for (uint32_t i = baseIndex; i < baseIndex + hostGroup.nodesnum (); i++, hostRank++)
+        {
+          systemIds[i] = static_cast<uint64_t> (hostRank) * nSystems / nHosts;
+        }
+    }
+
+  std::vector<std::vector<uint32_t>> neighbors (nNodes);
+  for (const ns3_proto::Link &link : topoConfig.links ())
+    {
+      neighbors[link.node1 ()].push_back (link.node2 ());
+      neighbors[link.node2 ()].push_back (link.node1 ());
+    }
+
+  // Each round assigns the switches adjacent to the previous tier
+  bool changed = true;
+  while (changed)
+    {
+      changed = false;
+      std::vector<uint32_t> next = systemIds;
+      for (uint32_t i = 0; i < nNodes; i++)
+        {
+          if (systemIds[i] != kUnassigned)
+            {
+              continue;
+            }
+          std::map<uint32_t, uint32_t> votes;
+          uint32_t best = 0;
+          for (uint32_t nb : neighbors[i])
+            {
+              if (systemIds[nb] != kUnassigned)
+                {
+                  best = std::max (best, ++votes[systemIds[nb]]);
+                }
+            }
+          if (votes.empty ())
+            {
+              continue;
+            }
+          // Spread ties (e.g., core switches that see every pod) among the ranks
+          std::vector<uint32_t> tied;
+          for (const auto &[rank, count] : votes)
+            {
+              if (count == best)
+                {
+                  tied.push_back (rank);
+                }
+            }
+          next[i] = tied[i % tied.size ()];
+          changed = true;
+        }
+      systemIds = std::move (next);
+    }
+  for (uint32_t &id : systemIds)
+    {
+      if (id == kUnassigned) // isolated node
+        {
+          id = 0;
+        }
+    }
+#endif
+  return systemIds;
+}
+
 static DcTopology::TopoNode
-CreateOneHost (const ns3_proto::HostGroup &hostGroup)
+CreateOneHost (const ns3_proto::HostGroup &hostGroup, uint32_t systemId,
+               const DcbHostStackHelper &hostStack, const ObjectFactory &queueFactory)
 {
-  const Ptr<Node> host = CreateObject<Node> ();
+  const Ptr<Node> host = CreateObject<Node> (systemId);
 
-  for (auto port : hostGroup.ports ())
+  for (int i = 0; i < hostGroup.ports_size (); i++)
     {
       // create a net device for the port
       const Ptr<DcbNetDevice> dev = CreateObject<DcbNetDevice> ();
       host->AddDevice (dev);
       dev->SetAddress (Mac48Address::Allocate ());
-
-      ObjectFactory queueFactory;
-      queueFactory.SetTypeId (DropTailQueue<Packet>::GetTypeId ());
-      Ptr<Queue<Packet>> queue = queueFactory.Create<Queue<Packet>> ();
-      queue->SetMaxSize ({QueueSizeUnit::PACKETS, std::numeric_limits<uint32_t>::max ()});
-      dev->SetQueue (queue);
+      dev->SetQueue (queueFactory.Create<Queue<Packet>> ());
     }
 
-  DcbHostStackHelper hostStack;
   hostStack.Install (host);
 
   for (int i = 0; i < hostGroup.ports_size (); i++)
@@ -120,128 +266,277 @@ CreateOneHost (const ns3_proto::HostGroup &hostGroup)
   return {.type = DcTopology::TopoNode::NodeType::HOST, .nodePtr = host};
 }
 
-static Ptr<DcbNetDevice>
-AddPortToSwitch (const ns3_proto::SwitchPortConfig portConfig, const Ptr<Node> sw,
-                 DcbSwitchStackHelper &switchStack)
+/**
+ * The configurations of a SwitchGroup, parsed once and applied to every switch
+ * of the group.
+ */
+struct SwitchGroupConfig
 {
-  // Create a net device for this port
-  Ptr<DcbNetDevice> dev = CreateObject<DcbNetDevice> ();
-  dev->SetAddress (Mac48Address::Allocate ());
+  struct EcnQueueConfig
+  {
+    uint32_t kMin;
+    uint32_t kMax;
+    double pMax;
+  };
+
+  struct PortConfig
+  {
+    bool pfcEnabled;
+    DcbPfcPortConfig pfc;
+    bool ecnEnabled;
+    std::vector<EcnQueueConfig> ecn;
+    std::vector<uint32_t> etsWeights;
+  };
+
+  QueueSize bufferSize;
+  std::vector<PortConfig> ports;
+  bool hasSharedBuffer;
+  DcbSharedBufferConfig sharedBuffer;
+  bool hasEcnAlpha;
+  double ecnAlpha;
+  DcbTrafficControl::LoadBalancing loadBalancing;
+  Time flowletGap;
+};
 
-  ObjectFactory queueFactory;
-  queueFactory.SetTypeId (DropTailQueue<Packet>::GetTypeId ());
-  Ptr<Queue<Packet>> queue = queueFactory.Create<Queue<Packet>> ();
-  queue->SetMaxSize (QueueSize ("10p"));
-  dev->SetQueue (queue);
+/**
+ * \return the bytes of a size of the shared buffer, 0 if it is not set
+ */
+static uint32_t
+ParseSharedBufferSize (const std::string &size, const std::string &field)
+{
+  if (size.empty ())
+    {
+      return 0;
+    }
+  const QueueSize queueSize (size);
+  if (queueSize.GetUnit () != QueueSizeUnit::BYTES)
+    {
+      NS_FATAL_ERROR ("The " << field << " of the shared buffer should be in bytes, not \""
+                             << size << "\"");
+    }
+  return queueSize.GetValue ();
+}
+
+static SwitchGroupConfig
+ParseSwitchGroup (const ns3_proto::SwitchGroup &switchGroup)
+{
+  SwitchGroupConfig config;
+  config.bufferSize = QueueSize (switchGroup.buffersize ());
+  for (const ns3_proto::SwitchPortConfig &portConfig : switchGroup.ports ())
+    {
+      if (portConfig.queues_size () != 0 && portConfig.queues_size () != 8)
+        {
+          NS_FATAL_ERROR ("The port configuration should have 8 queues or 0 queue, not "
+                          << portConfig.queues_size ());
+        }
+      SwitchGroupConfig::PortConfig port;
+      port.pfcEnabled = portConfig.pfcenabled ();
+      port.ecnEnabled = portConfig.ecnenabled ();
+      for (int qi = 0; qi < portConfig.queues_size (); qi++)
+        {
+          const ns3_proto::PortQueueConfig &queueConfig = portConfig.queues (qi);
+          if (port.pfcEnabled)
+            {
+              port.pfc.AddQueueConfig (qi, QueueSize (queueConfig.pfcreserve ()).GetValue (),
+                                       QueueSize (queueConfig.pfcxon ()).GetValue ());
+            }
+          if (port.ecnEnabled)
+            {
+              port.ecn.push_back ({QueueSize (queueConfig.ecnkmin ()).GetValue (),
+                                   QueueSize (queueConfig.ecnkmax ()).GetValue (),
+                                   queueConfig.ecnpmax ()});
+            }
+          port.etsWeights.push_back (queueConfig.etsweight ());
+        }
+      config.ports.push_back (std::move (port));
+    }
 
-  sw->AddDevice (dev);
+  config.hasSharedBuffer = switchGroup.has_sharedbuffer ();
+  config.hasEcnAlpha = config.hasSharedBuffer && switchGroup.sharedbuffer ().has_ecnalpha ();
+  if (config.hasSharedBuffer)
+    {
+      const ns3_proto::SharedBufferConfig &bufferConfig = switchGroup.sharedbuffer ();
+      config.sharedBuffer.reserve = ParseSharedBufferSize (bufferConfig.reserve (), "reserve");
+      config.sharedBuffer.headroom = ParseSharedBufferSize (bufferConfig.headroom (), "headroom");
+      config.sharedBuffer.pfcAlpha = bufferConfig.pfcalpha ();
+      config.sharedBuffer.xonOffset =
+          ParseSharedBufferSize (bufferConfig.xonoffset (), "xonOffset");
+      config.ecnAlpha = bufferConfig.ecnalpha ();
+    }
 
-  return dev;
+  const ns3_proto::LoadBalanceConfig &lbConfig = switchGroup.loadbalance ();
+  switch (lbConfig.mode ())
+    {
+    case ns3_proto::LoadBalanceConfig::ECMP:
+      config.loadBalancing = DcbTrafficControl::ECMP;
+      break;
+    case ns3_proto::LoadBalanceConfig::PACKET_SPRAY:
+      config.loadBalancing = DcbTrafficControl::PACKET_SPRAY;
+      break;
+    case ns3_proto::LoadBalanceConfig::FLOWLET:
+      config.loadBalancing = DcbTrafficControl::FLOWLET;
+      break;
+    case ns3_proto::LoadBalanceConfig::CONGESTION_AWARE:
+      config.loadBalancing = DcbTrafficControl::CONGESTION_AWARE;
+      break;
+    default:
+      NS_FATAL_ERROR ("Unknown load balancing mode " << lbConfig.mode ());
+    }
+  config.flowletGap =
+      lbConfig.flowletgap ().empty () ? MicroSeconds (50) : Time (lbConfig.flowletgap ());
+  return config;
 }
 
 static DcTopology::TopoNode
-CreateOneSwitch (const uint32_t queueNum, const ns3_proto::SwitchGroup &switchGroup)
+CreateOneSwitch (const SwitchGroupConfig &config, uint32_t systemId,
+                 const DcbSwitchStackHelper &switchStack, const ObjectFactory &queueFactory,
+                 const ObjectFactory &ecnFactory)
 {
-  const Ptr<Node> sw = CreateObject<Node> ();
+  const Ptr<Node> sw = CreateObject<Node> (systemId);
   // Basic configurations
   // sw->SetEcmpSeed (m_ecmpSeed);
 
   // Configure ports
-  DcbSwitchStackHelper switchStack;
-  switchStack.SetBufferSize (QueueSize (switchGroup.buffersize ()));
-  for (const auto &portConfig : switchGroup.ports ())
+  for (size_t i = 0; i < config.ports.size (); i++)
     {
-      AddPortToSwitch (portConfig, sw, switchStack);
+      Ptr<DcbNetDevice> dev = CreateObject<DcbNetDevice> ();
+      dev->SetAddress (Mac48Address::Allocate ());
+      dev->SetQueue (queueFactory.Create<Queue<Packet>> ());
+      sw->AddDevice (dev);
     }
   switchStack.Install (sw);
+  Ptr<DcbTrafficControl> tc = sw->GetObject<DcbTrafficControl> ();
 
-  for (int i = 0; i < switchGroup.ports_size (); i++)
+  for (uint32_t i = 0; i < config.ports.size (); i++)
     {
-      const ns3_proto::SwitchPortConfig &portConfig = switchGroup.ports (i);
-
-      if (portConfig.queues_size () != 0 && portConfig.queues_size () != 8)
+      const SwitchGroupConfig::PortConfig &port = config.ports[i];
+      if (port.pfcEnabled) // Configure PFC
         {
-          NS_FATAL_ERROR ("The port configuration should have 8 queues or 0 queue, not "
-                          << portConfig.queues_size ());
+          DcbFcHelper::InstallPFCtoNodePort (sw, i, port.pfc);
         }
+      AssignAddress (sw, sw->GetDevice (i));
 
-      if (portConfig.pfcenabled ()) // Configure PFC
+      // Configure ETS, queues are strict priority unless given a weight
+      Ptr<PausableQueueDisc> qdisc = DynamicCast<DcbNetDevice> (sw->GetDevice (i))->GetQueueDisc ();
+      for (uint32_t qi = 0; qi < port.etsWeights.size (); qi++)
         {
-          DcbPfcPortConfig pfcConfig;
-          for (int qi = 0; qi < portConfig.queues_size (); qi++)
-            {
-              const ns3_proto::PortQueueConfig &queueConfig = portConfig.queues (qi);
-              const uint32_t reserve = QueueSize (queueConfig.pfcreserve ()).GetValue ();
-              const uint32_t xon = QueueSize (queueConfig.pfcxon ()).GetValue ();
-              pfcConfig.AddQueueConfig (qi, reserve, xon);
-            }
-          DcbFcHelper::InstallPFCtoNodePort (sw, i, pfcConfig);
+          qdisc->SetEtsWeight (qi, port.etsWeights[qi]);
         }
-      AssignAddress (sw, sw->GetDevice (i));
 
-      if (portConfig.ecnenabled ()) // Configure ECN
+      // Configure ECN
+      for (const SwitchGroupConfig::EcnQueueConfig &ecn : port.ecn)
         {
-          ObjectFactory factory;
-          factory.SetTypeId ("ns3::FifoQueueDiscEcn");
-          Ptr<QueueDisc> dev = DynamicCast<DcbNetDevice> (sw->GetDevice (i))->GetQueueDisc ();
-
-          for (int qi = 0; qi < portConfig.queues_size (); qi++)
+          Ptr<FifoQueueDiscEcn> qd = ecnFactory.Create<FifoQueueDiscEcn> ();
+          qd->Initialize ();
+          qd->ConfigECN (ecn.kMin, ecn.kMax, ecn.pMax);
+          if (config.hasEcnAlpha)
             {
-              const ns3_proto::PortQueueConfig &queueConfig = portConfig.queues (qi);
-              uint32_t ecnKMin = QueueSize (queueConfig.ecnkmin ()).GetValue ();
-              uint32_t ecnKMax = QueueSize (queueConfig.ecnkmax ()).GetValue ();
-              double ecnPMax = queueConfig.ecnpmax ();
-              // ecnConfig.AddQueueConfig (qi, ecnKMin, ecnKMax, ecnPMax);
-
-              Ptr<FifoQueueDiscEcn> qd = factory.Create<FifoQueueDiscEcn> ();
-              qd->Initialize ();
-              qd->ConfigECN (ecnKMin, ecnKMax, ecnPMax);
-              qd->SetMaxSize (QueueSize (switchGroup.buffersize ()));
-              Ptr<PausableQueueDiscClass> c = CreateObject<PausableQueueDiscClass> ();
-              c->SetQueueDisc (qd);
-              dev->AddQueueDiscClass (c);
+              qd->ConfigDynamicEcn (config.ecnAlpha,
+                                    MakeCallback (&DcbTrafficControl::GetSharedBufferFreeBytes, tc));
             }
+          qd->SetMaxSize (config.bufferSize);
+          Ptr<PausableQueueDiscClass> c = CreateObject<PausableQueueDiscClass> ();
+          c->SetQueueDisc (qd);
+          qdisc->AddQueueDiscClass (c);
         }
     }
 
+  if (config.hasSharedBuffer) // Configure the shared buffer after PFC is installed
+    {
+      tc->ConfigSharedBuffer (config.sharedBuffer);
+    }
+
   return {.type = DcTopology::TopoNode::NodeType::SWITCH, .nodePtr = sw};
-}  
+}
 
 static void
 LoadHosts (const google::protobuf::RepeatedPtrField<ns3_proto::HostGroup> &hostGroups,
-           Ptr<DcTopology> topology)
+           const std::vector<uint32_t> &systemIds, Ptr<DcTopology> topology)
 {
+  ObjectFactory queueFactory;
+  queueFactory.SetTypeId (DropTailQueue<Packet>::GetTypeId ());
+  queueFactory.Set ("MaxSize",
+                    QueueSizeValue ({QueueSizeUnit::PACKETS, std::numeric_limits<uint32_t>::max ()}));
   for (const ns3_proto::HostGroup &hostGroup : hostGroups)
     {
-      uint32_t num = hostGroup.nodesnum ();
-      uint32_t baseIndex = hostGroup.baseindex ();
+      // The hosts of a group share one configured stack helper
+      DcbHostStackHelper hostStack;
+      const uint32_t num = hostGroup.nodesnum ();
+      const uint32_t baseIndex = hostGroup.baseindex ();
       for (size_t i = baseIndex; i < baseIndex + num; i++)
         {
-          DcTopology::TopoNode host = CreateOneHost (hostGroup);
+          DcTopology::TopoNode host = CreateOneHost (hostGroup, systemIds[i], hostStack, queueFactory);
           topology->InstallNode (i, std::move (host));
+          topology->ReserveLinks (i, hostGroup.ports_size ());
         }
     }
 }
 
 static void
 LoadSwitches (const google::protobuf::RepeatedPtrField<ns3_proto::SwitchGroup> &switchGroups,
-              Ptr<DcTopology> topology)
+              const std::vector<uint32_t> &systemIds, Ptr<DcTopology> topology)
 {
+  ObjectFactory queueFactory;
+  queueFactory.SetTypeId (DropTailQueue<Packet>::GetTypeId ());
+  queueFactory.Set ("MaxSize", QueueSizeValue (QueueSize ("10p")));
+  ObjectFactory ecnFactory;
+  ecnFactory.SetTypeId (FifoQueueDiscEcn::GetTypeId ());
   for (const ns3_proto::SwitchGroup &switchGroup : switchGroups)
     {
+      // The switches of a group share the parsed configurations and one
+      // configured stack helper
+      const SwitchGroupConfig config = ParseSwitchGroup (switchGroup);
+      DcbSwitchStackHelper switchStack;
+      switchStack.SetBufferSize (config.bufferSize);
+      switchStack.SetLoadBalancing (config.loadBalancing, config.flowletGap);
+      switchStack.SetIntEnabled (switchGroup.intenabled ());
       const uint32_t num = switchGroup.nodesnum ();
       const uint32_t baseIndex = switchGroup.baseindex ();
-      const uint32_t queueNum = switchGroup.queuenum ();
       for (size_t i = baseIndex; i < baseIndex + num; i++)
         {
-          DcTopology::TopoNode host = CreateOneSwitch (queueNum, switchGroup);
-          topology->InstallNode (i, std::move (host));
+          DcTopology::TopoNode sw =
+              CreateOneSwitch (config, systemIds[i], switchStack, queueFactory, ecnFactory);
+          topology->InstallNode (i, std::move (sw));
+          topology->ReserveLinks (i, switchGroup.ports_size ());
         }
     }
 }
 
+/**
+ * Link rates and delays parsed once per distinct string, since most links of a
+ * topology share a few of them.
+ */
+struct LinkAttributeCache
+{
+  std::map<std::string, DataRateValue> rates;
+  std::map<std::string, TimeValue> delays;
+
+  const DataRateValue &
+  GetRate (const std::string &rate)
+  {
+    auto it = rates.find (rate);
+    if (it == rates.end ())
+      {
+        it = rates.emplace (rate, DataRateValue (DataRate (rate))).first;
+      }
+    return it->second;
+  }
+
+  const TimeValue &
+  GetDelay (const std::string &delay)
+  {
+    auto it = delays.find (delay);
+    if (it == delays.end ())
+      {
+        it = delays.emplace (delay, TimeValue (Time (delay))).first;
+      }
+    return it->second;
+  }
+};
+
 static void
-InstallLink (const ns3_proto::Link &linkConfig, Ptr<DcTopology> topology)
+InstallLink (const ns3_proto::Link &linkConfig, Ptr<DcTopology> topology,
+             LinkAttributeCache &attributes)
 {
   uint32_t node1 = linkConfig.node1 ();
   uint32_t node2 = linkConfig.node2 ();
@@ -251,13 +546,37 @@ InstallLink (const ns3_proto::Link &linkConfig, Ptr<DcTopology> topology)
   Ptr<DcbNetDevice> dev1 = StaticCast<DcbNetDevice> (topology->GetNetDeviceOfNode (node1, port1));
   Ptr<DcbNetDevice> dev2 = StaticCast<DcbNetDevice> (topology->GetNetDeviceOfNode (node2, port2));
 
-  std::string rate = linkConfig.rate ();
-  std::string delay = linkConfig.delay ();
-  dev1->SetAttribute ("DataRate", DataRateValue (DataRate (rate)));
-  dev2->SetAttribute ("DataRate", DataRateValue (DataRate (rate)));
+  const DataRateValue &rate = attributes.GetRate (linkConfig.rate ());
+  dev1->SetAttribute ("DataRate", rate);
+  dev2->SetAttribute ("DataRate", rate);
 
-  Ptr<DcbChannel> channel = CreateObject<DcbChannel> ();
-  channel->SetAttribute ("Delay", TimeValue (Time (delay)));
+  Ptr<DcbChannel> channel;
+  bool isRemote = false;
+#ifdef NS3_MPI
+  if (MpiInterface::IsEnabled ())
+    {
+      // Same rule as PointToPointHelper: a link touching any node outside this
+      // rank goes through MPI, and both ends get a receiver for remote packets.
+      const uint32_t ownSystemId = MpiInterface::GetSystemId ();
+      isRemote = dev1->GetNode ()->GetSystemId () != ownSystemId ||
+                 dev2->GetNode ()->GetSystemId () != ownSystemId;
+    }
+  if (isRemote)
+    {
+      channel = CreateObject<DcbRemoteChannel> ();
+      for (Ptr<DcbNetDevice> dev : {dev1, dev2})
+        {
+          Ptr<MpiReceiver> mpiRec = CreateObject<MpiReceiver> ();
+          mpiRec->SetReceiveCallback (MakeCallback (&DcbNetDevice::Receive, dev));
+          dev->AggregateObject (mpiRec);
+        }
+    }
+#endif
+  if (!isRemote)
+    {
+      channel = CreateObject<DcbChannel> ();
+    }
+  channel->SetAttribute ("Delay", attributes.GetDelay (linkConfig.delay ()));
 
   dev1->Attach (channel);
   dev2->Attach (channel);
@@ -269,9 +588,10 @@ static void
 LoadLinks (const google::protobuf::RepeatedPtrField<ns3_proto::Link> &linksConfig,
            Ptr<DcTopology> topology)
 {
+  LinkAttributeCache attributes;
   for (const ns3_proto::Link &linkConfig : linksConfig)
     {
-      InstallLink (linkConfig, topology);
+      InstallLink (linkConfig, topology, attributes);
     }
 }
 
@@ -299,9 +619,22 @@ AssignAddress (const Ptr<Node> node, const Ptr<NetDevice> device)
 }
   
 static void
-InitGlobalRouting ()
+InitGlobalRouting (Ptr<DcTopology> topology)
 {
-  Ipv4GlobalRoutingHelper::PopulateRoutingTables ();
+  // Equal-cost routes to hosts are found by BFS on the topology rather than by
+  // the SPF per node that Ipv4GlobalRoutingHelper::PopulateRoutingTables runs.
+  DcRoutingHelper::PopulateRoutingTables (topology);
+
+  // Switches forward through DcbTrafficControl's table built from the global routes
+  for (DcTopology::SwitchIterator sw = topology->switches_begin (); sw != topology->switches_end ();
+       sw++)
+    {
+      Ptr<DcbTrafficControl> dcbTc = (*sw)->GetObject<DcbTrafficControl> ();
+      if (dcbTc)
+        {
+          dcbTc->BuildForwardingTable ();
+        }
+    }
 }
 
 [[maybe_unused]]
@@ -30,6 +30,9 @@
 #include "ns3/dcb-switch-stack-helper.h"
 #include "ns3/configurations.pb.h"
 #include <functional>
+#include <string>
+#include <utility>
+#include <vector>
 
 /**
  * \file
@@ -46,7 +49,17 @@ namespace ns3 {
  */
 namespace topology {
 
-  Ptr<DcTopology> LoadTopology (const ns3_proto::Configurations &configurations);
+  /// Wall-clock milliseconds of each phase of LoadTopology, in order
+  typedef std::vector<std::pair<std::string, int64_t>> LoadPhaseTimes;
+
+  /**
+   * Create the nodes, links, addresses and routes of the topology.  The nodes
+   * of a group are built from one parsed configuration and stack helper.
+   *
+   * \param phaseTimes if not null, the time of each phase is appended to it
+   */
+  Ptr<DcTopology> LoadTopology (const ns3_proto::Configurations &configurations,
+                                LoadPhaseTimes *phaseTimes = nullptr);
   
 } // namespace topology_loader
 
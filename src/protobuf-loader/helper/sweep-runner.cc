@@ -0,0 +1,549 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg (pavin0702@gmail.com)
+ */
+
+#include "sweep-runner.h"
+#include "configurations-loader.h"
+#include "ns3/data-rate.h"
+#include "ns3/fatal-error.h"
+#include "ns3/fct-statistics.h"
+#include "ns3/log.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/system-path.h"
+#include "ns3/tracer-extension.h"
+#include <cstdio>
+#include <functional>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("SweepRunner");
+
+namespace configurations {
+
+static const std::string fctSummaryName = "fct-summary.csv";
+
+ns3_proto::Sweep
+LoadSweep (const std::string &binName /* = sweepBinaryName*/)
+{
+  std::fstream input (binName, std::ios::in | std::ios::binary);
+  if (!input)
+    {
+      NS_FATAL_ERROR ("cannot find file "
+                      << binName << " which should be created by the Python script with Protobuf");
+    }
+
+  ns3_proto::Sweep sweep;
+  if (!sweep.ParseFromIstream (&input))
+    {
+      NS_FATAL_ERROR ("cannot parse binary file " << binName
+                                                  << " which should be a Protobuf serialized file");
+    }
+  return sweep;
+}
+
+static void
+ApplyParameter (ns3_proto::Configurations &conf, const std::string &name,
+                const std::string &value)
+{
+  if (name == "ecnKMin" || name == "ecnKMax" || name == "pfcXon")
+    {
+      for (auto &group : *conf.mutable_topology ()->mutable_nodes ()->mutable_switchgroups ())
+        {
+          for (auto &port : *group.mutable_ports ())
+            {
+              for (auto &queue : *port.mutable_queues ())
+                {
+                  if (name == "ecnKMin")
+                    {
+                      queue.set_ecnkmin (value);
+                    }
+                  else if (name == "ecnKMax")
+                    {
+                      queue.set_ecnkmax (value);
+                    }
+                  else
+                    {
+                      queue.set_pfcxon (value);
+                    }
+                }
+            }
+        }
+    }
+  else if (name == "load" || name == "cdf")
+    {
+      for (auto &app : *conf.mutable_applications ())
+        {
+          if (name == "load")
+            {
+              app.set_load (std::stod (value));
+            }
+          else
+            {
+              app.set_arg (value);
+            }
+        }
+    }
+  else
+    {
+      NS_FATAL_ERROR ("Cannot sweep parameter \"" << name << "\"");
+    }
+}
+
+/**
+ * \return the parameter values of a point, the points enumerating the
+ * combinations with the last parameter varying fastest
+ */
+static std::vector<std::string>
+GetPointValues (const ns3_proto::Sweep &sweep, uint32_t point)
+{
+  std::vector<std::string> values (sweep.parameters_size ());
+  for (int i = sweep.parameters_size () - 1; i >= 0; i--)
+    {
+      const ns3_proto::SweepParameter &param = sweep.parameters (i);
+      values[i] = param.values (point % param.values_size ());
+      point /= param.values_size ();
+    }
+  return values;
+}
+
+static std::string
+GetRunName (uint32_t point, uint32_t run)
+{
+  return "p" + std::to_string (point) + "-r" + std::to_string (run);
+}
+
+/**
+ * \return a hash of everything a run depends on, i.e., the configurations with
+ * the values of the point applied, the RngRun and the other fields of the
+ * sweep, but not the other points.  It is recorded with the run name in
+ * progress.txt, so that a finished run is skipped only if the sweep it was
+ * run by gives it the same values.
+ */
+static std::string
+GetRunKey (const ns3_proto::Sweep &sweep, const std::vector<std::string> &values, uint32_t run)
+{
+  ns3_proto::Sweep spec = sweep;
+  for (int i = 0; i < sweep.parameters_size (); i++)
+    {
+      ApplyParameter (*spec.mutable_base (), sweep.parameters (i).name (), values[i]);
+    }
+  spec.clear_parameters ();
+  spec.clear_runs ();
+  spec.clear_outputdir ();
+  const std::string bytes = spec.SerializeAsString () + "," + std::to_string (run);
+
+  uint64_t hash = 14695981039346656037ull; // FNV-1a, stable across builds
+  for (unsigned char c : bytes)
+    {
+      hash = (hash ^ c) * 1099511628211ull;
+    }
+  std::ostringstream oss;
+  oss << std::hex << std::setw (16) << std::setfill ('0') << hash;
+  return oss.str ();
+}
+
+/**
+ * \return whether the parameter changes the topology rather than the
+ * applications, i.e., whether runs with different values of it cannot share a
+ * loaded topology
+ */
+static bool
+IsTopologyParameter (const std::string &name)
+{
+  return name == "ecnKMin" || name == "ecnKMax" || name == "pfcXon";
+}
+
+/**
+ * Run one point of the sweep on a topology loaded by the parent process.
+ */
+static void
+RunOne (const ns3_proto::Sweep &sweep, const std::vector<std::string> &values, uint32_t run,
+        const std::string &dir, Ptr<DcTopology> topology)
+{
+  if (!std::freopen ((dir + "/log.txt").c_str (), "w", stdout))
+    {
+      NS_FATAL_ERROR ("Cannot open the log of run " << dir);
+    }
+  dup2 (fileno (stdout), fileno (stderr));
+
+  ns3_proto::Configurations conf = sweep.base ();
+  for (int i = 0; i < sweep.parameters_size (); i++)
+    {
+      ApplyParameter (conf, sweep.parameters (i).name (), values[i]);
+    }
+  RngSeedManager::SetRun (run);
+
+  std::vector<uint64_t> sizeBins (sweep.fctsizebins ().begin (), sweep.fctsizebins ().end ());
+  if (sizeBins.empty () && conf.applications_size () && conf.applications (0).has_arg ())
+    {
+      TraceApplication::TraceCdf *cdf = GetTraceCdf (conf.applications (0).arg ());
+      if (cdf)
+        {
+          sizeBins = FctStatistics::GetSizeBins (*cdf);
+        }
+    }
+  if (!sweep.has_linerate () && conf.topology ().links_size () == 0)
+    {
+      NS_FATAL_ERROR ("The sweep needs lineRate for a topology without links");
+    }
+  const DataRate lineRate (sweep.has_linerate () ? sweep.linerate ()
+                                                 : conf.topology ().links (0).rate ());
+  const Time stopTime (sweep.stoptime ());
+
+  tracer_extension::ConfigOutputDirectory (dir);
+  InstallApplications (conf, topology);
+  if (sweep.has_basertt ())
+    {
+      tracer_extension::ConfigFctStatistics (tracer_extension::Protocol::RoCEv2, fctSummaryName,
+                                             sizeBins, lineRate, Time (sweep.basertt ()));
+    }
+  else
+    {
+      tracer_extension::ConfigFctStatistics (tracer_extension::Protocol::RoCEv2, fctSummaryName,
+                                             sizeBins, lineRate, GetPathBaseRtt (conf, topology));
+    }
+  tracer_extension::ConfigStopTime (stopTime);
+  Simulator::Stop (stopTime);
+  Simulator::Run ();
+  Simulator::Destroy ();
+  tracer_extension::CleanTracers ();
+}
+
+namespace {
+
+/**
+ * A run of the sweep, i.e., a point and an RngRun.
+ */
+struct SweepJob
+{
+  uint32_t point;
+  uint32_t run;
+  std::string name;
+  std::string key; //!< see GetRunKey
+};
+
+/**
+ * Forked processes with a bounded number of slots in use at a time, where a
+ * process may hold several slots for the processes it forks in turn.
+ */
+class ForkPool
+{
+public:
+  /// Called with the wait status of a process when it is reaped
+  typedef std::function<void (int status)> ExitCallback;
+
+  explicit ForkPool (uint32_t slots) : m_slots (slots), m_used (0)
+  {
+  }
+
+  /**
+   * Wait for a free slot, then fork a process holding up to maxSlots free
+   * slots.  The process runs f with the number of slots it holds and exits
+   * with the return value.
+   */
+  void
+  Fork (uint32_t maxSlots, const std::function<int (uint32_t slots)> &f, ExitCallback onExit)
+  {
+    while (m_used >= m_slots)
+      {
+        WaitOne ();
+      }
+    const uint32_t slots = std::max (1u, std::min (maxSlots, m_slots - m_used));
+    std::cout.flush ();
+    std::fflush (nullptr);
+    const pid_t pid = fork ();
+    if (pid < 0)
+      {
+        NS_FATAL_ERROR ("Cannot fork a process of the sweep");
+      }
+    if (pid == 0)
+      {
+        const int status = f (slots);
+        std::cout.flush ();
+        std::fflush (nullptr);
+        _exit (status); // skip the destructors of the states copied from the parent
+      }
+    m_running[pid] = {slots, std::move (onExit)};
+    m_used += slots;
+  }
+
+  void
+  WaitAll ()
+  {
+    while (!m_running.empty ())
+      {
+        WaitOne ();
+      }
+  }
+
+private:
+  void
+  WaitOne ()
+  {
+    int status;
+    const pid_t pid = waitpid (-1, &status, 0);
+    if (pid < 0)
+      {
+        NS_FATAL_ERROR ("Lost track of the processes of the sweep");
+      }
+    auto it = m_running.find (pid);
+    if (it == m_running.end ())
+      {
+        return;
+      }
+    m_used -= it->second.slots;
+    const ExitCallback onExit = std::move (it->second.onExit);
+    m_running.erase (it);
+    onExit (status);
+  }
+
+  struct Process
+  {
+    uint32_t slots;
+    ExitCallback onExit;
+  };
+
+  const uint32_t m_slots;
+  uint32_t m_used;
+  std::map<pid_t, Process> m_running;
+};
+
+} // namespace
+
+/**
+ * Load the topology shared by the jobs once and fork one process per job from
+ * it, with at most `slots` of them at a time.  The jobs have the same values
+ * of the topology parameters and the same RngRun, so that each forked process
+ * starts from the very state a fresh process would reach by loading the
+ * topology by itself.
+ *
+ * \return the number of failed jobs
+ */
+static uint32_t
+RunJobsOnTopology (const ns3_proto::Sweep &sweep, const std::vector<SweepJob> &jobs,
+                   uint32_t slots, const std::string &progressFile)
+{
+  const std::vector<std::string> values = GetPointValues (sweep, jobs.front ().point);
+  ns3_proto::Configurations conf = sweep.base ();
+  for (int i = 0; i < sweep.parameters_size (); i++)
+    {
+      if (IsTopologyParameter (sweep.parameters (i).name ()))
+        {
+          ApplyParameter (conf, sweep.parameters (i).name (), values[i]);
+        }
+    }
+  RngSeedManager::SetRun (jobs.front ().run);
+  Ptr<DcTopology> topology = LoadTopology (conf);
+
+  std::ofstream progress (progressFile, std::ios::app);
+  uint32_t nFailed = 0;
+  ForkPool pool (slots);
+  for (const SweepJob &job : jobs)
+    {
+      const std::string dir = sweep.outputdir () + "/" + job.name;
+      SystemPath::MakeDirectories (dir);
+      pool.Fork (
+          1,
+          [&] (uint32_t) {
+            RunOne (sweep, GetPointValues (sweep, job.point), job.run, dir, topology);
+            return 0;
+          },
+          [&, name = job.name, key = job.key] (int status) {
+            if (WIFEXITED (status) && WEXITSTATUS (status) == 0)
+              {
+                progress << name << " " << key << std::endl;
+                NS_LOG_INFO ("Run " << name << " done");
+              }
+            else
+              {
+                nFailed++;
+                std::cerr << "Run " << name << " failed, see " << sweep.outputdir () << "/"
+                          << name << "/log.txt" << std::endl;
+              }
+          });
+    }
+  pool.WaitAll ();
+  return nFailed;
+}
+
+static void
+WriteResults (const ns3_proto::Sweep &sweep, uint32_t nPoints, const std::string &fileName)
+{
+  std::ofstream ofs (fileName);
+  if (!ofs.good ())
+    {
+      NS_FATAL_ERROR ("Cannot open file \"" << fileName << "\"");
+    }
+  bool headerWritten = false;
+  for (uint32_t point = 0; point < nPoints; point++)
+    {
+      std::string prefix;
+      for (const std::string &value : GetPointValues (sweep, point))
+        {
+          prefix += "," + value;
+        }
+      for (uint32_t run = 1; run <= sweep.runs (); run++)
+        {
+          std::ifstream summary (sweep.outputdir () + "/" + GetRunName (point, run) + "/" +
+                                 fctSummaryName);
+          std::string line;
+          if (!std::getline (summary, line))
+            {
+              continue; // the run failed or has no flow completed
+            }
+          if (!headerWritten)
+            {
+              ofs << "point,run";
+              for (const auto &param : sweep.parameters ())
+                {
+                  ofs << "," << param.name ();
+                }
+              ofs << "," << line << "\n";
+              headerWritten = true;
+            }
+          while (std::getline (summary, line))
+            {
+              ofs << point << "," << run << prefix << "," << line << "\n";
+            }
+        }
+    }
+}
+
+uint32_t
+RunSweep (const ns3_proto::Sweep &sweep, uint32_t nProcesses)
+{
+  if (sweep.stoptime ().empty ())
+    {
+      NS_FATAL_ERROR ("The sweep should have a stopTime");
+    }
+  if (sweep.runs () == 0)
+    {
+      NS_FATAL_ERROR ("The sweep should have at least one run of each point");
+    }
+  if (nProcesses == 0)
+    {
+      nProcesses = std::max (1u, std::thread::hardware_concurrency ());
+    }
+  uint32_t nPoints = 1;
+  for (const auto &param : sweep.parameters ())
+    {
+      if (param.values_size () == 0)
+        {
+          NS_FATAL_ERROR ("The swept parameter \"" << param.name () << "\" has no value");
+        }
+      nPoints *= param.values_size ();
+    }
+  { // check the parameter names before forking
+    ns3_proto::Configurations conf = sweep.base ();
+    for (const auto &param : sweep.parameters ())
+      {
+        ApplyParameter (conf, param.name (), param.values (0));
+      }
+  }
+
+  SystemPath::MakeDirectories (sweep.outputdir ());
+  const std::string progressFile = sweep.outputdir () + "/progress.txt";
+  std::set<std::pair<std::string, std::string>> done; // name and key of the finished runs
+  {
+    std::ifstream ifs (progressFile);
+    std::string line;
+    while (std::getline (ifs, line))
+      {
+        std::istringstream iss (line);
+        std::string name, key;
+        if (iss >> name >> key)
+          {
+            done.emplace (name, key);
+          }
+      }
+  }
+  NS_LOG_INFO ("Sweep of " << nPoints << " points and " << sweep.runs () << " runs each, "
+                           << done.size () << " runs done before");
+
+  // Runs that differ only in the application parameters share a loaded topology
+  std::vector<std::vector<SweepJob>> groups;
+  std::map<std::string, size_t> groupIndex;
+  for (uint32_t point = 0; point < nPoints; point++)
+    {
+      const std::vector<std::string> values = GetPointValues (sweep, point);
+      for (uint32_t run = 1; run <= sweep.runs (); run++)
+        {
+          const std::string name = GetRunName (point, run);
+          const std::string key = GetRunKey (sweep, values, run);
+          if (done.count ({name, key}))
+            {
+              continue;
+            }
+          std::string group = std::to_string (run);
+          for (int i = 0; i < sweep.parameters_size (); i++)
+            {
+              if (IsTopologyParameter (sweep.parameters (i).name ()))
+                {
+                  group += "," + values[i];
+                }
+            }
+          auto it = groupIndex.emplace (group, groups.size ()).first;
+          if (it->second == groups.size ())
+            {
+              groups.emplace_back ();
+            }
+          groups[it->second].push_back ({point, run, name, key});
+        }
+    }
+
+  uint32_t nFailed = 0;
+  ForkPool pool (nProcesses);
+  for (const std::vector<SweepJob> &jobs : groups)
+    {
+      pool.Fork (
+          jobs.size (),
+          [&] (uint32_t slots) {
+            return static_cast<int> (
+                std::min (RunJobsOnTopology (sweep, jobs, slots, progressFile), 255u));
+          },
+          [&] (int status) {
+            if (WIFEXITED (status))
+              {
+                nFailed += WEXITSTATUS (status);
+              }
+            else
+              {
+                nFailed += jobs.size ();
+                std::cerr << "Loading the topology of run " << jobs.front ().name
+                          << " and the like failed" << std::endl;
+              }
+          });
+    }
+  pool.WaitAll ();
+
+  WriteResults (sweep, nPoints, sweep.outputdir () + "/results.csv");
+  return nFailed;
+}
+
+} // namespace configurations
+
+} // namespace ns3
@@ -0,0 +1,64 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg (pavin0702@gmail.com)
+ */
+
+#ifndef SWEEP_RUNNER_H
+#define SWEEP_RUNNER_H
+
+#include <string>
+#include "ns3/configurations.pb.h"
+
+namespace ns3 {
+
+namespace configurations {
+
+  // Notice: this variable should be consistent with `Configure.serializeSweepTo`
+  // in config/config_helper.py
+  static std::string const sweepBinaryName = "config/sweep.bin";
+
+  ns3_proto::Sweep LoadSweep (const std::string &binName = sweepBinaryName);
+
+  /**
+   * \brief Run every point and run of a sweep, each in a forked process so
+   * that the runs share nothing, with at most nProcesses at a time.
+   *
+   * The topology is loaded only once for the runs that differ only in the
+   * application parameters (load and cdf): a process loads it and forks the
+   * runs from there, so a run skips the setup of the topology.  Those runs
+   * have the same RngRun, so the results are the same as loading the
+   * topology in every run.
+   *
+   * Each run writes its log and FCT summary into its own directory under
+   * sweep.outputDir().  A finished run is appended to progress.txt there with
+   * a hash of the values it was run with, and skipped when the sweep is run
+   * again with the same values, so an interrupted sweep resumes.  A run
+   * whose values changed, e.g., because a parameter got a new value in
+   * between, is run again.
+   * Finally the FCT summaries of all runs are collected into results.csv with
+   * the point, the run and the parameter values as leading columns.
+   *
+   * This should be called before creating any simulation object.
+   *
+   * \return the number of runs that failed
+   */
+  uint32_t RunSweep (const ns3_proto::Sweep &sweep, uint32_t nProcesses);
+
+} // namespace configurations
+
+} // namespace ns3
+
+#endif // SWEEP_RUNNER_H
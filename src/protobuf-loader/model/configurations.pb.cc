@@ -25,7 +25,8 @@ PROTOBUF_CONSTEXPR GlobalConfig::GlobalConfig(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_._has_bits_)*/{}
   , /*decltype(_impl_._cached_size_)*/{}
-  , /*decltype(_impl_.outputfct_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+  , /*decltype(_impl_.outputfct_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.binarytrace_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
 struct GlobalConfigDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GlobalConfigDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -71,7 +72,8 @@ PROTOBUF_CONSTEXPR PortQueueConfig::PortQueueConfig(
   , /*decltype(_impl_.pfcxon_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.ecnkmin_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.ecnkmax_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.ecnpmax_)*/0} {}
+  , /*decltype(_impl_.ecnpmax_)*/0
+  , /*decltype(_impl_.etsweight_)*/0u} {}
 struct PortQueueConfigDefaultTypeInternal {
   PROTOBUF_CONSTEXPR PortQueueConfigDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -96,13 +98,48 @@ struct SwitchPortConfigDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SwitchPortConfigDefaultTypeInternal _SwitchPortConfig_default_instance_;
+PROTOBUF_CONSTEXPR SharedBufferConfig::SharedBufferConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reserve_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.headroom_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.xonoffset_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.pfcalpha_)*/0
+  , /*decltype(_impl_.ecnalpha_)*/0} {}
+struct SharedBufferConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SharedBufferConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SharedBufferConfigDefaultTypeInternal() {}
+  union {
+    SharedBufferConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SharedBufferConfigDefaultTypeInternal _SharedBufferConfig_default_instance_;
+PROTOBUF_CONSTEXPR LoadBalanceConfig::LoadBalanceConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.flowletgap_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.mode_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LoadBalanceConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LoadBalanceConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LoadBalanceConfigDefaultTypeInternal() {}
+  union {
+    LoadBalanceConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LoadBalanceConfigDefaultTypeInternal _LoadBalanceConfig_default_instance_;
 PROTOBUF_CONSTEXPR SwitchGroup::SwitchGroup(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.ports_)*/{}
   , /*decltype(_impl_.buffersize_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sharedbuffer_)*/nullptr
+  , /*decltype(_impl_.loadbalance_)*/nullptr
   , /*decltype(_impl_.nodesnum_)*/0u
   , /*decltype(_impl_.baseindex_)*/0u
   , /*decltype(_impl_.queuenum_)*/0u
+  , /*decltype(_impl_.intenabled_)*/false
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct SwitchGroupDefaultTypeInternal {
   PROTOBUF_CONSTEXPR SwitchGroupDefaultTypeInternal()
@@ -117,6 +154,8 @@ PROTOBUF_CONSTEXPR AllNodes::AllNodes(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.hostgroups_)*/{}
   , /*decltype(_impl_.switchgroups_)*/{}
+  , /*decltype(_impl_.systemids_)*/{}
+  , /*decltype(_impl_._systemids_cached_byte_size_)*/{0}
   , /*decltype(_impl_.num_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct AllNodesDefaultTypeInternal {
@@ -157,6 +196,7 @@ PROTOBUF_CONSTEXPR Application::Application(
   , /*decltype(_impl_.arg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.starttime_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.stoptime_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.filename_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.load_)*/0
   , /*decltype(_impl_.dest_)*/0u} {}
 struct ApplicationDefaultTypeInternal {
@@ -197,9 +237,45 @@ struct ConfigurationsDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfigurationsDefaultTypeInternal _Configurations_default_instance_;
+PROTOBUF_CONSTEXPR SweepParameter::SweepParameter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.values_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SweepParameterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SweepParameterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SweepParameterDefaultTypeInternal() {}
+  union {
+    SweepParameter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SweepParameterDefaultTypeInternal _SweepParameter_default_instance_;
+PROTOBUF_CONSTEXPR Sweep::Sweep(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.parameters_)*/{}
+  , /*decltype(_impl_.fctsizebins_)*/{}
+  , /*decltype(_impl_._fctsizebins_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.outputdir_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.stoptime_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.linerate_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.basertt_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.base_)*/nullptr
+  , /*decltype(_impl_.runs_)*/0u} {}
+struct SweepDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SweepDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SweepDefaultTypeInternal() {}
+  union {
+    Sweep _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SweepDefaultTypeInternal _Sweep_default_instance_;
 }  // namespace ns3_proto
-static ::_pb::Metadata file_level_metadata_configurations_2eproto[11];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_configurations_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_configurations_2eproto[15];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_configurations_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_configurations_2eproto = nullptr;
 
 const uint32_t TableStruct_configurations_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -210,7 +286,9 @@ const uint32_t TableStruct_configurations_2eproto::offsets[] PROTOBUF_SECTION_VA
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::ns3_proto::GlobalConfig, _impl_.outputfct_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::GlobalConfig, _impl_.binarytrace_),
   0,
+  1,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::ns3_proto::HostPortConfig, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -238,11 +316,13 @@ const uint32_t TableStruct_configurations_2eproto::offsets[] PROTOBUF_SECTION_VA
   PROTOBUF_FIELD_OFFSET(::ns3_proto::PortQueueConfig, _impl_.ecnkmin_),
   PROTOBUF_FIELD_OFFSET(::ns3_proto::PortQueueConfig, _impl_.ecnkmax_),
   PROTOBUF_FIELD_OFFSET(::ns3_proto::PortQueueConfig, _impl_.ecnpmax_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::PortQueueConfig, _impl_.etsweight_),
   0,
   1,
   2,
   3,
   4,
+  5,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::ns3_proto::SwitchPortConfig, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -252,6 +332,30 @@ const uint32_t TableStruct_configurations_2eproto::offsets[] PROTOBUF_SECTION_VA
   PROTOBUF_FIELD_OFFSET(::ns3_proto::SwitchPortConfig, _impl_.pfcenabled_),
   PROTOBUF_FIELD_OFFSET(::ns3_proto::SwitchPortConfig, _impl_.ecnenabled_),
   PROTOBUF_FIELD_OFFSET(::ns3_proto::SwitchPortConfig, _impl_.queues_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::SharedBufferConfig, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::SharedBufferConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::SharedBufferConfig, _impl_.reserve_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::SharedBufferConfig, _impl_.headroom_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::SharedBufferConfig, _impl_.pfcalpha_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::SharedBufferConfig, _impl_.xonoffset_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::SharedBufferConfig, _impl_.ecnalpha_),
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::LoadBalanceConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::LoadBalanceConfig, _impl_.mode_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::LoadBalanceConfig, _impl_.flowletgap_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::ns3_proto::SwitchGroup, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -263,6 +367,9 @@ const uint32_t TableStruct_configurations_2eproto::offsets[] PROTOBUF_SECTION_VA
   PROTOBUF_FIELD_OFFSET(::ns3_proto::SwitchGroup, _impl_.buffersize_),
   PROTOBUF_FIELD_OFFSET(::ns3_proto::SwitchGroup, _impl_.queuenum_),
   PROTOBUF_FIELD_OFFSET(::ns3_proto::SwitchGroup, _impl_.ports_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::SwitchGroup, _impl_.sharedbuffer_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::SwitchGroup, _impl_.loadbalance_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::SwitchGroup, _impl_.intenabled_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::ns3_proto::AllNodes, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -272,6 +379,7 @@ const uint32_t TableStruct_configurations_2eproto::offsets[] PROTOBUF_SECTION_VA
   PROTOBUF_FIELD_OFFSET(::ns3_proto::AllNodes, _impl_.num_),
   PROTOBUF_FIELD_OFFSET(::ns3_proto::AllNodes, _impl_.hostgroups_),
   PROTOBUF_FIELD_OFFSET(::ns3_proto::AllNodes, _impl_.switchgroups_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::AllNodes, _impl_.systemids_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::ns3_proto::Link, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -298,14 +406,16 @@ const uint32_t TableStruct_configurations_2eproto::offsets[] PROTOBUF_SECTION_VA
   PROTOBUF_FIELD_OFFSET(::ns3_proto::Application, _impl_.starttime_),
   PROTOBUF_FIELD_OFFSET(::ns3_proto::Application, _impl_.stoptime_),
   PROTOBUF_FIELD_OFFSET(::ns3_proto::Application, _impl_.dest_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::Application, _impl_.filename_),
   ~0u,
   ~0u,
   0,
   1,
-  2,
+  3,
   ~0u,
   ~0u,
-  3,
+  4,
+  2,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::ns3_proto::Topology, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -323,19 +433,53 @@ const uint32_t TableStruct_configurations_2eproto::offsets[] PROTOBUF_SECTION_VA
   PROTOBUF_FIELD_OFFSET(::ns3_proto::Configurations, _impl_.globalconfig_),
   PROTOBUF_FIELD_OFFSET(::ns3_proto::Configurations, _impl_.topology_),
   PROTOBUF_FIELD_OFFSET(::ns3_proto::Configurations, _impl_.applications_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::SweepParameter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::SweepParameter, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::SweepParameter, _impl_.values_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::Sweep, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::Sweep, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::Sweep, _impl_.base_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::Sweep, _impl_.parameters_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::Sweep, _impl_.runs_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::Sweep, _impl_.outputdir_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::Sweep, _impl_.stoptime_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::Sweep, _impl_.linerate_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::Sweep, _impl_.basertt_),
+  PROTOBUF_FIELD_OFFSET(::ns3_proto::Sweep, _impl_.fctsizebins_),
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  1,
+  ~0u,
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, 7, -1, sizeof(::ns3_proto::GlobalConfig)},
-  { 8, -1, -1, sizeof(::ns3_proto::HostPortConfig)},
-  { 15, -1, -1, sizeof(::ns3_proto::HostGroup)},
-  { 24, 35, -1, sizeof(::ns3_proto::PortQueueConfig)},
-  { 40, -1, -1, sizeof(::ns3_proto::SwitchPortConfig)},
-  { 49, -1, -1, sizeof(::ns3_proto::SwitchGroup)},
-  { 60, -1, -1, sizeof(::ns3_proto::AllNodes)},
-  { 69, -1, -1, sizeof(::ns3_proto::Link)},
-  { 81, 95, -1, sizeof(::ns3_proto::Application)},
-  { 103, -1, -1, sizeof(::ns3_proto::Topology)},
-  { 111, -1, -1, sizeof(::ns3_proto::Configurations)},
+  { 0, 8, -1, sizeof(::ns3_proto::GlobalConfig)},
+  { 10, -1, -1, sizeof(::ns3_proto::HostPortConfig)},
+  { 17, -1, -1, sizeof(::ns3_proto::HostGroup)},
+  { 26, 38, -1, sizeof(::ns3_proto::PortQueueConfig)},
+  { 44, -1, -1, sizeof(::ns3_proto::SwitchPortConfig)},
+  { 53, 64, -1, sizeof(::ns3_proto::SharedBufferConfig)},
+  { 69, -1, -1, sizeof(::ns3_proto::LoadBalanceConfig)},
+  { 77, -1, -1, sizeof(::ns3_proto::SwitchGroup)},
+  { 91, -1, -1, sizeof(::ns3_proto::AllNodes)},
+  { 101, -1, -1, sizeof(::ns3_proto::Link)},
+  { 113, 128, -1, sizeof(::ns3_proto::Application)},
+  { 137, -1, -1, sizeof(::ns3_proto::Topology)},
+  { 145, -1, -1, sizeof(::ns3_proto::Configurations)},
+  { 154, -1, -1, sizeof(::ns3_proto::SweepParameter)},
+  { 162, 176, -1, sizeof(::ns3_proto::Sweep)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -344,54 +488,79 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::ns3_proto::_HostGroup_default_instance_._instance,
   &::ns3_proto::_PortQueueConfig_default_instance_._instance,
   &::ns3_proto::_SwitchPortConfig_default_instance_._instance,
+  &::ns3_proto::_SharedBufferConfig_default_instance_._instance,
+  &::ns3_proto::_LoadBalanceConfig_default_instance_._instance,
   &::ns3_proto::_SwitchGroup_default_instance_._instance,
   &::ns3_proto::_AllNodes_default_instance_._instance,
   &::ns3_proto::_Link_default_instance_._instance,
   &::ns3_proto::_Application_default_instance_._instance,
   &::ns3_proto::_Topology_default_instance_._instance,
   &::ns3_proto::_Configurations_default_instance_._instance,
+  &::ns3_proto::_SweepParameter_default_instance_._instance,
+  &::ns3_proto::_Sweep_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_configurations_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\024configurations.proto\022\tns3_proto\"4\n\014Glo"
-  "balConfig\022\026\n\toutputFct\030\001 \001(\tH\000\210\001\001B\014\n\n_ou"
-  "tputFct\"$\n\016HostPortConfig\022\022\n\npfcEnabled\030"
-  "\001 \001(\010\"Z\n\tHostGroup\022\020\n\010nodesNum\030\001 \001(\r\022\021\n\t"
-  "baseIndex\030\002 \001(\r\022(\n\005ports\030\003 \003(\0132\031.ns3_pro"
-  "to.HostPortConfig\"\277\001\n\017PortQueueConfig\022\027\n"
-  "\npfcReserve\030\001 \001(\tH\000\210\001\001\022\023\n\006pfcXon\030\002 \001(\tH\001"
-  "\210\001\001\022\024\n\007ecnKMin\030\004 \001(\tH\002\210\001\001\022\024\n\007ecnKMax\030\005 \001"
-  "(\tH\003\210\001\001\022\024\n\007ecnPMax\030\006 \001(\001H\004\210\001\001B\r\n\013_pfcRes"
-  "erveB\t\n\007_pfcXonB\n\n\010_ecnKMinB\n\n\010_ecnKMaxB"
-  "\n\n\010_ecnPMax\"f\n\020SwitchPortConfig\022\022\n\npfcEn"
+  "\n\024configurations.proto\022\tns3_proto\"^\n\014Glo"
+  "balConfig\022\026\n\toutputFct\030\001 \001(\tH\000\210\001\001\022\030\n\013bin"
+  "aryTrace\030\002 \001(\tH\001\210\001\001B\014\n\n_outputFctB\016\n\014_bi"
+  "naryTrace\"$\n\016HostPortConfig\022\022\n\npfcEnable"
+  "d\030\001 \001(\010\"Z\n\tHostGroup\022\020\n\010nodesNum\030\001 \001(\r\022\021"
+  "\n\tbaseIndex\030\002 \001(\r\022(\n\005ports\030\003 \003(\0132\031.ns3_p"
+  "roto.HostPortConfig\"\345\001\n\017PortQueueConfig\022"
+  "\027\n\npfcReserve\030\001 \001(\tH\000\210\001\001\022\023\n\006pfcXon\030\002 \001(\t"
+  "H\001\210\001\001\022\024\n\007ecnKMin\030\004 \001(\tH\002\210\001\001\022\024\n\007ecnKMax\030\005"
+  " \001(\tH\003\210\001\001\022\024\n\007ecnPMax\030\006 \001(\001H\004\210\001\001\022\026\n\tetsWe"
+  "ight\030\007 \001(\rH\005\210\001\001B\r\n\013_pfcReserveB\t\n\007_pfcXo"
+  "nB\n\n\010_ecnKMinB\n\n\010_ecnKMaxB\n\n\010_ecnPMaxB\014\n"
+  "\n_etsWeight\"f\n\020SwitchPortConfig\022\022\n\npfcEn"
   "abled\030\001 \001(\010\022\022\n\necnEnabled\030\002 \001(\010\022*\n\006queue"
-  "s\030\003 \003(\0132\032.ns3_proto.PortQueueConfig\"\204\001\n\013"
-  "SwitchGroup\022\020\n\010nodesNum\030\001 \001(\r\022\021\n\tbaseInd"
-  "ex\030\002 \001(\r\022\022\n\nbufferSize\030\003 \001(\t\022\020\n\010queueNum"
-  "\030\004 \001(\r\022*\n\005ports\030\005 \003(\0132\033.ns3_proto.Switch"
-  "PortConfig\"o\n\010AllNodes\022\013\n\003num\030\001 \001(\r\022(\n\nh"
-  "ostGroups\030\002 \003(\0132\024.ns3_proto.HostGroup\022,\n"
-  "\014switchGroups\030\003 \003(\0132\026.ns3_proto.SwitchGr"
-  "oup\"_\n\004Link\022\r\n\005node1\030\001 \001(\r\022\r\n\005node2\030\002 \001("
-  "\r\022\r\n\005port1\030\003 \001(\r\022\r\n\005port2\030\004 \001(\r\022\014\n\004rate\030"
-  "\005 \001(\t\022\r\n\005delay\030\006 \001(\t\"\330\001\n\013Application\022\023\n\013"
-  "nodeIndices\030\001 \003(\r\022\017\n\007appName\030\002 \001(\t\022\032\n\rpr"
-  "otocolGroup\030\003 \001(\tH\000\210\001\001\022\020\n\003arg\030\004 \001(\tH\001\210\001\001"
-  "\022\021\n\004load\030\005 \001(\001H\002\210\001\001\022\021\n\tstartTime\030\006 \001(\t\022\020"
-  "\n\010stopTime\030\007 \001(\t\022\021\n\004dest\030\010 \001(\rH\003\210\001\001B\020\n\016_"
-  "protocolGroupB\006\n\004_argB\007\n\005_loadB\007\n\005_dest\""
-  "N\n\010Topology\022\"\n\005nodes\030\001 \001(\0132\023.ns3_proto.A"
-  "llNodes\022\036\n\005links\030\002 \003(\0132\017.ns3_proto.Link\""
-  "\224\001\n\016Configurations\022-\n\014globalConfig\030\001 \001(\013"
-  "2\027.ns3_proto.GlobalConfig\022%\n\010topology\030\002 "
-  "\001(\0132\023.ns3_proto.Topology\022,\n\014applications"
-  "\030\003 \003(\0132\026.ns3_proto.Applicationb\006proto3"
+  "s\030\003 \003(\0132\032.ns3_proto.PortQueueConfig\"\200\001\n\022"
+  "SharedBufferConfig\022\017\n\007reserve\030\001 \001(\t\022\020\n\010h"
+  "eadroom\030\002 \001(\t\022\020\n\010pfcAlpha\030\003 \001(\001\022\021\n\txonOf"
+  "fset\030\004 \001(\t\022\025\n\010ecnAlpha\030\005 \001(\001H\000\210\001\001B\013\n\t_ec"
+  "nAlpha\"\237\001\n\021LoadBalanceConfig\022/\n\004mode\030\001 \001"
+  "(\0162!.ns3_proto.LoadBalanceConfig.Mode\022\022\n"
+  "\nflowletGap\030\002 \001(\t\"E\n\004Mode\022\010\n\004ECMP\020\000\022\020\n\014P"
+  "ACKET_SPRAY\020\001\022\013\n\007FLOWLET\020\002\022\024\n\020CONGESTION"
+  "_AWARE\020\003\"\200\002\n\013SwitchGroup\022\020\n\010nodesNum\030\001 \001"
+  "(\r\022\021\n\tbaseIndex\030\002 \001(\r\022\022\n\nbufferSize\030\003 \001("
+  "\t\022\020\n\010queueNum\030\004 \001(\r\022*\n\005ports\030\005 \003(\0132\033.ns3"
+  "_proto.SwitchPortConfig\0223\n\014sharedBuffer\030"
+  "\006 \001(\0132\035.ns3_proto.SharedBufferConfig\0221\n\013"
+  "loadBalance\030\007 \001(\0132\034.ns3_proto.LoadBalanc"
+  "eConfig\022\022\n\nintEnabled\030\010 \001(\010\"\202\001\n\010AllNodes"
+  "\022\013\n\003num\030\001 \001(\r\022(\n\nhostGroups\030\002 \003(\0132\024.ns3_"
+  "proto.HostGroup\022,\n\014switchGroups\030\003 \003(\0132\026."
+  "ns3_proto.SwitchGroup\022\021\n\tsystemIds\030\004 \003(\r"
+  "\"_\n\004Link\022\r\n\005node1\030\001 \001(\r\022\r\n\005node2\030\002 \001(\r\022\r"
+  "\n\005port1\030\003 \001(\r\022\r\n\005port2\030\004 \001(\r\022\014\n\004rate\030\005 \001"
+  "(\t\022\r\n\005delay\030\006 \001(\t\"\374\001\n\013Application\022\023\n\013nod"
+  "eIndices\030\001 \003(\r\022\017\n\007appName\030\002 \001(\t\022\032\n\rproto"
+  "colGroup\030\003 \001(\tH\000\210\001\001\022\020\n\003arg\030\004 \001(\tH\001\210\001\001\022\021\n"
+  "\004load\030\005 \001(\001H\002\210\001\001\022\021\n\tstartTime\030\006 \001(\t\022\020\n\010s"
+  "topTime\030\007 \001(\t\022\021\n\004dest\030\010 \001(\rH\003\210\001\001\022\025\n\010file"
+  "Name\030\t \001(\tH\004\210\001\001B\020\n\016_protocolGroupB\006\n\004_ar"
+  "gB\007\n\005_loadB\007\n\005_destB\013\n\t_fileName\"N\n\010Topo"
+  "logy\022\"\n\005nodes\030\001 \001(\0132\023.ns3_proto.AllNodes"
+  "\022\036\n\005links\030\002 \003(\0132\017.ns3_proto.Link\"\224\001\n\016Con"
+  "figurations\022-\n\014globalConfig\030\001 \001(\0132\027.ns3_"
+  "proto.GlobalConfig\022%\n\010topology\030\002 \001(\0132\023.n"
+  "s3_proto.Topology\022,\n\014applications\030\003 \003(\0132"
+  "\026.ns3_proto.Application\".\n\016SweepParamete"
+  "r\022\014\n\004name\030\001 \001(\t\022\016\n\006values\030\002 \003(\t\"\355\001\n\005Swee"
+  "p\022\'\n\004base\030\001 \001(\0132\031.ns3_proto.Configuratio"
+  "ns\022-\n\nparameters\030\002 \003(\0132\031.ns3_proto.Sweep"
+  "Parameter\022\014\n\004runs\030\003 \001(\r\022\021\n\toutputDir\030\004 \001"
+  "(\t\022\020\n\010stopTime\030\005 \001(\t\022\025\n\010lineRate\030\006 \001(\tH\000"
+  "\210\001\001\022\024\n\007baseRtt\030\007 \001(\tH\001\210\001\001\022\023\n\013fctSizeBins"
+  "\030\010 \003(\004B\013\n\t_lineRateB\n\n\010_baseRttb\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_configurations_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_configurations_2eproto = {
-    false, false, 1318, descriptor_table_protodef_configurations_2eproto,
+    false, false, 2159, descriptor_table_protodef_configurations_2eproto,
     "configurations.proto",
-    &descriptor_table_configurations_2eproto_once, nullptr, 0, 11,
+    &descriptor_table_configurations_2eproto_once, nullptr, 0, 15,
     schemas, file_default_instances, TableStruct_configurations_2eproto::offsets,
     file_level_metadata_configurations_2eproto, file_level_enum_descriptors_configurations_2eproto,
     file_level_service_descriptors_configurations_2eproto,
@@ -403,6 +572,31 @@ PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_configur
 // Force running AddDescriptors() at dynamic initialization time.
 PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_configurations_2eproto(&descriptor_table_configurations_2eproto);
 namespace ns3_proto {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LoadBalanceConfig_Mode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_configurations_2eproto);
+  return file_level_enum_descriptors_configurations_2eproto[0];
+}
+bool LoadBalanceConfig_Mode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr LoadBalanceConfig_Mode LoadBalanceConfig::ECMP;
+constexpr LoadBalanceConfig_Mode LoadBalanceConfig::PACKET_SPRAY;
+constexpr LoadBalanceConfig_Mode LoadBalanceConfig::FLOWLET;
+constexpr LoadBalanceConfig_Mode LoadBalanceConfig::CONGESTION_AWARE;
+constexpr LoadBalanceConfig_Mode LoadBalanceConfig::Mode_MIN;
+constexpr LoadBalanceConfig_Mode LoadBalanceConfig::Mode_MAX;
+constexpr int LoadBalanceConfig::Mode_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
@@ -412,6 +606,9 @@ class GlobalConfig::_Internal {
   static void set_has_outputfct(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_binarytrace(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
 GlobalConfig::GlobalConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -426,7 +623,8 @@ GlobalConfig::GlobalConfig(const GlobalConfig& from)
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.outputfct_){}};
+    , decltype(_impl_.outputfct_){}
+    , decltype(_impl_.binarytrace_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.outputfct_.InitDefault();
@@ -437,6 +635,14 @@ GlobalConfig::GlobalConfig(const GlobalConfig& from)
     _this->_impl_.outputfct_.Set(from._internal_outputfct(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.binarytrace_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.binarytrace_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_binarytrace()) {
+    _this->_impl_.binarytrace_.Set(from._internal_binarytrace(), 
+      _this->GetArenaForAllocation());
+  }
   // @@protoc_insertion_point(copy_constructor:ns3_proto.GlobalConfig)
 }
 
@@ -448,11 +654,16 @@ inline void GlobalConfig::SharedCtor(
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.outputfct_){}
+    , decltype(_impl_.binarytrace_){}
   };
   _impl_.outputfct_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.outputfct_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.binarytrace_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.binarytrace_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GlobalConfig::~GlobalConfig() {
@@ -467,6 +678,7 @@ GlobalConfig::~GlobalConfig() {
 inline void GlobalConfig::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.outputfct_.Destroy();
+  _impl_.binarytrace_.Destroy();
 }
 
 void GlobalConfig::SetCachedSize(int size) const {
@@ -480,8 +692,13 @@ void GlobalConfig::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.outputfct_.ClearNonDefaultToEmpty();
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.outputfct_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.binarytrace_.ClearNonDefaultToEmpty();
+    }
   }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
@@ -504,6 +721,16 @@ const char* GlobalConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // optional string binaryTrace = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_binarytrace();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.GlobalConfig.binaryTrace"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -544,6 +771,16 @@ uint8_t* GlobalConfig::_InternalSerialize(
         1, this->_internal_outputfct(), target);
   }
 
+  // optional string binaryTrace = 2;
+  if (_internal_has_binarytrace()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_binarytrace().data(), static_cast<int>(this->_internal_binarytrace().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.GlobalConfig.binaryTrace");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_binarytrace(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -560,14 +797,23 @@ size_t GlobalConfig::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // optional string outputFct = 1;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_outputfct());
-  }
+  if (cached_has_bits & 0x00000003u) {
+    // optional string outputFct = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_outputfct());
+    }
+
+    // optional string binaryTrace = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_binarytrace());
+    }
 
+  }
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -586,8 +832,14 @@ void GlobalConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::P
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_outputfct()) {
-    _this->_internal_set_outputfct(from._internal_outputfct());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_outputfct(from._internal_outputfct());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_binarytrace(from._internal_binarytrace());
+    }
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
@@ -613,6 +865,10 @@ void GlobalConfig::InternalSwap(GlobalConfig* other) {
       &_impl_.outputfct_, lhs_arena,
       &other->_impl_.outputfct_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.binarytrace_, lhs_arena,
+      &other->_impl_.binarytrace_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GlobalConfig::GetMetadata() const {
@@ -1064,6 +1320,9 @@ class PortQueueConfig::_Internal {
   static void set_has_ecnpmax(HasBits* has_bits) {
     (*has_bits)[0] |= 16u;
   }
+  static void set_has_etsweight(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
 };
 
 PortQueueConfig::PortQueueConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -1082,7 +1341,8 @@ PortQueueConfig::PortQueueConfig(const PortQueueConfig& from)
     , decltype(_impl_.pfcxon_){}
     , decltype(_impl_.ecnkmin_){}
     , decltype(_impl_.ecnkmax_){}
-    , decltype(_impl_.ecnpmax_){}};
+    , decltype(_impl_.ecnpmax_){}
+    , decltype(_impl_.etsweight_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.pfcreserve_.InitDefault();
@@ -1117,7 +1377,9 @@ PortQueueConfig::PortQueueConfig(const PortQueueConfig& from)
     _this->_impl_.ecnkmax_.Set(from._internal_ecnkmax(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.ecnpmax_ = from._impl_.ecnpmax_;
+  ::memcpy(&_impl_.ecnpmax_, &from._impl_.ecnpmax_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.etsweight_) -
+    reinterpret_cast<char*>(&_impl_.ecnpmax_)) + sizeof(_impl_.etsweight_));
   // @@protoc_insertion_point(copy_constructor:ns3_proto.PortQueueConfig)
 }
 
@@ -1133,6 +1395,7 @@ inline void PortQueueConfig::SharedCtor(
     , decltype(_impl_.ecnkmin_){}
     , decltype(_impl_.ecnkmax_){}
     , decltype(_impl_.ecnpmax_){0}
+    , decltype(_impl_.etsweight_){0u}
   };
   _impl_.pfcreserve_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -1194,7 +1457,11 @@ void PortQueueConfig::Clear() {
       _impl_.ecnkmax_.ClearNonDefaultToEmpty();
     }
   }
-  _impl_.ecnpmax_ = 0;
+  if (cached_has_bits & 0x00000030u) {
+    ::memset(&_impl_.ecnpmax_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.etsweight_) -
+        reinterpret_cast<char*>(&_impl_.ecnpmax_)) + sizeof(_impl_.etsweight_));
+  }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -1255,6 +1522,15 @@ const char* PortQueueConfig::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
+      // optional uint32 etsWeight = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_etsweight(&has_bits);
+          _impl_.etsweight_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1331,6 +1607,12 @@ uint8_t* PortQueueConfig::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_ecnpmax(), target);
   }
 
+  // optional uint32 etsWeight = 7;
+  if (_internal_has_etsweight()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_etsweight(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1348,7 +1630,7 @@ size_t PortQueueConfig::ByteSizeLong() const {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000001fu) {
+  if (cached_has_bits & 0x0000003fu) {
     // optional string pfcReserve = 1;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
@@ -1382,6 +1664,11 @@ size_t PortQueueConfig::ByteSizeLong() const {
       total_size += 1 + 8;
     }
 
+    // optional uint32 etsWeight = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_etsweight());
+    }
+
   }
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
@@ -1402,7 +1689,7 @@ void PortQueueConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000001fu) {
+  if (cached_has_bits & 0x0000003fu) {
     if (cached_has_bits & 0x00000001u) {
       _this->_internal_set_pfcreserve(from._internal_pfcreserve());
     }
@@ -1418,6 +1705,9 @@ void PortQueueConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
     if (cached_has_bits & 0x00000010u) {
       _this->_impl_.ecnpmax_ = from._impl_.ecnpmax_;
     }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.etsweight_ = from._impl_.etsweight_;
+    }
     _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -1456,7 +1746,12 @@ void PortQueueConfig::InternalSwap(PortQueueConfig* other) {
       &_impl_.ecnkmax_, lhs_arena,
       &other->_impl_.ecnkmax_, rhs_arena
   );
-  swap(_impl_.ecnpmax_, other->_impl_.ecnpmax_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PortQueueConfig, _impl_.etsweight_)
+      + sizeof(PortQueueConfig::_impl_.etsweight_)
+      - PROTOBUF_FIELD_OFFSET(PortQueueConfig, _impl_.ecnpmax_)>(
+          reinterpret_cast<char*>(&_impl_.ecnpmax_),
+          reinterpret_cast<char*>(&other->_impl_.ecnpmax_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata PortQueueConfig::GetMetadata() const {
@@ -1712,62 +2007,92 @@ void SwitchPortConfig::InternalSwap(SwitchPortConfig* other) {
 
 // ===================================================================
 
-class SwitchGroup::_Internal {
+class SharedBufferConfig::_Internal {
  public:
+  using HasBits = decltype(std::declval<SharedBufferConfig>()._impl_._has_bits_);
+  static void set_has_ecnalpha(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
 };
 
-SwitchGroup::SwitchGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SharedBufferConfig::SharedBufferConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:ns3_proto.SwitchGroup)
+  // @@protoc_insertion_point(arena_constructor:ns3_proto.SharedBufferConfig)
 }
-SwitchGroup::SwitchGroup(const SwitchGroup& from)
+SharedBufferConfig::SharedBufferConfig(const SharedBufferConfig& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SwitchGroup* const _this = this; (void)_this;
+  SharedBufferConfig* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.ports_){from._impl_.ports_}
-    , decltype(_impl_.buffersize_){}
-    , decltype(_impl_.nodesnum_){}
-    , decltype(_impl_.baseindex_){}
-    , decltype(_impl_.queuenum_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reserve_){}
+    , decltype(_impl_.headroom_){}
+    , decltype(_impl_.xonoffset_){}
+    , decltype(_impl_.pfcalpha_){}
+    , decltype(_impl_.ecnalpha_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.buffersize_.InitDefault();
+  _impl_.reserve_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.buffersize_.Set("", GetArenaForAllocation());
+    _impl_.reserve_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_buffersize().empty()) {
-    _this->_impl_.buffersize_.Set(from._internal_buffersize(), 
+  if (!from._internal_reserve().empty()) {
+    _this->_impl_.reserve_.Set(from._internal_reserve(), 
       _this->GetArenaForAllocation());
   }
-  ::memcpy(&_impl_.nodesnum_, &from._impl_.nodesnum_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.queuenum_) -
-    reinterpret_cast<char*>(&_impl_.nodesnum_)) + sizeof(_impl_.queuenum_));
-  // @@protoc_insertion_point(copy_constructor:ns3_proto.SwitchGroup)
+  _impl_.headroom_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.headroom_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_headroom().empty()) {
+    _this->_impl_.headroom_.Set(from._internal_headroom(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.xonoffset_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.xonoffset_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_xonoffset().empty()) {
+    _this->_impl_.xonoffset_.Set(from._internal_xonoffset(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.pfcalpha_, &from._impl_.pfcalpha_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ecnalpha_) -
+    reinterpret_cast<char*>(&_impl_.pfcalpha_)) + sizeof(_impl_.ecnalpha_));
+  // @@protoc_insertion_point(copy_constructor:ns3_proto.SharedBufferConfig)
 }
 
-inline void SwitchGroup::SharedCtor(
+inline void SharedBufferConfig::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.ports_){arena}
-    , decltype(_impl_.buffersize_){}
-    , decltype(_impl_.nodesnum_){0u}
-    , decltype(_impl_.baseindex_){0u}
-    , decltype(_impl_.queuenum_){0u}
+      decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reserve_){}
+    , decltype(_impl_.headroom_){}
+    , decltype(_impl_.xonoffset_){}
+    , decltype(_impl_.pfcalpha_){0}
+    , decltype(_impl_.ecnalpha_){0}
   };
-  _impl_.buffersize_.InitDefault();
+  _impl_.reserve_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.buffersize_.Set("", GetArenaForAllocation());
+    _impl_.reserve_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.headroom_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.headroom_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.xonoffset_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.xonoffset_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SwitchGroup::~SwitchGroup() {
-  // @@protoc_insertion_point(destructor:ns3_proto.SwitchGroup)
+SharedBufferConfig::~SharedBufferConfig() {
+  // @@protoc_insertion_point(destructor:ns3_proto.SharedBufferConfig)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1775,80 +2100,83 @@ SwitchGroup::~SwitchGroup() {
   SharedDtor();
 }
 
-inline void SwitchGroup::SharedDtor() {
+inline void SharedBufferConfig::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.ports_.~RepeatedPtrField();
-  _impl_.buffersize_.Destroy();
+  _impl_.reserve_.Destroy();
+  _impl_.headroom_.Destroy();
+  _impl_.xonoffset_.Destroy();
 }
 
-void SwitchGroup::SetCachedSize(int size) const {
+void SharedBufferConfig::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SwitchGroup::Clear() {
-// @@protoc_insertion_point(message_clear_start:ns3_proto.SwitchGroup)
+void SharedBufferConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:ns3_proto.SharedBufferConfig)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.ports_.Clear();
-  _impl_.buffersize_.ClearToEmpty();
-  ::memset(&_impl_.nodesnum_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.queuenum_) -
-      reinterpret_cast<char*>(&_impl_.nodesnum_)) + sizeof(_impl_.queuenum_));
+  _impl_.reserve_.ClearToEmpty();
+  _impl_.headroom_.ClearToEmpty();
+  _impl_.xonoffset_.ClearToEmpty();
+  _impl_.pfcalpha_ = 0;
+  _impl_.ecnalpha_ = 0;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SwitchGroup::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SharedBufferConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // uint32 nodesNum = 1;
+      // string reserve = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.nodesnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_reserve();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.SharedBufferConfig.reserve"));
         } else
           goto handle_unusual;
         continue;
-      // uint32 baseIndex = 2;
+      // string headroom = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.baseindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_headroom();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.SharedBufferConfig.headroom"));
         } else
           goto handle_unusual;
         continue;
-      // string bufferSize = 3;
+      // double pfcAlpha = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_buffersize();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.SwitchGroup.bufferSize"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.pfcalpha_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
         } else
           goto handle_unusual;
         continue;
-      // uint32 queueNum = 4;
+      // string xonOffset = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          _impl_.queuenum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_xonoffset();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.SharedBufferConfig.xonOffset"));
         } else
           goto handle_unusual;
         continue;
-      // repeated .ns3_proto.SwitchPortConfig ports = 5;
+      // optional double ecnAlpha = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_ports(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_ecnalpha(&has_bits);
+          _impl_.ecnalpha_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
         } else
           goto handle_unusual;
         continue;
@@ -1868,6 +2196,7 @@ const char* SwitchGroup::_InternalParse(const char* ptr, ::_pbi::ParseContext* c
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -1875,157 +2204,188 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SwitchGroup::_InternalSerialize(
+uint8_t* SharedBufferConfig::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.SwitchGroup)
+  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.SharedBufferConfig)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // uint32 nodesNum = 1;
-  if (this->_internal_nodesnum() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_nodesnum(), target);
+  // string reserve = 1;
+  if (!this->_internal_reserve().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_reserve().data(), static_cast<int>(this->_internal_reserve().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.SharedBufferConfig.reserve");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_reserve(), target);
   }
 
-  // uint32 baseIndex = 2;
-  if (this->_internal_baseindex() != 0) {
+  // string headroom = 2;
+  if (!this->_internal_headroom().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_headroom().data(), static_cast<int>(this->_internal_headroom().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.SharedBufferConfig.headroom");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_headroom(), target);
+  }
+
+  // double pfcAlpha = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_pfcalpha = this->_internal_pfcalpha();
+  uint64_t raw_pfcalpha;
+  memcpy(&raw_pfcalpha, &tmp_pfcalpha, sizeof(tmp_pfcalpha));
+  if (raw_pfcalpha != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_baseindex(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_pfcalpha(), target);
   }
 
-  // string bufferSize = 3;
-  if (!this->_internal_buffersize().empty()) {
+  // string xonOffset = 4;
+  if (!this->_internal_xonoffset().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_buffersize().data(), static_cast<int>(this->_internal_buffersize().length()),
+      this->_internal_xonoffset().data(), static_cast<int>(this->_internal_xonoffset().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "ns3_proto.SwitchGroup.bufferSize");
+      "ns3_proto.SharedBufferConfig.xonOffset");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_buffersize(), target);
+        4, this->_internal_xonoffset(), target);
   }
 
-  // uint32 queueNum = 4;
-  if (this->_internal_queuenum() != 0) {
+  // optional double ecnAlpha = 5;
+  if (_internal_has_ecnalpha()) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_queuenum(), target);
-  }
-
-  // repeated .ns3_proto.SwitchPortConfig ports = 5;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_ports_size()); i < n; i++) {
-    const auto& repfield = this->_internal_ports(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_ecnalpha(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.SwitchGroup)
+  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.SharedBufferConfig)
   return target;
 }
 
-size_t SwitchGroup::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ns3_proto.SwitchGroup)
+size_t SharedBufferConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ns3_proto.SharedBufferConfig)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .ns3_proto.SwitchPortConfig ports = 5;
-  total_size += 1UL * this->_internal_ports_size();
-  for (const auto& msg : this->_impl_.ports_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // string reserve = 1;
+  if (!this->_internal_reserve().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_reserve());
   }
 
-  // string bufferSize = 3;
-  if (!this->_internal_buffersize().empty()) {
+  // string headroom = 2;
+  if (!this->_internal_headroom().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_buffersize());
+        this->_internal_headroom());
   }
 
-  // uint32 nodesNum = 1;
-  if (this->_internal_nodesnum() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_nodesnum());
+  // string xonOffset = 4;
+  if (!this->_internal_xonoffset().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_xonoffset());
   }
 
-  // uint32 baseIndex = 2;
-  if (this->_internal_baseindex() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_baseindex());
+  // double pfcAlpha = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_pfcalpha = this->_internal_pfcalpha();
+  uint64_t raw_pfcalpha;
+  memcpy(&raw_pfcalpha, &tmp_pfcalpha, sizeof(tmp_pfcalpha));
+  if (raw_pfcalpha != 0) {
+    total_size += 1 + 8;
   }
 
-  // uint32 queueNum = 4;
-  if (this->_internal_queuenum() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_queuenum());
+  // optional double ecnAlpha = 5;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 8;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SwitchGroup::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SharedBufferConfig::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SwitchGroup::MergeImpl
+    SharedBufferConfig::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SwitchGroup::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SharedBufferConfig::GetClassData() const { return &_class_data_; }
 
 
-void SwitchGroup::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SwitchGroup*>(&to_msg);
-  auto& from = static_cast<const SwitchGroup&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.SwitchGroup)
+void SharedBufferConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SharedBufferConfig*>(&to_msg);
+  auto& from = static_cast<const SharedBufferConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.SharedBufferConfig)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.ports_.MergeFrom(from._impl_.ports_);
-  if (!from._internal_buffersize().empty()) {
-    _this->_internal_set_buffersize(from._internal_buffersize());
+  if (!from._internal_reserve().empty()) {
+    _this->_internal_set_reserve(from._internal_reserve());
   }
-  if (from._internal_nodesnum() != 0) {
-    _this->_internal_set_nodesnum(from._internal_nodesnum());
+  if (!from._internal_headroom().empty()) {
+    _this->_internal_set_headroom(from._internal_headroom());
   }
-  if (from._internal_baseindex() != 0) {
-    _this->_internal_set_baseindex(from._internal_baseindex());
+  if (!from._internal_xonoffset().empty()) {
+    _this->_internal_set_xonoffset(from._internal_xonoffset());
   }
-  if (from._internal_queuenum() != 0) {
-    _this->_internal_set_queuenum(from._internal_queuenum());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_pfcalpha = from._internal_pfcalpha();
+  uint64_t raw_pfcalpha;
+  memcpy(&raw_pfcalpha, &tmp_pfcalpha, sizeof(tmp_pfcalpha));
+  if (raw_pfcalpha != 0) {
+    _this->_internal_set_pfcalpha(from._internal_pfcalpha());
+  }
+  if (from._internal_has_ecnalpha()) {
+    _this->_internal_set_ecnalpha(from._internal_ecnalpha());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SwitchGroup::CopyFrom(const SwitchGroup& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.SwitchGroup)
+void SharedBufferConfig::CopyFrom(const SharedBufferConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.SharedBufferConfig)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SwitchGroup::IsInitialized() const {
+bool SharedBufferConfig::IsInitialized() const {
   return true;
 }
 
-void SwitchGroup::InternalSwap(SwitchGroup* other) {
+void SharedBufferConfig::InternalSwap(SharedBufferConfig* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.ports_.InternalSwap(&other->_impl_.ports_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.buffersize_, lhs_arena,
-      &other->_impl_.buffersize_, rhs_arena
+      &_impl_.reserve_, lhs_arena,
+      &other->_impl_.reserve_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.headroom_, lhs_arena,
+      &other->_impl_.headroom_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.xonoffset_, lhs_arena,
+      &other->_impl_.xonoffset_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SwitchGroup, _impl_.queuenum_)
-      + sizeof(SwitchGroup::_impl_.queuenum_)
-      - PROTOBUF_FIELD_OFFSET(SwitchGroup, _impl_.nodesnum_)>(
-          reinterpret_cast<char*>(&_impl_.nodesnum_),
-          reinterpret_cast<char*>(&other->_impl_.nodesnum_));
+      PROTOBUF_FIELD_OFFSET(SharedBufferConfig, _impl_.ecnalpha_)
+      + sizeof(SharedBufferConfig::_impl_.ecnalpha_)
+      - PROTOBUF_FIELD_OFFSET(SharedBufferConfig, _impl_.pfcalpha_)>(
+          reinterpret_cast<char*>(&_impl_.pfcalpha_),
+          reinterpret_cast<char*>(&other->_impl_.pfcalpha_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SwitchGroup::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SharedBufferConfig::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_configurations_2eproto_getter, &descriptor_table_configurations_2eproto_once,
       file_level_metadata_configurations_2eproto[5]);
@@ -2033,44 +2393,54 @@ void SwitchGroup::InternalSwap(SwitchGroup* other) {
 
 // ===================================================================
 
-class AllNodes::_Internal {
+class LoadBalanceConfig::_Internal {
  public:
 };
 
-AllNodes::AllNodes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+LoadBalanceConfig::LoadBalanceConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:ns3_proto.AllNodes)
+  // @@protoc_insertion_point(arena_constructor:ns3_proto.LoadBalanceConfig)
 }
-AllNodes::AllNodes(const AllNodes& from)
+LoadBalanceConfig::LoadBalanceConfig(const LoadBalanceConfig& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  AllNodes* const _this = this; (void)_this;
+  LoadBalanceConfig* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.hostgroups_){from._impl_.hostgroups_}
-    , decltype(_impl_.switchgroups_){from._impl_.switchgroups_}
-    , decltype(_impl_.num_){}
+      decltype(_impl_.flowletgap_){}
+    , decltype(_impl_.mode_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.num_ = from._impl_.num_;
-  // @@protoc_insertion_point(copy_constructor:ns3_proto.AllNodes)
+  _impl_.flowletgap_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.flowletgap_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_flowletgap().empty()) {
+    _this->_impl_.flowletgap_.Set(from._internal_flowletgap(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.mode_ = from._impl_.mode_;
+  // @@protoc_insertion_point(copy_constructor:ns3_proto.LoadBalanceConfig)
 }
 
-inline void AllNodes::SharedCtor(
+inline void LoadBalanceConfig::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.hostgroups_){arena}
-    , decltype(_impl_.switchgroups_){arena}
-    , decltype(_impl_.num_){0u}
+      decltype(_impl_.flowletgap_){}
+    , decltype(_impl_.mode_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.flowletgap_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.flowletgap_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-AllNodes::~AllNodes() {
-  // @@protoc_insertion_point(destructor:ns3_proto.AllNodes)
+LoadBalanceConfig::~LoadBalanceConfig() {
+  // @@protoc_insertion_point(destructor:ns3_proto.LoadBalanceConfig)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2078,65 +2448,48 @@ AllNodes::~AllNodes() {
   SharedDtor();
 }
 
-inline void AllNodes::SharedDtor() {
+inline void LoadBalanceConfig::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.hostgroups_.~RepeatedPtrField();
-  _impl_.switchgroups_.~RepeatedPtrField();
+  _impl_.flowletgap_.Destroy();
 }
 
-void AllNodes::SetCachedSize(int size) const {
+void LoadBalanceConfig::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void AllNodes::Clear() {
-// @@protoc_insertion_point(message_clear_start:ns3_proto.AllNodes)
+void LoadBalanceConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:ns3_proto.LoadBalanceConfig)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.hostgroups_.Clear();
-  _impl_.switchgroups_.Clear();
-  _impl_.num_ = 0u;
+  _impl_.flowletgap_.ClearToEmpty();
+  _impl_.mode_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* AllNodes::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* LoadBalanceConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // uint32 num = 1;
+      // .ns3_proto.LoadBalanceConfig.Mode mode = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_mode(static_cast<::ns3_proto::LoadBalanceConfig_Mode>(val));
         } else
           goto handle_unusual;
         continue;
-      // repeated .ns3_proto.HostGroup hostGroups = 2;
+      // string flowletGap = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_hostgroups(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else
-          goto handle_unusual;
-        continue;
-      // repeated .ns3_proto.SwitchGroup switchGroups = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_switchgroups(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+          auto str = _internal_mutable_flowletgap();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.LoadBalanceConfig.flowletGap"));
         } else
           goto handle_unusual;
         continue;
@@ -2163,115 +2516,109 @@ failure:
 #undef CHK_
 }
 
-uint8_t* AllNodes::_InternalSerialize(
+uint8_t* LoadBalanceConfig::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.AllNodes)
+  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.LoadBalanceConfig)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // uint32 num = 1;
-  if (this->_internal_num() != 0) {
+  // .ns3_proto.LoadBalanceConfig.Mode mode = 1;
+  if (this->_internal_mode() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_num(), target);
-  }
-
-  // repeated .ns3_proto.HostGroup hostGroups = 2;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_hostgroups_size()); i < n; i++) {
-    const auto& repfield = this->_internal_hostgroups(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_mode(), target);
   }
 
-  // repeated .ns3_proto.SwitchGroup switchGroups = 3;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_switchgroups_size()); i < n; i++) {
-    const auto& repfield = this->_internal_switchgroups(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  // string flowletGap = 2;
+  if (!this->_internal_flowletgap().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_flowletgap().data(), static_cast<int>(this->_internal_flowletgap().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.LoadBalanceConfig.flowletGap");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_flowletgap(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.AllNodes)
+  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.LoadBalanceConfig)
   return target;
 }
 
-size_t AllNodes::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ns3_proto.AllNodes)
+size_t LoadBalanceConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ns3_proto.LoadBalanceConfig)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .ns3_proto.HostGroup hostGroups = 2;
-  total_size += 1UL * this->_internal_hostgroups_size();
-  for (const auto& msg : this->_impl_.hostgroups_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // repeated .ns3_proto.SwitchGroup switchGroups = 3;
-  total_size += 1UL * this->_internal_switchgroups_size();
-  for (const auto& msg : this->_impl_.switchgroups_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // string flowletGap = 2;
+  if (!this->_internal_flowletgap().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_flowletgap());
   }
 
-  // uint32 num = 1;
-  if (this->_internal_num() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num());
+  // .ns3_proto.LoadBalanceConfig.Mode mode = 1;
+  if (this->_internal_mode() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_mode());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AllNodes::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LoadBalanceConfig::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    AllNodes::MergeImpl
+    LoadBalanceConfig::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AllNodes::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LoadBalanceConfig::GetClassData() const { return &_class_data_; }
 
 
-void AllNodes::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<AllNodes*>(&to_msg);
-  auto& from = static_cast<const AllNodes&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.AllNodes)
+void LoadBalanceConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LoadBalanceConfig*>(&to_msg);
+  auto& from = static_cast<const LoadBalanceConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.LoadBalanceConfig)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.hostgroups_.MergeFrom(from._impl_.hostgroups_);
-  _this->_impl_.switchgroups_.MergeFrom(from._impl_.switchgroups_);
-  if (from._internal_num() != 0) {
-    _this->_internal_set_num(from._internal_num());
+  if (!from._internal_flowletgap().empty()) {
+    _this->_internal_set_flowletgap(from._internal_flowletgap());
+  }
+  if (from._internal_mode() != 0) {
+    _this->_internal_set_mode(from._internal_mode());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void AllNodes::CopyFrom(const AllNodes& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.AllNodes)
+void LoadBalanceConfig::CopyFrom(const LoadBalanceConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.LoadBalanceConfig)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AllNodes::IsInitialized() const {
+bool LoadBalanceConfig::IsInitialized() const {
   return true;
 }
 
-void AllNodes::InternalSwap(AllNodes* other) {
+void LoadBalanceConfig::InternalSwap(LoadBalanceConfig* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.hostgroups_.InternalSwap(&other->_impl_.hostgroups_);
-  _impl_.switchgroups_.InternalSwap(&other->_impl_.switchgroups_);
-  swap(_impl_.num_, other->_impl_.num_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.flowletgap_, lhs_arena,
+      &other->_impl_.flowletgap_, rhs_arena
+  );
+  swap(_impl_.mode_, other->_impl_.mode_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata AllNodes::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata LoadBalanceConfig::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_configurations_2eproto_getter, &descriptor_table_configurations_2eproto_once,
       file_level_metadata_configurations_2eproto[6]);
@@ -2279,76 +2626,84 @@ void AllNodes::InternalSwap(AllNodes* other) {
 
 // ===================================================================
 
-class Link::_Internal {
+class SwitchGroup::_Internal {
  public:
+  static const ::ns3_proto::SharedBufferConfig& sharedbuffer(const SwitchGroup* msg);
+  static const ::ns3_proto::LoadBalanceConfig& loadbalance(const SwitchGroup* msg);
 };
 
-Link::Link(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::ns3_proto::SharedBufferConfig&
+SwitchGroup::_Internal::sharedbuffer(const SwitchGroup* msg) {
+  return *msg->_impl_.sharedbuffer_;
+}
+const ::ns3_proto::LoadBalanceConfig&
+SwitchGroup::_Internal::loadbalance(const SwitchGroup* msg) {
+  return *msg->_impl_.loadbalance_;
+}
+SwitchGroup::SwitchGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:ns3_proto.Link)
+  // @@protoc_insertion_point(arena_constructor:ns3_proto.SwitchGroup)
 }
-Link::Link(const Link& from)
+SwitchGroup::SwitchGroup(const SwitchGroup& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  Link* const _this = this; (void)_this;
+  SwitchGroup* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.rate_){}
-    , decltype(_impl_.delay_){}
-    , decltype(_impl_.node1_){}
-    , decltype(_impl_.node2_){}
-    , decltype(_impl_.port1_){}
-    , decltype(_impl_.port2_){}
+      decltype(_impl_.ports_){from._impl_.ports_}
+    , decltype(_impl_.buffersize_){}
+    , decltype(_impl_.sharedbuffer_){nullptr}
+    , decltype(_impl_.loadbalance_){nullptr}
+    , decltype(_impl_.nodesnum_){}
+    , decltype(_impl_.baseindex_){}
+    , decltype(_impl_.queuenum_){}
+    , decltype(_impl_.intenabled_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.rate_.InitDefault();
+  _impl_.buffersize_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.rate_.Set("", GetArenaForAllocation());
+    _impl_.buffersize_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_rate().empty()) {
-    _this->_impl_.rate_.Set(from._internal_rate(), 
+  if (!from._internal_buffersize().empty()) {
+    _this->_impl_.buffersize_.Set(from._internal_buffersize(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.delay_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.delay_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_delay().empty()) {
-    _this->_impl_.delay_.Set(from._internal_delay(), 
-      _this->GetArenaForAllocation());
+  if (from._internal_has_sharedbuffer()) {
+    _this->_impl_.sharedbuffer_ = new ::ns3_proto::SharedBufferConfig(*from._impl_.sharedbuffer_);
   }
-  ::memcpy(&_impl_.node1_, &from._impl_.node1_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.port2_) -
-    reinterpret_cast<char*>(&_impl_.node1_)) + sizeof(_impl_.port2_));
-  // @@protoc_insertion_point(copy_constructor:ns3_proto.Link)
+  if (from._internal_has_loadbalance()) {
+    _this->_impl_.loadbalance_ = new ::ns3_proto::LoadBalanceConfig(*from._impl_.loadbalance_);
+  }
+  ::memcpy(&_impl_.nodesnum_, &from._impl_.nodesnum_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.intenabled_) -
+    reinterpret_cast<char*>(&_impl_.nodesnum_)) + sizeof(_impl_.intenabled_));
+  // @@protoc_insertion_point(copy_constructor:ns3_proto.SwitchGroup)
 }
 
-inline void Link::SharedCtor(
+inline void SwitchGroup::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.rate_){}
-    , decltype(_impl_.delay_){}
-    , decltype(_impl_.node1_){0u}
-    , decltype(_impl_.node2_){0u}
-    , decltype(_impl_.port1_){0u}
-    , decltype(_impl_.port2_){0u}
+      decltype(_impl_.ports_){arena}
+    , decltype(_impl_.buffersize_){}
+    , decltype(_impl_.sharedbuffer_){nullptr}
+    , decltype(_impl_.loadbalance_){nullptr}
+    , decltype(_impl_.nodesnum_){0u}
+    , decltype(_impl_.baseindex_){0u}
+    , decltype(_impl_.queuenum_){0u}
+    , decltype(_impl_.intenabled_){false}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.rate_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.rate_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.delay_.InitDefault();
+  _impl_.buffersize_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.delay_.Set("", GetArenaForAllocation());
+    _impl_.buffersize_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-Link::~Link() {
-  // @@protoc_insertion_point(destructor:ns3_proto.Link)
+SwitchGroup::~SwitchGroup() {
+  // @@protoc_insertion_point(destructor:ns3_proto.SwitchGroup)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2356,85 +2711,114 @@ Link::~Link() {
   SharedDtor();
 }
 
-inline void Link::SharedDtor() {
+inline void SwitchGroup::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.rate_.Destroy();
-  _impl_.delay_.Destroy();
+  _impl_.ports_.~RepeatedPtrField();
+  _impl_.buffersize_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.sharedbuffer_;
+  if (this != internal_default_instance()) delete _impl_.loadbalance_;
 }
 
-void Link::SetCachedSize(int size) const {
+void SwitchGroup::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void Link::Clear() {
-// @@protoc_insertion_point(message_clear_start:ns3_proto.Link)
+void SwitchGroup::Clear() {
+// @@protoc_insertion_point(message_clear_start:ns3_proto.SwitchGroup)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.rate_.ClearToEmpty();
-  _impl_.delay_.ClearToEmpty();
-  ::memset(&_impl_.node1_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.port2_) -
-      reinterpret_cast<char*>(&_impl_.node1_)) + sizeof(_impl_.port2_));
+  _impl_.ports_.Clear();
+  _impl_.buffersize_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.sharedbuffer_ != nullptr) {
+    delete _impl_.sharedbuffer_;
+  }
+  _impl_.sharedbuffer_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.loadbalance_ != nullptr) {
+    delete _impl_.loadbalance_;
+  }
+  _impl_.loadbalance_ = nullptr;
+  ::memset(&_impl_.nodesnum_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.intenabled_) -
+      reinterpret_cast<char*>(&_impl_.nodesnum_)) + sizeof(_impl_.intenabled_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Link::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SwitchGroup::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // uint32 node1 = 1;
+      // uint32 nodesNum = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.node1_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.nodesnum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // uint32 node2 = 2;
+      // uint32 baseIndex = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.node2_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.baseindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // uint32 port1 = 3;
+      // string bufferSize = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.port1_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_buffersize();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.SwitchGroup.bufferSize"));
         } else
           goto handle_unusual;
         continue;
-      // uint32 port2 = 4;
+      // uint32 queueNum = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          _impl_.port2_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.queuenum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // string rate = 5;
+      // repeated .ns3_proto.SwitchPortConfig ports = 5;
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          auto str = _internal_mutable_rate();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Link.rate"));
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ports(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // string delay = 6;
+      // .ns3_proto.SharedBufferConfig sharedBuffer = 6;
       case 6:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
-          auto str = _internal_mutable_delay();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ctx->ParseMessage(_internal_mutable_sharedbuffer(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .ns3_proto.LoadBalanceConfig loadBalance = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_loadbalance(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool intEnabled = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.intenabled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Link.delay"));
         } else
           goto handle_unusual;
         continue;
@@ -2461,178 +2845,207 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Link::_InternalSerialize(
+uint8_t* SwitchGroup::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.Link)
+  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.SwitchGroup)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // uint32 node1 = 1;
-  if (this->_internal_node1() != 0) {
+  // uint32 nodesNum = 1;
+  if (this->_internal_nodesnum() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_node1(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_nodesnum(), target);
   }
 
-  // uint32 node2 = 2;
-  if (this->_internal_node2() != 0) {
+  // uint32 baseIndex = 2;
+  if (this->_internal_baseindex() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_node2(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_baseindex(), target);
   }
 
-  // uint32 port1 = 3;
-  if (this->_internal_port1() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_port1(), target);
+  // string bufferSize = 3;
+  if (!this->_internal_buffersize().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_buffersize().data(), static_cast<int>(this->_internal_buffersize().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.SwitchGroup.bufferSize");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_buffersize(), target);
   }
 
-  // uint32 port2 = 4;
-  if (this->_internal_port2() != 0) {
+  // uint32 queueNum = 4;
+  if (this->_internal_queuenum() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_port2(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_queuenum(), target);
   }
 
-  // string rate = 5;
-  if (!this->_internal_rate().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_rate().data(), static_cast<int>(this->_internal_rate().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "ns3_proto.Link.rate");
-    target = stream->WriteStringMaybeAliased(
-        5, this->_internal_rate(), target);
+  // repeated .ns3_proto.SwitchPortConfig ports = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ports_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ports(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // string delay = 6;
-  if (!this->_internal_delay().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_delay().data(), static_cast<int>(this->_internal_delay().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "ns3_proto.Link.delay");
-    target = stream->WriteStringMaybeAliased(
-        6, this->_internal_delay(), target);
+  // .ns3_proto.SharedBufferConfig sharedBuffer = 6;
+  if (this->_internal_has_sharedbuffer()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::sharedbuffer(this),
+        _Internal::sharedbuffer(this).GetCachedSize(), target, stream);
+  }
+
+  // .ns3_proto.LoadBalanceConfig loadBalance = 7;
+  if (this->_internal_has_loadbalance()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::loadbalance(this),
+        _Internal::loadbalance(this).GetCachedSize(), target, stream);
+  }
+
+  // bool intEnabled = 8;
+  if (this->_internal_intenabled() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_intenabled(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.Link)
+  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.SwitchGroup)
   return target;
 }
 
-size_t Link::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ns3_proto.Link)
+size_t SwitchGroup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ns3_proto.SwitchGroup)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string rate = 5;
-  if (!this->_internal_rate().empty()) {
+  // repeated .ns3_proto.SwitchPortConfig ports = 5;
+  total_size += 1UL * this->_internal_ports_size();
+  for (const auto& msg : this->_impl_.ports_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string bufferSize = 3;
+  if (!this->_internal_buffersize().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_rate());
+        this->_internal_buffersize());
   }
 
-  // string delay = 6;
-  if (!this->_internal_delay().empty()) {
+  // .ns3_proto.SharedBufferConfig sharedBuffer = 6;
+  if (this->_internal_has_sharedbuffer()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_delay());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.sharedbuffer_);
   }
 
-  // uint32 node1 = 1;
-  if (this->_internal_node1() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_node1());
+  // .ns3_proto.LoadBalanceConfig loadBalance = 7;
+  if (this->_internal_has_loadbalance()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.loadbalance_);
   }
 
-  // uint32 node2 = 2;
-  if (this->_internal_node2() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_node2());
+  // uint32 nodesNum = 1;
+  if (this->_internal_nodesnum() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_nodesnum());
   }
 
-  // uint32 port1 = 3;
-  if (this->_internal_port1() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_port1());
+  // uint32 baseIndex = 2;
+  if (this->_internal_baseindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_baseindex());
   }
 
-  // uint32 port2 = 4;
-  if (this->_internal_port2() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_port2());
+  // uint32 queueNum = 4;
+  if (this->_internal_queuenum() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_queuenum());
+  }
+
+  // bool intEnabled = 8;
+  if (this->_internal_intenabled() != 0) {
+    total_size += 1 + 1;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Link::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SwitchGroup::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    Link::MergeImpl
+    SwitchGroup::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Link::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SwitchGroup::GetClassData() const { return &_class_data_; }
 
 
-void Link::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<Link*>(&to_msg);
-  auto& from = static_cast<const Link&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.Link)
+void SwitchGroup::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SwitchGroup*>(&to_msg);
+  auto& from = static_cast<const SwitchGroup&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.SwitchGroup)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_rate().empty()) {
-    _this->_internal_set_rate(from._internal_rate());
+  _this->_impl_.ports_.MergeFrom(from._impl_.ports_);
+  if (!from._internal_buffersize().empty()) {
+    _this->_internal_set_buffersize(from._internal_buffersize());
   }
-  if (!from._internal_delay().empty()) {
-    _this->_internal_set_delay(from._internal_delay());
+  if (from._internal_has_sharedbuffer()) {
+    _this->_internal_mutable_sharedbuffer()->::ns3_proto::SharedBufferConfig::MergeFrom(
+        from._internal_sharedbuffer());
   }
-  if (from._internal_node1() != 0) {
-    _this->_internal_set_node1(from._internal_node1());
+  if (from._internal_has_loadbalance()) {
+    _this->_internal_mutable_loadbalance()->::ns3_proto::LoadBalanceConfig::MergeFrom(
+        from._internal_loadbalance());
   }
-  if (from._internal_node2() != 0) {
-    _this->_internal_set_node2(from._internal_node2());
+  if (from._internal_nodesnum() != 0) {
+    _this->_internal_set_nodesnum(from._internal_nodesnum());
   }
-  if (from._internal_port1() != 0) {
-    _this->_internal_set_port1(from._internal_port1());
+  if (from._internal_baseindex() != 0) {
+    _this->_internal_set_baseindex(from._internal_baseindex());
   }
-  if (from._internal_port2() != 0) {
-    _this->_internal_set_port2(from._internal_port2());
+  if (from._internal_queuenum() != 0) {
+    _this->_internal_set_queuenum(from._internal_queuenum());
+  }
+  if (from._internal_intenabled() != 0) {
+    _this->_internal_set_intenabled(from._internal_intenabled());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Link::CopyFrom(const Link& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.Link)
+void SwitchGroup::CopyFrom(const SwitchGroup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.SwitchGroup)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Link::IsInitialized() const {
+bool SwitchGroup::IsInitialized() const {
   return true;
 }
 
-void Link::InternalSwap(Link* other) {
+void SwitchGroup::InternalSwap(SwitchGroup* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ports_.InternalSwap(&other->_impl_.ports_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.rate_, lhs_arena,
-      &other->_impl_.rate_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.delay_, lhs_arena,
-      &other->_impl_.delay_, rhs_arena
+      &_impl_.buffersize_, lhs_arena,
+      &other->_impl_.buffersize_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Link, _impl_.port2_)
-      + sizeof(Link::_impl_.port2_)
-      - PROTOBUF_FIELD_OFFSET(Link, _impl_.node1_)>(
-          reinterpret_cast<char*>(&_impl_.node1_),
-          reinterpret_cast<char*>(&other->_impl_.node1_));
+      PROTOBUF_FIELD_OFFSET(SwitchGroup, _impl_.intenabled_)
+      + sizeof(SwitchGroup::_impl_.intenabled_)
+      - PROTOBUF_FIELD_OFFSET(SwitchGroup, _impl_.sharedbuffer_)>(
+          reinterpret_cast<char*>(&_impl_.sharedbuffer_),
+          reinterpret_cast<char*>(&other->_impl_.sharedbuffer_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Link::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SwitchGroup::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_configurations_2eproto_getter, &descriptor_table_configurations_2eproto_once,
       file_level_metadata_configurations_2eproto[7]);
@@ -2640,133 +3053,48 @@ void Link::InternalSwap(Link* other) {
 
 // ===================================================================
 
-class Application::_Internal {
+class AllNodes::_Internal {
  public:
-  using HasBits = decltype(std::declval<Application>()._impl_._has_bits_);
-  static void set_has_protocolgroup(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
-  static void set_has_arg(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
-  static void set_has_load(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
-  }
-  static void set_has_dest(HasBits* has_bits) {
-    (*has_bits)[0] |= 8u;
-  }
 };
 
-Application::Application(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+AllNodes::AllNodes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:ns3_proto.Application)
+  // @@protoc_insertion_point(arena_constructor:ns3_proto.AllNodes)
 }
-Application::Application(const Application& from)
+AllNodes::AllNodes(const AllNodes& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  Application* const _this = this; (void)_this;
+  AllNodes* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){from._impl_._has_bits_}
-    , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.nodeindices_){from._impl_.nodeindices_}
-    , /*decltype(_impl_._nodeindices_cached_byte_size_)*/{0}
-    , decltype(_impl_.appname_){}
-    , decltype(_impl_.protocolgroup_){}
-    , decltype(_impl_.arg_){}
-    , decltype(_impl_.starttime_){}
-    , decltype(_impl_.stoptime_){}
-    , decltype(_impl_.load_){}
-    , decltype(_impl_.dest_){}};
+      decltype(_impl_.hostgroups_){from._impl_.hostgroups_}
+    , decltype(_impl_.switchgroups_){from._impl_.switchgroups_}
+    , decltype(_impl_.systemids_){from._impl_.systemids_}
+    , /*decltype(_impl_._systemids_cached_byte_size_)*/{0}
+    , decltype(_impl_.num_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.appname_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.appname_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_appname().empty()) {
-    _this->_impl_.appname_.Set(from._internal_appname(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.protocolgroup_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.protocolgroup_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_protocolgroup()) {
-    _this->_impl_.protocolgroup_.Set(from._internal_protocolgroup(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.arg_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.arg_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_arg()) {
-    _this->_impl_.arg_.Set(from._internal_arg(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.starttime_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.starttime_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_starttime().empty()) {
-    _this->_impl_.starttime_.Set(from._internal_starttime(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.stoptime_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.stoptime_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_stoptime().empty()) {
-    _this->_impl_.stoptime_.Set(from._internal_stoptime(), 
-      _this->GetArenaForAllocation());
-  }
-  ::memcpy(&_impl_.load_, &from._impl_.load_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.dest_) -
-    reinterpret_cast<char*>(&_impl_.load_)) + sizeof(_impl_.dest_));
-  // @@protoc_insertion_point(copy_constructor:ns3_proto.Application)
+  _this->_impl_.num_ = from._impl_.num_;
+  // @@protoc_insertion_point(copy_constructor:ns3_proto.AllNodes)
 }
 
-inline void Application::SharedCtor(
+inline void AllNodes::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){}
+      decltype(_impl_.hostgroups_){arena}
+    , decltype(_impl_.switchgroups_){arena}
+    , decltype(_impl_.systemids_){arena}
+    , /*decltype(_impl_._systemids_cached_byte_size_)*/{0}
+    , decltype(_impl_.num_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.nodeindices_){arena}
-    , /*decltype(_impl_._nodeindices_cached_byte_size_)*/{0}
-    , decltype(_impl_.appname_){}
-    , decltype(_impl_.protocolgroup_){}
-    , decltype(_impl_.arg_){}
-    , decltype(_impl_.starttime_){}
-    , decltype(_impl_.stoptime_){}
-    , decltype(_impl_.load_){0}
-    , decltype(_impl_.dest_){0u}
   };
-  _impl_.appname_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.appname_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.protocolgroup_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.protocolgroup_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.arg_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.arg_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.starttime_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.starttime_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.stoptime_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.stoptime_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-Application::~Application() {
-  // @@protoc_insertion_point(destructor:ns3_proto.Application)
+AllNodes::~AllNodes() {
+  // @@protoc_insertion_point(destructor:ns3_proto.AllNodes)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2774,130 +3102,77 @@ Application::~Application() {
   SharedDtor();
 }
 
-inline void Application::SharedDtor() {
+inline void AllNodes::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.nodeindices_.~RepeatedField();
-  _impl_.appname_.Destroy();
-  _impl_.protocolgroup_.Destroy();
-  _impl_.arg_.Destroy();
-  _impl_.starttime_.Destroy();
-  _impl_.stoptime_.Destroy();
+  _impl_.hostgroups_.~RepeatedPtrField();
+  _impl_.switchgroups_.~RepeatedPtrField();
+  _impl_.systemids_.~RepeatedField();
 }
 
-void Application::SetCachedSize(int size) const {
+void AllNodes::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void Application::Clear() {
-// @@protoc_insertion_point(message_clear_start:ns3_proto.Application)
+void AllNodes::Clear() {
+// @@protoc_insertion_point(message_clear_start:ns3_proto.AllNodes)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.nodeindices_.Clear();
-  _impl_.appname_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _impl_.protocolgroup_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _impl_.arg_.ClearNonDefaultToEmpty();
-    }
-  }
-  _impl_.starttime_.ClearToEmpty();
-  _impl_.stoptime_.ClearToEmpty();
-  if (cached_has_bits & 0x0000000cu) {
-    ::memset(&_impl_.load_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&_impl_.dest_) -
-        reinterpret_cast<char*>(&_impl_.load_)) + sizeof(_impl_.dest_));
-  }
-  _impl_._has_bits_.Clear();
+  _impl_.hostgroups_.Clear();
+  _impl_.switchgroups_.Clear();
+  _impl_.systemids_.Clear();
+  _impl_.num_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Application::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* AllNodes::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated uint32 nodeIndices = 1;
+      // uint32 num = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_nodeindices(), ptr, ctx);
-          CHK_(ptr);
-        } else if (static_cast<uint8_t>(tag) == 8) {
-          _internal_add_nodeindices(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // string appName = 2;
+      // repeated .ns3_proto.HostGroup hostGroups = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_appname();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Application.appName"));
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_hostgroups(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // optional string protocolGroup = 3;
+      // repeated .ns3_proto.SwitchGroup switchGroups = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_protocolgroup();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Application.protocolGroup"));
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_switchgroups(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // optional string arg = 4;
+      // repeated uint32 systemIds = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_arg();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Application.arg"));
-        } else
-          goto handle_unusual;
-        continue;
-      // optional double load = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
-          _Internal::set_has_load(&has_bits);
-          _impl_.load_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      // string startTime = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
-          auto str = _internal_mutable_starttime();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Application.startTime"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string stopTime = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
-          auto str = _internal_mutable_stoptime();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_systemids(), ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Application.stopTime"));
-        } else
-          goto handle_unusual;
-        continue;
-      // optional uint32 dest = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
-          _Internal::set_has_dest(&has_bits);
-          _impl_.dest_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_systemids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -2918,7 +3193,6 @@ const char* Application::_InternalParse(const char* ptr, ::_pbi::ParseContext* c
     CHK_(ptr != nullptr);
   }  // while
 message_done:
-  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -2926,309 +3200,1656 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Application::_InternalSerialize(
+uint8_t* AllNodes::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.Application)
+  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.AllNodes)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated uint32 nodeIndices = 1;
+  // uint32 num = 1;
+  if (this->_internal_num() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_num(), target);
+  }
+
+  // repeated .ns3_proto.HostGroup hostGroups = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_hostgroups_size()); i < n; i++) {
+    const auto& repfield = this->_internal_hostgroups(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .ns3_proto.SwitchGroup switchGroups = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_switchgroups_size()); i < n; i++) {
+    const auto& repfield = this->_internal_switchgroups(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated uint32 systemIds = 4;
   {
-    int byte_size = _impl_._nodeindices_cached_byte_size_.load(std::memory_order_relaxed);
+    int byte_size = _impl_._systemids_cached_byte_size_.load(std::memory_order_relaxed);
     if (byte_size > 0) {
       target = stream->WriteUInt32Packed(
-          1, _internal_nodeindices(), byte_size, target);
+          4, _internal_systemids(), byte_size, target);
     }
   }
 
-  // string appName = 2;
-  if (!this->_internal_appname().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_appname().data(), static_cast<int>(this->_internal_appname().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "ns3_proto.Application.appName");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_appname(), target);
-  }
-
-  // optional string protocolGroup = 3;
-  if (_internal_has_protocolgroup()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_protocolgroup().data(), static_cast<int>(this->_internal_protocolgroup().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "ns3_proto.Application.protocolGroup");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_protocolgroup(), target);
-  }
-
-  // optional string arg = 4;
-  if (_internal_has_arg()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_arg().data(), static_cast<int>(this->_internal_arg().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "ns3_proto.Application.arg");
-    target = stream->WriteStringMaybeAliased(
-        4, this->_internal_arg(), target);
-  }
-
-  // optional double load = 5;
-  if (_internal_has_load()) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_load(), target);
-  }
-
-  // string startTime = 6;
-  if (!this->_internal_starttime().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_starttime().data(), static_cast<int>(this->_internal_starttime().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "ns3_proto.Application.startTime");
-    target = stream->WriteStringMaybeAliased(
-        6, this->_internal_starttime(), target);
-  }
-
-  // string stopTime = 7;
-  if (!this->_internal_stoptime().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_stoptime().data(), static_cast<int>(this->_internal_stoptime().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "ns3_proto.Application.stopTime");
-    target = stream->WriteStringMaybeAliased(
-        7, this->_internal_stoptime(), target);
-  }
-
-  // optional uint32 dest = 8;
-  if (_internal_has_dest()) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_dest(), target);
-  }
-
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.Application)
+  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.AllNodes)
   return target;
 }
 
-size_t Application::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ns3_proto.Application)
+size_t AllNodes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ns3_proto.AllNodes)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated uint32 nodeIndices = 1;
+  // repeated .ns3_proto.HostGroup hostGroups = 2;
+  total_size += 1UL * this->_internal_hostgroups_size();
+  for (const auto& msg : this->_impl_.hostgroups_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .ns3_proto.SwitchGroup switchGroups = 3;
+  total_size += 1UL * this->_internal_switchgroups_size();
+  for (const auto& msg : this->_impl_.switchgroups_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated uint32 systemIds = 4;
   {
     size_t data_size = ::_pbi::WireFormatLite::
-      UInt32Size(this->_impl_.nodeindices_);
+      UInt32Size(this->_impl_.systemids_);
     if (data_size > 0) {
       total_size += 1 +
         ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
     int cached_size = ::_pbi::ToCachedSize(data_size);
-    _impl_._nodeindices_cached_byte_size_.store(cached_size,
+    _impl_._systemids_cached_byte_size_.store(cached_size,
                                     std::memory_order_relaxed);
     total_size += data_size;
   }
 
-  // string appName = 2;
-  if (!this->_internal_appname().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_appname());
+  // uint32 num = 1;
+  if (this->_internal_num() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num());
   }
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    // optional string protocolGroup = 3;
-    if (cached_has_bits & 0x00000001u) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-          this->_internal_protocolgroup());
-    }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-    // optional string arg = 4;
-    if (cached_has_bits & 0x00000002u) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-          this->_internal_arg());
-    }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AllNodes::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AllNodes::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AllNodes::GetClassData() const { return &_class_data_; }
+
+
+void AllNodes::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AllNodes*>(&to_msg);
+  auto& from = static_cast<const AllNodes&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.AllNodes)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.hostgroups_.MergeFrom(from._impl_.hostgroups_);
+  _this->_impl_.switchgroups_.MergeFrom(from._impl_.switchgroups_);
+  _this->_impl_.systemids_.MergeFrom(from._impl_.systemids_);
+  if (from._internal_num() != 0) {
+    _this->_internal_set_num(from._internal_num());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AllNodes::CopyFrom(const AllNodes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.AllNodes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AllNodes::IsInitialized() const {
+  return true;
+}
+
+void AllNodes::InternalSwap(AllNodes* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.hostgroups_.InternalSwap(&other->_impl_.hostgroups_);
+  _impl_.switchgroups_.InternalSwap(&other->_impl_.switchgroups_);
+  _impl_.systemids_.InternalSwap(&other->_impl_.systemids_);
+  swap(_impl_.num_, other->_impl_.num_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AllNodes::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_configurations_2eproto_getter, &descriptor_table_configurations_2eproto_once,
+      file_level_metadata_configurations_2eproto[8]);
+}
+
+// ===================================================================
+
+class Link::_Internal {
+ public:
+};
+
+Link::Link(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ns3_proto.Link)
+}
+Link::Link(const Link& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Link* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rate_){}
+    , decltype(_impl_.delay_){}
+    , decltype(_impl_.node1_){}
+    , decltype(_impl_.node2_){}
+    , decltype(_impl_.port1_){}
+    , decltype(_impl_.port2_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rate_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rate_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rate().empty()) {
+    _this->_impl_.rate_.Set(from._internal_rate(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.delay_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.delay_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_delay().empty()) {
+    _this->_impl_.delay_.Set(from._internal_delay(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.node1_, &from._impl_.node1_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.port2_) -
+    reinterpret_cast<char*>(&_impl_.node1_)) + sizeof(_impl_.port2_));
+  // @@protoc_insertion_point(copy_constructor:ns3_proto.Link)
+}
+
+inline void Link::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rate_){}
+    , decltype(_impl_.delay_){}
+    , decltype(_impl_.node1_){0u}
+    , decltype(_impl_.node2_){0u}
+    , decltype(_impl_.port1_){0u}
+    , decltype(_impl_.port2_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rate_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rate_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.delay_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.delay_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Link::~Link() {
+  // @@protoc_insertion_point(destructor:ns3_proto.Link)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Link::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rate_.Destroy();
+  _impl_.delay_.Destroy();
+}
+
+void Link::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Link::Clear() {
+// @@protoc_insertion_point(message_clear_start:ns3_proto.Link)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rate_.ClearToEmpty();
+  _impl_.delay_.ClearToEmpty();
+  ::memset(&_impl_.node1_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.port2_) -
+      reinterpret_cast<char*>(&_impl_.node1_)) + sizeof(_impl_.port2_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
+const char* Link::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 node1 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.node1_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 node2 = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.node2_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 port1 = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.port1_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 port2 = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.port2_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string rate = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_rate();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Link.rate"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string delay = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_delay();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Link.delay"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Link::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.Link)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 node1 = 1;
+  if (this->_internal_node1() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_node1(), target);
+  }
+
+  // uint32 node2 = 2;
+  if (this->_internal_node2() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_node2(), target);
+  }
+
+  // uint32 port1 = 3;
+  if (this->_internal_port1() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_port1(), target);
+  }
+
+  // uint32 port2 = 4;
+  if (this->_internal_port2() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_port2(), target);
+  }
+
+  // string rate = 5;
+  if (!this->_internal_rate().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rate().data(), static_cast<int>(this->_internal_rate().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.Link.rate");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_rate(), target);
+  }
+
+  // string delay = 6;
+  if (!this->_internal_delay().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_delay().data(), static_cast<int>(this->_internal_delay().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.Link.delay");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_delay(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.Link)
+  return target;
+}
+
+size_t Link::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ns3_proto.Link)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rate = 5;
+  if (!this->_internal_rate().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rate());
+  }
+
+  // string delay = 6;
+  if (!this->_internal_delay().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_delay());
+  }
+
+  // uint32 node1 = 1;
+  if (this->_internal_node1() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_node1());
+  }
+
+  // uint32 node2 = 2;
+  if (this->_internal_node2() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_node2());
+  }
+
+  // uint32 port1 = 3;
+  if (this->_internal_port1() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_port1());
+  }
+
+  // uint32 port2 = 4;
+  if (this->_internal_port2() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_port2());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Link::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Link::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Link::GetClassData() const { return &_class_data_; }
+
+
+void Link::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Link*>(&to_msg);
+  auto& from = static_cast<const Link&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.Link)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rate().empty()) {
+    _this->_internal_set_rate(from._internal_rate());
+  }
+  if (!from._internal_delay().empty()) {
+    _this->_internal_set_delay(from._internal_delay());
+  }
+  if (from._internal_node1() != 0) {
+    _this->_internal_set_node1(from._internal_node1());
+  }
+  if (from._internal_node2() != 0) {
+    _this->_internal_set_node2(from._internal_node2());
+  }
+  if (from._internal_port1() != 0) {
+    _this->_internal_set_port1(from._internal_port1());
+  }
+  if (from._internal_port2() != 0) {
+    _this->_internal_set_port2(from._internal_port2());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Link::CopyFrom(const Link& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.Link)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Link::IsInitialized() const {
+  return true;
+}
+
+void Link::InternalSwap(Link* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rate_, lhs_arena,
+      &other->_impl_.rate_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.delay_, lhs_arena,
+      &other->_impl_.delay_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Link, _impl_.port2_)
+      + sizeof(Link::_impl_.port2_)
+      - PROTOBUF_FIELD_OFFSET(Link, _impl_.node1_)>(
+          reinterpret_cast<char*>(&_impl_.node1_),
+          reinterpret_cast<char*>(&other->_impl_.node1_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Link::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_configurations_2eproto_getter, &descriptor_table_configurations_2eproto_once,
+      file_level_metadata_configurations_2eproto[9]);
+}
+
+// ===================================================================
+
+class Application::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Application>()._impl_._has_bits_);
+  static void set_has_protocolgroup(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_arg(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_load(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_dest(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_filename(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+Application::Application(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ns3_proto.Application)
+}
+Application::Application(const Application& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Application* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.nodeindices_){from._impl_.nodeindices_}
+    , /*decltype(_impl_._nodeindices_cached_byte_size_)*/{0}
+    , decltype(_impl_.appname_){}
+    , decltype(_impl_.protocolgroup_){}
+    , decltype(_impl_.arg_){}
+    , decltype(_impl_.starttime_){}
+    , decltype(_impl_.stoptime_){}
+    , decltype(_impl_.filename_){}
+    , decltype(_impl_.load_){}
+    , decltype(_impl_.dest_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.appname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.appname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_appname().empty()) {
+    _this->_impl_.appname_.Set(from._internal_appname(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.protocolgroup_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.protocolgroup_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_protocolgroup()) {
+    _this->_impl_.protocolgroup_.Set(from._internal_protocolgroup(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.arg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.arg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_arg()) {
+    _this->_impl_.arg_.Set(from._internal_arg(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.starttime_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.starttime_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_starttime().empty()) {
+    _this->_impl_.starttime_.Set(from._internal_starttime(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.stoptime_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stoptime_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_stoptime().empty()) {
+    _this->_impl_.stoptime_.Set(from._internal_stoptime(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.filename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_filename()) {
+    _this->_impl_.filename_.Set(from._internal_filename(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.load_, &from._impl_.load_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.dest_) -
+    reinterpret_cast<char*>(&_impl_.load_)) + sizeof(_impl_.dest_));
+  // @@protoc_insertion_point(copy_constructor:ns3_proto.Application)
+}
+
+inline void Application::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.nodeindices_){arena}
+    , /*decltype(_impl_._nodeindices_cached_byte_size_)*/{0}
+    , decltype(_impl_.appname_){}
+    , decltype(_impl_.protocolgroup_){}
+    , decltype(_impl_.arg_){}
+    , decltype(_impl_.starttime_){}
+    , decltype(_impl_.stoptime_){}
+    , decltype(_impl_.filename_){}
+    , decltype(_impl_.load_){0}
+    , decltype(_impl_.dest_){0u}
+  };
+  _impl_.appname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.appname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.protocolgroup_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.protocolgroup_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.arg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.arg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.starttime_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.starttime_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.stoptime_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stoptime_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.filename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Application::~Application() {
+  // @@protoc_insertion_point(destructor:ns3_proto.Application)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Application::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.nodeindices_.~RepeatedField();
+  _impl_.appname_.Destroy();
+  _impl_.protocolgroup_.Destroy();
+  _impl_.arg_.Destroy();
+  _impl_.starttime_.Destroy();
+  _impl_.stoptime_.Destroy();
+  _impl_.filename_.Destroy();
+}
+
+void Application::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Application::Clear() {
+// @@protoc_insertion_point(message_clear_start:ns3_proto.Application)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.nodeindices_.Clear();
+  _impl_.appname_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.protocolgroup_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.arg_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.starttime_.ClearToEmpty();
+  _impl_.stoptime_.ClearToEmpty();
+  if (cached_has_bits & 0x00000004u) {
+    _impl_.filename_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000018u) {
+    ::memset(&_impl_.load_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.dest_) -
+        reinterpret_cast<char*>(&_impl_.load_)) + sizeof(_impl_.dest_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Application::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 nodeIndices = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_nodeindices(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_nodeindices(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string appName = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_appname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Application.appName"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string protocolGroup = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_protocolgroup();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Application.protocolGroup"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string arg = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_arg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Application.arg"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double load = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_load(&has_bits);
+          _impl_.load_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // string startTime = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_starttime();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Application.startTime"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string stopTime = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_stoptime();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Application.stopTime"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 dest = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_dest(&has_bits);
+          _impl_.dest_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string fileName = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_filename();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Application.fileName"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Application::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.Application)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 nodeIndices = 1;
+  {
+    int byte_size = _impl_._nodeindices_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_nodeindices(), byte_size, target);
+    }
+  }
+
+  // string appName = 2;
+  if (!this->_internal_appname().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_appname().data(), static_cast<int>(this->_internal_appname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.Application.appName");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_appname(), target);
+  }
+
+  // optional string protocolGroup = 3;
+  if (_internal_has_protocolgroup()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_protocolgroup().data(), static_cast<int>(this->_internal_protocolgroup().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.Application.protocolGroup");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_protocolgroup(), target);
+  }
+
+  // optional string arg = 4;
+  if (_internal_has_arg()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_arg().data(), static_cast<int>(this->_internal_arg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.Application.arg");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_arg(), target);
+  }
+
+  // optional double load = 5;
+  if (_internal_has_load()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_load(), target);
+  }
+
+  // string startTime = 6;
+  if (!this->_internal_starttime().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_starttime().data(), static_cast<int>(this->_internal_starttime().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.Application.startTime");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_starttime(), target);
+  }
+
+  // string stopTime = 7;
+  if (!this->_internal_stoptime().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_stoptime().data(), static_cast<int>(this->_internal_stoptime().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.Application.stopTime");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_stoptime(), target);
+  }
+
+  // optional uint32 dest = 8;
+  if (_internal_has_dest()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_dest(), target);
+  }
+
+  // optional string fileName = 9;
+  if (_internal_has_filename()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_filename().data(), static_cast<int>(this->_internal_filename().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.Application.fileName");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_filename(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.Application)
+  return target;
+}
+
+size_t Application::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ns3_proto.Application)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 nodeIndices = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.nodeindices_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._nodeindices_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string appName = 2;
+  if (!this->_internal_appname().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_appname());
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string protocolGroup = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_protocolgroup());
+    }
+
+    // optional string arg = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_arg());
+    }
+
+  }
+  // string startTime = 6;
+  if (!this->_internal_starttime().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_starttime());
+  }
+
+  // string stopTime = 7;
+  if (!this->_internal_stoptime().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_stoptime());
+  }
+
+  if (cached_has_bits & 0x0000001cu) {
+    // optional string fileName = 9;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_filename());
+    }
+
+    // optional double load = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint32 dest = 8;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dest());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Application::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Application::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Application::GetClassData() const { return &_class_data_; }
+
+
+void Application::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Application*>(&to_msg);
+  auto& from = static_cast<const Application&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.Application)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.nodeindices_.MergeFrom(from._impl_.nodeindices_);
+  if (!from._internal_appname().empty()) {
+    _this->_internal_set_appname(from._internal_appname());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_protocolgroup(from._internal_protocolgroup());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_arg(from._internal_arg());
+    }
+  }
+  if (!from._internal_starttime().empty()) {
+    _this->_internal_set_starttime(from._internal_starttime());
+  }
+  if (!from._internal_stoptime().empty()) {
+    _this->_internal_set_stoptime(from._internal_stoptime());
+  }
+  if (cached_has_bits & 0x0000001cu) {
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_filename(from._internal_filename());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.load_ = from._impl_.load_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.dest_ = from._impl_.dest_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Application::CopyFrom(const Application& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.Application)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Application::IsInitialized() const {
+  return true;
+}
+
+void Application::InternalSwap(Application* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.nodeindices_.InternalSwap(&other->_impl_.nodeindices_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.appname_, lhs_arena,
+      &other->_impl_.appname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.protocolgroup_, lhs_arena,
+      &other->_impl_.protocolgroup_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.arg_, lhs_arena,
+      &other->_impl_.arg_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.starttime_, lhs_arena,
+      &other->_impl_.starttime_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.stoptime_, lhs_arena,
+      &other->_impl_.stoptime_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.filename_, lhs_arena,
+      &other->_impl_.filename_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Application, _impl_.dest_)
+      + sizeof(Application::_impl_.dest_)
+      - PROTOBUF_FIELD_OFFSET(Application, _impl_.load_)>(
+          reinterpret_cast<char*>(&_impl_.load_),
+          reinterpret_cast<char*>(&other->_impl_.load_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Application::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_configurations_2eproto_getter, &descriptor_table_configurations_2eproto_once,
+      file_level_metadata_configurations_2eproto[10]);
+}
+
+// ===================================================================
+
+class Topology::_Internal {
+ public:
+  static const ::ns3_proto::AllNodes& nodes(const Topology* msg);
+};
+
+const ::ns3_proto::AllNodes&
+Topology::_Internal::nodes(const Topology* msg) {
+  return *msg->_impl_.nodes_;
+}
+Topology::Topology(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ns3_proto.Topology)
+}
+Topology::Topology(const Topology& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Topology* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.links_){from._impl_.links_}
+    , decltype(_impl_.nodes_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_nodes()) {
+    _this->_impl_.nodes_ = new ::ns3_proto::AllNodes(*from._impl_.nodes_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ns3_proto.Topology)
+}
+
+inline void Topology::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.links_){arena}
+    , decltype(_impl_.nodes_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Topology::~Topology() {
+  // @@protoc_insertion_point(destructor:ns3_proto.Topology)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Topology::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.links_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.nodes_;
+}
+
+void Topology::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Topology::Clear() {
+// @@protoc_insertion_point(message_clear_start:ns3_proto.Topology)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.links_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.nodes_ != nullptr) {
+    delete _impl_.nodes_;
+  }
+  _impl_.nodes_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Topology::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .ns3_proto.AllNodes nodes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_nodes(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ns3_proto.Link links = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_links(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Topology::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.Topology)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .ns3_proto.AllNodes nodes = 1;
+  if (this->_internal_has_nodes()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::nodes(this),
+        _Internal::nodes(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .ns3_proto.Link links = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_links_size()); i < n; i++) {
+    const auto& repfield = this->_internal_links(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.Topology)
+  return target;
+}
+
+size_t Topology::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ns3_proto.Topology)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ns3_proto.Link links = 2;
+  total_size += 1UL * this->_internal_links_size();
+  for (const auto& msg : this->_impl_.links_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .ns3_proto.AllNodes nodes = 1;
+  if (this->_internal_has_nodes()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.nodes_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Topology::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Topology::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Topology::GetClassData() const { return &_class_data_; }
+
+
+void Topology::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Topology*>(&to_msg);
+  auto& from = static_cast<const Topology&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.Topology)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.links_.MergeFrom(from._impl_.links_);
+  if (from._internal_has_nodes()) {
+    _this->_internal_mutable_nodes()->::ns3_proto::AllNodes::MergeFrom(
+        from._internal_nodes());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Topology::CopyFrom(const Topology& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.Topology)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Topology::IsInitialized() const {
+  return true;
+}
+
+void Topology::InternalSwap(Topology* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.links_.InternalSwap(&other->_impl_.links_);
+  swap(_impl_.nodes_, other->_impl_.nodes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Topology::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_configurations_2eproto_getter, &descriptor_table_configurations_2eproto_once,
+      file_level_metadata_configurations_2eproto[11]);
+}
+
+// ===================================================================
+
+class Configurations::_Internal {
+ public:
+  static const ::ns3_proto::GlobalConfig& globalconfig(const Configurations* msg);
+  static const ::ns3_proto::Topology& topology(const Configurations* msg);
+};
+
+const ::ns3_proto::GlobalConfig&
+Configurations::_Internal::globalconfig(const Configurations* msg) {
+  return *msg->_impl_.globalconfig_;
+}
+const ::ns3_proto::Topology&
+Configurations::_Internal::topology(const Configurations* msg) {
+  return *msg->_impl_.topology_;
+}
+Configurations::Configurations(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ns3_proto.Configurations)
+}
+Configurations::Configurations(const Configurations& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Configurations* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.applications_){from._impl_.applications_}
+    , decltype(_impl_.globalconfig_){nullptr}
+    , decltype(_impl_.topology_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_globalconfig()) {
+    _this->_impl_.globalconfig_ = new ::ns3_proto::GlobalConfig(*from._impl_.globalconfig_);
+  }
+  if (from._internal_has_topology()) {
+    _this->_impl_.topology_ = new ::ns3_proto::Topology(*from._impl_.topology_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ns3_proto.Configurations)
+}
+
+inline void Configurations::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.applications_){arena}
+    , decltype(_impl_.globalconfig_){nullptr}
+    , decltype(_impl_.topology_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Configurations::~Configurations() {
+  // @@protoc_insertion_point(destructor:ns3_proto.Configurations)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Configurations::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.applications_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.globalconfig_;
+  if (this != internal_default_instance()) delete _impl_.topology_;
+}
+
+void Configurations::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Configurations::Clear() {
+// @@protoc_insertion_point(message_clear_start:ns3_proto.Configurations)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.applications_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.globalconfig_ != nullptr) {
+    delete _impl_.globalconfig_;
+  }
+  _impl_.globalconfig_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.topology_ != nullptr) {
+    delete _impl_.topology_;
+  }
+  _impl_.topology_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Configurations::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .ns3_proto.GlobalConfig globalConfig = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_globalconfig(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .ns3_proto.Topology topology = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_topology(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ns3_proto.Application applications = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_applications(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Configurations::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.Configurations)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .ns3_proto.GlobalConfig globalConfig = 1;
+  if (this->_internal_has_globalconfig()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::globalconfig(this),
+        _Internal::globalconfig(this).GetCachedSize(), target, stream);
+  }
+
+  // .ns3_proto.Topology topology = 2;
+  if (this->_internal_has_topology()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::topology(this),
+        _Internal::topology(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .ns3_proto.Application applications = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_applications_size()); i < n; i++) {
+    const auto& repfield = this->_internal_applications(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.Configurations)
+  return target;
+}
+
+size_t Configurations::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ns3_proto.Configurations)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ns3_proto.Application applications = 3;
+  total_size += 1UL * this->_internal_applications_size();
+  for (const auto& msg : this->_impl_.applications_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  // string startTime = 6;
-  if (!this->_internal_starttime().empty()) {
+
+  // .ns3_proto.GlobalConfig globalConfig = 1;
+  if (this->_internal_has_globalconfig()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_starttime());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.globalconfig_);
   }
 
-  // string stopTime = 7;
-  if (!this->_internal_stoptime().empty()) {
+  // .ns3_proto.Topology topology = 2;
+  if (this->_internal_has_topology()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_stoptime());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.topology_);
   }
 
-  if (cached_has_bits & 0x0000000cu) {
-    // optional double load = 5;
-    if (cached_has_bits & 0x00000004u) {
-      total_size += 1 + 8;
-    }
-
-    // optional uint32 dest = 8;
-    if (cached_has_bits & 0x00000008u) {
-      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dest());
-    }
-
-  }
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Application::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Configurations::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    Application::MergeImpl
+    Configurations::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Application::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Configurations::GetClassData() const { return &_class_data_; }
 
 
-void Application::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<Application*>(&to_msg);
-  auto& from = static_cast<const Application&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.Application)
+void Configurations::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Configurations*>(&to_msg);
+  auto& from = static_cast<const Configurations&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.Configurations)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.nodeindices_.MergeFrom(from._impl_.nodeindices_);
-  if (!from._internal_appname().empty()) {
-    _this->_internal_set_appname(from._internal_appname());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_internal_set_protocolgroup(from._internal_protocolgroup());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_internal_set_arg(from._internal_arg());
-    }
-  }
-  if (!from._internal_starttime().empty()) {
-    _this->_internal_set_starttime(from._internal_starttime());
-  }
-  if (!from._internal_stoptime().empty()) {
-    _this->_internal_set_stoptime(from._internal_stoptime());
+  _this->_impl_.applications_.MergeFrom(from._impl_.applications_);
+  if (from._internal_has_globalconfig()) {
+    _this->_internal_mutable_globalconfig()->::ns3_proto::GlobalConfig::MergeFrom(
+        from._internal_globalconfig());
   }
-  if (cached_has_bits & 0x0000000cu) {
-    if (cached_has_bits & 0x00000004u) {
-      _this->_impl_.load_ = from._impl_.load_;
-    }
-    if (cached_has_bits & 0x00000008u) {
-      _this->_impl_.dest_ = from._impl_.dest_;
-    }
-    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  if (from._internal_has_topology()) {
+    _this->_internal_mutable_topology()->::ns3_proto::Topology::MergeFrom(
+        from._internal_topology());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Application::CopyFrom(const Application& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.Application)
+void Configurations::CopyFrom(const Configurations& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.Configurations)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Application::IsInitialized() const {
+bool Configurations::IsInitialized() const {
   return true;
 }
 
-void Application::InternalSwap(Application* other) {
+void Configurations::InternalSwap(Configurations* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.nodeindices_.InternalSwap(&other->_impl_.nodeindices_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.appname_, lhs_arena,
-      &other->_impl_.appname_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.protocolgroup_, lhs_arena,
-      &other->_impl_.protocolgroup_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.arg_, lhs_arena,
-      &other->_impl_.arg_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.starttime_, lhs_arena,
-      &other->_impl_.starttime_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.stoptime_, lhs_arena,
-      &other->_impl_.stoptime_, rhs_arena
-  );
+  _impl_.applications_.InternalSwap(&other->_impl_.applications_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Application, _impl_.dest_)
-      + sizeof(Application::_impl_.dest_)
-      - PROTOBUF_FIELD_OFFSET(Application, _impl_.load_)>(
-          reinterpret_cast<char*>(&_impl_.load_),
-          reinterpret_cast<char*>(&other->_impl_.load_));
+      PROTOBUF_FIELD_OFFSET(Configurations, _impl_.topology_)
+      + sizeof(Configurations::_impl_.topology_)
+      - PROTOBUF_FIELD_OFFSET(Configurations, _impl_.globalconfig_)>(
+          reinterpret_cast<char*>(&_impl_.globalconfig_),
+          reinterpret_cast<char*>(&other->_impl_.globalconfig_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Application::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata Configurations::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_configurations_2eproto_getter, &descriptor_table_configurations_2eproto_once,
-      file_level_metadata_configurations_2eproto[8]);
+      file_level_metadata_configurations_2eproto[12]);
 }
 
 // ===================================================================
 
-class Topology::_Internal {
+class SweepParameter::_Internal {
  public:
-  static const ::ns3_proto::AllNodes& nodes(const Topology* msg);
 };
 
-const ::ns3_proto::AllNodes&
-Topology::_Internal::nodes(const Topology* msg) {
-  return *msg->_impl_.nodes_;
-}
-Topology::Topology(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SweepParameter::SweepParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:ns3_proto.Topology)
+  // @@protoc_insertion_point(arena_constructor:ns3_proto.SweepParameter)
 }
-Topology::Topology(const Topology& from)
+SweepParameter::SweepParameter(const SweepParameter& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  Topology* const _this = this; (void)_this;
+  SweepParameter* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.links_){from._impl_.links_}
-    , decltype(_impl_.nodes_){nullptr}
+      decltype(_impl_.values_){from._impl_.values_}
+    , decltype(_impl_.name_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_nodes()) {
-    _this->_impl_.nodes_ = new ::ns3_proto::AllNodes(*from._impl_.nodes_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:ns3_proto.Topology)
+  // @@protoc_insertion_point(copy_constructor:ns3_proto.SweepParameter)
 }
 
-inline void Topology::SharedCtor(
+inline void SweepParameter::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.links_){arena}
-    , decltype(_impl_.nodes_){nullptr}
+      decltype(_impl_.values_){arena}
+    , decltype(_impl_.name_){}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-Topology::~Topology() {
-  // @@protoc_insertion_point(destructor:ns3_proto.Topology)
+SweepParameter::~SweepParameter() {
+  // @@protoc_insertion_point(destructor:ns3_proto.SweepParameter)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3236,52 +4857,53 @@ Topology::~Topology() {
   SharedDtor();
 }
 
-inline void Topology::SharedDtor() {
+inline void SweepParameter::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.links_.~RepeatedPtrField();
-  if (this != internal_default_instance()) delete _impl_.nodes_;
+  _impl_.values_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
 }
 
-void Topology::SetCachedSize(int size) const {
+void SweepParameter::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void Topology::Clear() {
-// @@protoc_insertion_point(message_clear_start:ns3_proto.Topology)
+void SweepParameter::Clear() {
+// @@protoc_insertion_point(message_clear_start:ns3_proto.SweepParameter)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.links_.Clear();
-  if (GetArenaForAllocation() == nullptr && _impl_.nodes_ != nullptr) {
-    delete _impl_.nodes_;
-  }
-  _impl_.nodes_ = nullptr;
+  _impl_.values_.Clear();
+  _impl_.name_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Topology::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SweepParameter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .ns3_proto.AllNodes nodes = 1;
+      // string name = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_nodes(), ptr);
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.SweepParameter.name"));
         } else
           goto handle_unusual;
         continue;
-      // repeated .ns3_proto.Link links = 2;
+      // repeated string values = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_links(), ptr);
+            auto str = _internal_add_values();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.SweepParameter.values"));
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
         } else
@@ -3310,162 +4932,234 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Topology::_InternalSerialize(
+uint8_t* SweepParameter::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.Topology)
+  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.SweepParameter)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .ns3_proto.AllNodes nodes = 1;
-  if (this->_internal_has_nodes()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::nodes(this),
-        _Internal::nodes(this).GetCachedSize(), target, stream);
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.SweepParameter.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
-  // repeated .ns3_proto.Link links = 2;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_links_size()); i < n; i++) {
-    const auto& repfield = this->_internal_links(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  // repeated string values = 2;
+  for (int i = 0, n = this->_internal_values_size(); i < n; i++) {
+    const auto& s = this->_internal_values(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.SweepParameter.values");
+    target = stream->WriteString(2, s, target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.Topology)
+  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.SweepParameter)
   return target;
 }
 
-size_t Topology::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ns3_proto.Topology)
+size_t SweepParameter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ns3_proto.SweepParameter)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .ns3_proto.Link links = 2;
-  total_size += 1UL * this->_internal_links_size();
-  for (const auto& msg : this->_impl_.links_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // repeated string values = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.values_.size());
+  for (int i = 0, n = _impl_.values_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.values_.Get(i));
   }
 
-  // .ns3_proto.AllNodes nodes = 1;
-  if (this->_internal_has_nodes()) {
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.nodes_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Topology::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SweepParameter::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    Topology::MergeImpl
+    SweepParameter::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Topology::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SweepParameter::GetClassData() const { return &_class_data_; }
 
 
-void Topology::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<Topology*>(&to_msg);
-  auto& from = static_cast<const Topology&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.Topology)
+void SweepParameter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SweepParameter*>(&to_msg);
+  auto& from = static_cast<const SweepParameter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.SweepParameter)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.links_.MergeFrom(from._impl_.links_);
-  if (from._internal_has_nodes()) {
-    _this->_internal_mutable_nodes()->::ns3_proto::AllNodes::MergeFrom(
-        from._internal_nodes());
+  _this->_impl_.values_.MergeFrom(from._impl_.values_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Topology::CopyFrom(const Topology& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.Topology)
+void SweepParameter::CopyFrom(const SweepParameter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.SweepParameter)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Topology::IsInitialized() const {
+bool SweepParameter::IsInitialized() const {
   return true;
 }
 
-void Topology::InternalSwap(Topology* other) {
+void SweepParameter::InternalSwap(SweepParameter* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.links_.InternalSwap(&other->_impl_.links_);
-  swap(_impl_.nodes_, other->_impl_.nodes_);
+  _impl_.values_.InternalSwap(&other->_impl_.values_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Topology::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SweepParameter::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_configurations_2eproto_getter, &descriptor_table_configurations_2eproto_once,
-      file_level_metadata_configurations_2eproto[9]);
+      file_level_metadata_configurations_2eproto[13]);
 }
 
 // ===================================================================
 
-class Configurations::_Internal {
+class Sweep::_Internal {
  public:
-  static const ::ns3_proto::GlobalConfig& globalconfig(const Configurations* msg);
-  static const ::ns3_proto::Topology& topology(const Configurations* msg);
+  using HasBits = decltype(std::declval<Sweep>()._impl_._has_bits_);
+  static const ::ns3_proto::Configurations& base(const Sweep* msg);
+  static void set_has_linerate(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_basertt(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
-const ::ns3_proto::GlobalConfig&
-Configurations::_Internal::globalconfig(const Configurations* msg) {
-  return *msg->_impl_.globalconfig_;
-}
-const ::ns3_proto::Topology&
-Configurations::_Internal::topology(const Configurations* msg) {
-  return *msg->_impl_.topology_;
+const ::ns3_proto::Configurations&
+Sweep::_Internal::base(const Sweep* msg) {
+  return *msg->_impl_.base_;
 }
-Configurations::Configurations(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+Sweep::Sweep(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:ns3_proto.Configurations)
+  // @@protoc_insertion_point(arena_constructor:ns3_proto.Sweep)
 }
-Configurations::Configurations(const Configurations& from)
+Sweep::Sweep(const Sweep& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  Configurations* const _this = this; (void)_this;
+  Sweep* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.applications_){from._impl_.applications_}
-    , decltype(_impl_.globalconfig_){nullptr}
-    , decltype(_impl_.topology_){nullptr}
-    , /*decltype(_impl_._cached_size_)*/{}};
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.parameters_){from._impl_.parameters_}
+    , decltype(_impl_.fctsizebins_){from._impl_.fctsizebins_}
+    , /*decltype(_impl_._fctsizebins_cached_byte_size_)*/{0}
+    , decltype(_impl_.outputdir_){}
+    , decltype(_impl_.stoptime_){}
+    , decltype(_impl_.linerate_){}
+    , decltype(_impl_.basertt_){}
+    , decltype(_impl_.base_){nullptr}
+    , decltype(_impl_.runs_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_globalconfig()) {
-    _this->_impl_.globalconfig_ = new ::ns3_proto::GlobalConfig(*from._impl_.globalconfig_);
+  _impl_.outputdir_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.outputdir_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_outputdir().empty()) {
+    _this->_impl_.outputdir_.Set(from._internal_outputdir(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.stoptime_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stoptime_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_stoptime().empty()) {
+    _this->_impl_.stoptime_.Set(from._internal_stoptime(), 
+      _this->GetArenaForAllocation());
   }
-  if (from._internal_has_topology()) {
-    _this->_impl_.topology_ = new ::ns3_proto::Topology(*from._impl_.topology_);
+  _impl_.linerate_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.linerate_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_linerate()) {
+    _this->_impl_.linerate_.Set(from._internal_linerate(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:ns3_proto.Configurations)
+  _impl_.basertt_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.basertt_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_basertt()) {
+    _this->_impl_.basertt_.Set(from._internal_basertt(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_base()) {
+    _this->_impl_.base_ = new ::ns3_proto::Configurations(*from._impl_.base_);
+  }
+  _this->_impl_.runs_ = from._impl_.runs_;
+  // @@protoc_insertion_point(copy_constructor:ns3_proto.Sweep)
 }
 
-inline void Configurations::SharedCtor(
+inline void Sweep::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.applications_){arena}
-    , decltype(_impl_.globalconfig_){nullptr}
-    , decltype(_impl_.topology_){nullptr}
+      decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.parameters_){arena}
+    , decltype(_impl_.fctsizebins_){arena}
+    , /*decltype(_impl_._fctsizebins_cached_byte_size_)*/{0}
+    , decltype(_impl_.outputdir_){}
+    , decltype(_impl_.stoptime_){}
+    , decltype(_impl_.linerate_){}
+    , decltype(_impl_.basertt_){}
+    , decltype(_impl_.base_){nullptr}
+    , decltype(_impl_.runs_){0u}
   };
+  _impl_.outputdir_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.outputdir_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.stoptime_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stoptime_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.linerate_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.linerate_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.basertt_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.basertt_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-Configurations::~Configurations() {
-  // @@protoc_insertion_point(destructor:ns3_proto.Configurations)
+Sweep::~Sweep() {
+  // @@protoc_insertion_point(destructor:ns3_proto.Sweep)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3473,67 +5167,133 @@ Configurations::~Configurations() {
   SharedDtor();
 }
 
-inline void Configurations::SharedDtor() {
+inline void Sweep::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.applications_.~RepeatedPtrField();
-  if (this != internal_default_instance()) delete _impl_.globalconfig_;
-  if (this != internal_default_instance()) delete _impl_.topology_;
+  _impl_.parameters_.~RepeatedPtrField();
+  _impl_.fctsizebins_.~RepeatedField();
+  _impl_.outputdir_.Destroy();
+  _impl_.stoptime_.Destroy();
+  _impl_.linerate_.Destroy();
+  _impl_.basertt_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.base_;
 }
 
-void Configurations::SetCachedSize(int size) const {
+void Sweep::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void Configurations::Clear() {
-// @@protoc_insertion_point(message_clear_start:ns3_proto.Configurations)
+void Sweep::Clear() {
+// @@protoc_insertion_point(message_clear_start:ns3_proto.Sweep)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.applications_.Clear();
-  if (GetArenaForAllocation() == nullptr && _impl_.globalconfig_ != nullptr) {
-    delete _impl_.globalconfig_;
+  _impl_.parameters_.Clear();
+  _impl_.fctsizebins_.Clear();
+  _impl_.outputdir_.ClearToEmpty();
+  _impl_.stoptime_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.linerate_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.basertt_.ClearNonDefaultToEmpty();
+    }
   }
-  _impl_.globalconfig_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && _impl_.topology_ != nullptr) {
-    delete _impl_.topology_;
+  if (GetArenaForAllocation() == nullptr && _impl_.base_ != nullptr) {
+    delete _impl_.base_;
   }
-  _impl_.topology_ = nullptr;
+  _impl_.base_ = nullptr;
+  _impl_.runs_ = 0u;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Configurations::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* Sweep::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .ns3_proto.GlobalConfig globalConfig = 1;
+      // .ns3_proto.Configurations base = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_globalconfig(), ptr);
+          ptr = ctx->ParseMessage(_internal_mutable_base(), ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // .ns3_proto.Topology topology = 2;
+      // repeated .ns3_proto.SweepParameter parameters = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_topology(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // repeated .ns3_proto.Application applications = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_applications(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_parameters(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 runs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.runs_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string outputDir = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_outputdir();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Sweep.outputDir"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string stopTime = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_stoptime();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Sweep.stopTime"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string lineRate = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_linerate();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Sweep.lineRate"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string baseRtt = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_basertt();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ns3_proto.Sweep.baseRtt"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 fctSizeBins = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_fctsizebins(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 64) {
+          _internal_add_fctsizebins(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -3553,6 +5313,7 @@ const char* Configurations::_InternalParse(const char* ptr, ::_pbi::ParseContext
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -3560,128 +5321,254 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Configurations::_InternalSerialize(
+uint8_t* Sweep::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.Configurations)
+  // @@protoc_insertion_point(serialize_to_array_start:ns3_proto.Sweep)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .ns3_proto.GlobalConfig globalConfig = 1;
-  if (this->_internal_has_globalconfig()) {
+  // .ns3_proto.Configurations base = 1;
+  if (this->_internal_has_base()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::globalconfig(this),
-        _Internal::globalconfig(this).GetCachedSize(), target, stream);
+      InternalWriteMessage(1, _Internal::base(this),
+        _Internal::base(this).GetCachedSize(), target, stream);
   }
 
-  // .ns3_proto.Topology topology = 2;
-  if (this->_internal_has_topology()) {
+  // repeated .ns3_proto.SweepParameter parameters = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_parameters_size()); i < n; i++) {
+    const auto& repfield = this->_internal_parameters(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::topology(this),
-        _Internal::topology(this).GetCachedSize(), target, stream);
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // repeated .ns3_proto.Application applications = 3;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_applications_size()); i < n; i++) {
-    const auto& repfield = this->_internal_applications(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  // uint32 runs = 3;
+  if (this->_internal_runs() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_runs(), target);
+  }
+
+  // string outputDir = 4;
+  if (!this->_internal_outputdir().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_outputdir().data(), static_cast<int>(this->_internal_outputdir().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.Sweep.outputDir");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_outputdir(), target);
+  }
+
+  // string stopTime = 5;
+  if (!this->_internal_stoptime().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_stoptime().data(), static_cast<int>(this->_internal_stoptime().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.Sweep.stopTime");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_stoptime(), target);
+  }
+
+  // optional string lineRate = 6;
+  if (_internal_has_linerate()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_linerate().data(), static_cast<int>(this->_internal_linerate().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.Sweep.lineRate");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_linerate(), target);
+  }
+
+  // optional string baseRtt = 7;
+  if (_internal_has_basertt()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_basertt().data(), static_cast<int>(this->_internal_basertt().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ns3_proto.Sweep.baseRtt");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_basertt(), target);
+  }
+
+  // repeated uint64 fctSizeBins = 8;
+  {
+    int byte_size = _impl_._fctsizebins_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          8, _internal_fctsizebins(), byte_size, target);
+    }
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.Configurations)
+  // @@protoc_insertion_point(serialize_to_array_end:ns3_proto.Sweep)
   return target;
 }
 
-size_t Configurations::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ns3_proto.Configurations)
+size_t Sweep::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ns3_proto.Sweep)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .ns3_proto.Application applications = 3;
-  total_size += 1UL * this->_internal_applications_size();
-  for (const auto& msg : this->_impl_.applications_) {
+  // repeated .ns3_proto.SweepParameter parameters = 2;
+  total_size += 1UL * this->_internal_parameters_size();
+  for (const auto& msg : this->_impl_.parameters_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // .ns3_proto.GlobalConfig globalConfig = 1;
-  if (this->_internal_has_globalconfig()) {
+  // repeated uint64 fctSizeBins = 8;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.fctsizebins_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._fctsizebins_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string outputDir = 4;
+  if (!this->_internal_outputdir().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.globalconfig_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_outputdir());
   }
 
-  // .ns3_proto.Topology topology = 2;
-  if (this->_internal_has_topology()) {
+  // string stopTime = 5;
+  if (!this->_internal_stoptime().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_stoptime());
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string lineRate = 6;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_linerate());
+    }
+
+    // optional string baseRtt = 7;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_basertt());
+    }
+
+  }
+  // .ns3_proto.Configurations base = 1;
+  if (this->_internal_has_base()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.topology_);
+        *_impl_.base_);
+  }
+
+  // uint32 runs = 3;
+  if (this->_internal_runs() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_runs());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Configurations::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Sweep::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    Configurations::MergeImpl
+    Sweep::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Configurations::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Sweep::GetClassData() const { return &_class_data_; }
 
 
-void Configurations::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<Configurations*>(&to_msg);
-  auto& from = static_cast<const Configurations&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.Configurations)
+void Sweep::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Sweep*>(&to_msg);
+  auto& from = static_cast<const Sweep&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ns3_proto.Sweep)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.applications_.MergeFrom(from._impl_.applications_);
-  if (from._internal_has_globalconfig()) {
-    _this->_internal_mutable_globalconfig()->::ns3_proto::GlobalConfig::MergeFrom(
-        from._internal_globalconfig());
+  _this->_impl_.parameters_.MergeFrom(from._impl_.parameters_);
+  _this->_impl_.fctsizebins_.MergeFrom(from._impl_.fctsizebins_);
+  if (!from._internal_outputdir().empty()) {
+    _this->_internal_set_outputdir(from._internal_outputdir());
   }
-  if (from._internal_has_topology()) {
-    _this->_internal_mutable_topology()->::ns3_proto::Topology::MergeFrom(
-        from._internal_topology());
+  if (!from._internal_stoptime().empty()) {
+    _this->_internal_set_stoptime(from._internal_stoptime());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_linerate(from._internal_linerate());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_basertt(from._internal_basertt());
+    }
+  }
+  if (from._internal_has_base()) {
+    _this->_internal_mutable_base()->::ns3_proto::Configurations::MergeFrom(
+        from._internal_base());
+  }
+  if (from._internal_runs() != 0) {
+    _this->_internal_set_runs(from._internal_runs());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Configurations::CopyFrom(const Configurations& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.Configurations)
+void Sweep::CopyFrom(const Sweep& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ns3_proto.Sweep)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Configurations::IsInitialized() const {
+bool Sweep::IsInitialized() const {
   return true;
 }
 
-void Configurations::InternalSwap(Configurations* other) {
+void Sweep::InternalSwap(Sweep* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.applications_.InternalSwap(&other->_impl_.applications_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.parameters_.InternalSwap(&other->_impl_.parameters_);
+  _impl_.fctsizebins_.InternalSwap(&other->_impl_.fctsizebins_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.outputdir_, lhs_arena,
+      &other->_impl_.outputdir_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.stoptime_, lhs_arena,
+      &other->_impl_.stoptime_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.linerate_, lhs_arena,
+      &other->_impl_.linerate_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.basertt_, lhs_arena,
+      &other->_impl_.basertt_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Configurations, _impl_.topology_)
-      + sizeof(Configurations::_impl_.topology_)
-      - PROTOBUF_FIELD_OFFSET(Configurations, _impl_.globalconfig_)>(
-          reinterpret_cast<char*>(&_impl_.globalconfig_),
-          reinterpret_cast<char*>(&other->_impl_.globalconfig_));
+      PROTOBUF_FIELD_OFFSET(Sweep, _impl_.runs_)
+      + sizeof(Sweep::_impl_.runs_)
+      - PROTOBUF_FIELD_OFFSET(Sweep, _impl_.base_)>(
+          reinterpret_cast<char*>(&_impl_.base_),
+          reinterpret_cast<char*>(&other->_impl_.base_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Configurations::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata Sweep::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_configurations_2eproto_getter, &descriptor_table_configurations_2eproto_once,
-      file_level_metadata_configurations_2eproto[10]);
+      file_level_metadata_configurations_2eproto[14]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -3707,6 +5594,14 @@ template<> PROTOBUF_NOINLINE ::ns3_proto::SwitchPortConfig*
 Arena::CreateMaybeMessage< ::ns3_proto::SwitchPortConfig >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ns3_proto::SwitchPortConfig >(arena);
 }
+template<> PROTOBUF_NOINLINE ::ns3_proto::SharedBufferConfig*
+Arena::CreateMaybeMessage< ::ns3_proto::SharedBufferConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ns3_proto::SharedBufferConfig >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ns3_proto::LoadBalanceConfig*
+Arena::CreateMaybeMessage< ::ns3_proto::LoadBalanceConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ns3_proto::LoadBalanceConfig >(arena);
+}
 template<> PROTOBUF_NOINLINE ::ns3_proto::SwitchGroup*
 Arena::CreateMaybeMessage< ::ns3_proto::SwitchGroup >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ns3_proto::SwitchGroup >(arena);
@@ -3731,6 +5626,14 @@ template<> PROTOBUF_NOINLINE ::ns3_proto::Configurations*
 Arena::CreateMaybeMessage< ::ns3_proto::Configurations >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ns3_proto::Configurations >(arena);
 }
+template<> PROTOBUF_NOINLINE ::ns3_proto::SweepParameter*
+Arena::CreateMaybeMessage< ::ns3_proto::SweepParameter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ns3_proto::SweepParameter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ns3_proto::Sweep*
+Arena::CreateMaybeMessage< ::ns3_proto::Sweep >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ns3_proto::Sweep >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
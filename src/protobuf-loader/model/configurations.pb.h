@@ -13,7 +13,7 @@
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3021001 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -29,6 +29,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -66,9 +67,21 @@ extern HostPortConfigDefaultTypeInternal _HostPortConfig_default_instance_;
 class Link;
 struct LinkDefaultTypeInternal;
 extern LinkDefaultTypeInternal _Link_default_instance_;
+class LoadBalanceConfig;
+struct LoadBalanceConfigDefaultTypeInternal;
+extern LoadBalanceConfigDefaultTypeInternal _LoadBalanceConfig_default_instance_;
 class PortQueueConfig;
 struct PortQueueConfigDefaultTypeInternal;
 extern PortQueueConfigDefaultTypeInternal _PortQueueConfig_default_instance_;
+class SharedBufferConfig;
+struct SharedBufferConfigDefaultTypeInternal;
+extern SharedBufferConfigDefaultTypeInternal _SharedBufferConfig_default_instance_;
+class Sweep;
+struct SweepDefaultTypeInternal;
+extern SweepDefaultTypeInternal _Sweep_default_instance_;
+class SweepParameter;
+struct SweepParameterDefaultTypeInternal;
+extern SweepParameterDefaultTypeInternal _SweepParameter_default_instance_;
 class SwitchGroup;
 struct SwitchGroupDefaultTypeInternal;
 extern SwitchGroupDefaultTypeInternal _SwitchGroup_default_instance_;
@@ -87,13 +100,44 @@ template<> ::ns3_proto::GlobalConfig* Arena::CreateMaybeMessage<::ns3_proto::Glo
 template<> ::ns3_proto::HostGroup* Arena::CreateMaybeMessage<::ns3_proto::HostGroup>(Arena*);
 template<> ::ns3_proto::HostPortConfig* Arena::CreateMaybeMessage<::ns3_proto::HostPortConfig>(Arena*);
 template<> ::ns3_proto::Link* Arena::CreateMaybeMessage<::ns3_proto::Link>(Arena*);
+template<> ::ns3_proto::LoadBalanceConfig* Arena::CreateMaybeMessage<::ns3_proto::LoadBalanceConfig>(Arena*);
 template<> ::ns3_proto::PortQueueConfig* Arena::CreateMaybeMessage<::ns3_proto::PortQueueConfig>(Arena*);
+template<> ::ns3_proto::SharedBufferConfig* Arena::CreateMaybeMessage<::ns3_proto::SharedBufferConfig>(Arena*);
+template<> ::ns3_proto::Sweep* Arena::CreateMaybeMessage<::ns3_proto::Sweep>(Arena*);
+template<> ::ns3_proto::SweepParameter* Arena::CreateMaybeMessage<::ns3_proto::SweepParameter>(Arena*);
 template<> ::ns3_proto::SwitchGroup* Arena::CreateMaybeMessage<::ns3_proto::SwitchGroup>(Arena*);
 template<> ::ns3_proto::SwitchPortConfig* Arena::CreateMaybeMessage<::ns3_proto::SwitchPortConfig>(Arena*);
 template<> ::ns3_proto::Topology* Arena::CreateMaybeMessage<::ns3_proto::Topology>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace ns3_proto {
 
+enum LoadBalanceConfig_Mode : int {
+  LoadBalanceConfig_Mode_ECMP = 0,
+  LoadBalanceConfig_Mode_PACKET_SPRAY = 1,
+  LoadBalanceConfig_Mode_FLOWLET = 2,
+  LoadBalanceConfig_Mode_CONGESTION_AWARE = 3,
+  LoadBalanceConfig_Mode_LoadBalanceConfig_Mode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  LoadBalanceConfig_Mode_LoadBalanceConfig_Mode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool LoadBalanceConfig_Mode_IsValid(int value);
+constexpr LoadBalanceConfig_Mode LoadBalanceConfig_Mode_Mode_MIN = LoadBalanceConfig_Mode_ECMP;
+constexpr LoadBalanceConfig_Mode LoadBalanceConfig_Mode_Mode_MAX = LoadBalanceConfig_Mode_CONGESTION_AWARE;
+constexpr int LoadBalanceConfig_Mode_Mode_ARRAYSIZE = LoadBalanceConfig_Mode_Mode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LoadBalanceConfig_Mode_descriptor();
+template<typename T>
+inline const std::string& LoadBalanceConfig_Mode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, LoadBalanceConfig_Mode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function LoadBalanceConfig_Mode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    LoadBalanceConfig_Mode_descriptor(), enum_t_value);
+}
+inline bool LoadBalanceConfig_Mode_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, LoadBalanceConfig_Mode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<LoadBalanceConfig_Mode>(
+    LoadBalanceConfig_Mode_descriptor(), name, value);
+}
 // ===================================================================
 
 class GlobalConfig final :
@@ -218,6 +262,7 @@ class GlobalConfig final :
 
   enum : int {
     kOutputFctFieldNumber = 1,
+    kBinaryTraceFieldNumber = 2,
   };
   // optional string outputFct = 1;
   bool has_outputfct() const;
@@ -237,6 +282,24 @@ class GlobalConfig final :
   std::string* _internal_mutable_outputfct();
   public:
 
+  // optional string binaryTrace = 2;
+  bool has_binarytrace() const;
+  private:
+  bool _internal_has_binarytrace() const;
+  public:
+  void clear_binarytrace();
+  const std::string& binarytrace() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_binarytrace(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_binarytrace();
+  PROTOBUF_NODISCARD std::string* release_binarytrace();
+  void set_allocated_binarytrace(std::string* binarytrace);
+  private:
+  const std::string& _internal_binarytrace() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_binarytrace(const std::string& value);
+  std::string* _internal_mutable_binarytrace();
+  public:
+
   // @@protoc_insertion_point(class_scope:ns3_proto.GlobalConfig)
  private:
   class _Internal;
@@ -248,6 +311,7 @@ class GlobalConfig final :
     ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr outputfct_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr binarytrace_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_configurations_2eproto;
@@ -707,6 +771,7 @@ class PortQueueConfig final :
     kEcnKMinFieldNumber = 4,
     kEcnKMaxFieldNumber = 5,
     kEcnPMaxFieldNumber = 6,
+    kEtsWeightFieldNumber = 7,
   };
   // optional string pfcReserve = 1;
   bool has_pfcreserve() const;
@@ -793,6 +858,19 @@ class PortQueueConfig final :
   void _internal_set_ecnpmax(double value);
   public:
 
+  // optional uint32 etsWeight = 7;
+  bool has_etsweight() const;
+  private:
+  bool _internal_has_etsweight() const;
+  public:
+  void clear_etsweight();
+  uint32_t etsweight() const;
+  void set_etsweight(uint32_t value);
+  private:
+  uint32_t _internal_etsweight() const;
+  void _internal_set_etsweight(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:ns3_proto.PortQueueConfig)
  private:
   class _Internal;
@@ -808,6 +886,7 @@ class PortQueueConfig final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ecnkmin_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ecnkmax_;
     double ecnpmax_;
+    uint32_t etsweight_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_configurations_2eproto;
@@ -993,24 +1072,24 @@ class SwitchPortConfig final :
 };
 // -------------------------------------------------------------------
 
-class SwitchGroup final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.SwitchGroup) */ {
+class SharedBufferConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.SharedBufferConfig) */ {
  public:
-  inline SwitchGroup() : SwitchGroup(nullptr) {}
-  ~SwitchGroup() override;
-  explicit PROTOBUF_CONSTEXPR SwitchGroup(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SharedBufferConfig() : SharedBufferConfig(nullptr) {}
+  ~SharedBufferConfig() override;
+  explicit PROTOBUF_CONSTEXPR SharedBufferConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SwitchGroup(const SwitchGroup& from);
-  SwitchGroup(SwitchGroup&& from) noexcept
-    : SwitchGroup() {
+  SharedBufferConfig(const SharedBufferConfig& from);
+  SharedBufferConfig(SharedBufferConfig&& from) noexcept
+    : SharedBufferConfig() {
     *this = ::std::move(from);
   }
 
-  inline SwitchGroup& operator=(const SwitchGroup& from) {
+  inline SharedBufferConfig& operator=(const SharedBufferConfig& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SwitchGroup& operator=(SwitchGroup&& from) noexcept {
+  inline SharedBufferConfig& operator=(SharedBufferConfig&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1033,20 +1112,20 @@ class SwitchGroup final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SwitchGroup& default_instance() {
+  static const SharedBufferConfig& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SwitchGroup* internal_default_instance() {
-    return reinterpret_cast<const SwitchGroup*>(
-               &_SwitchGroup_default_instance_);
+  static inline const SharedBufferConfig* internal_default_instance() {
+    return reinterpret_cast<const SharedBufferConfig*>(
+               &_SharedBufferConfig_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     5;
 
-  friend void swap(SwitchGroup& a, SwitchGroup& b) {
+  friend void swap(SharedBufferConfig& a, SharedBufferConfig& b) {
     a.Swap(&b);
   }
-  inline void Swap(SwitchGroup* other) {
+  inline void Swap(SharedBufferConfig* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1059,7 +1138,7 @@ class SwitchGroup final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SwitchGroup* other) {
+  void UnsafeArenaSwap(SharedBufferConfig* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1067,14 +1146,14 @@ class SwitchGroup final :
 
   // implements Message ----------------------------------------------
 
-  SwitchGroup* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SwitchGroup>(arena);
+  SharedBufferConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SharedBufferConfig>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SwitchGroup& from);
+  void CopyFrom(const SharedBufferConfig& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SwitchGroup& from) {
-    SwitchGroup::MergeImpl(*this, from);
+  void MergeFrom( const SharedBufferConfig& from) {
+    SharedBufferConfig::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1092,15 +1171,15 @@ class SwitchGroup final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SwitchGroup* other);
+  void InternalSwap(SharedBufferConfig* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "ns3_proto.SwitchGroup";
+    return "ns3_proto.SharedBufferConfig";
   }
   protected:
-  explicit SwitchGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SharedBufferConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1114,72 +1193,77 @@ class SwitchGroup final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPortsFieldNumber = 5,
-    kBufferSizeFieldNumber = 3,
-    kNodesNumFieldNumber = 1,
-    kBaseIndexFieldNumber = 2,
-    kQueueNumFieldNumber = 4,
+    kReserveFieldNumber = 1,
+    kHeadroomFieldNumber = 2,
+    kXonOffsetFieldNumber = 4,
+    kPfcAlphaFieldNumber = 3,
+    kEcnAlphaFieldNumber = 5,
   };
-  // repeated .ns3_proto.SwitchPortConfig ports = 5;
-  int ports_size() const;
+  // string reserve = 1;
+  void clear_reserve();
+  const std::string& reserve() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reserve(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reserve();
+  PROTOBUF_NODISCARD std::string* release_reserve();
+  void set_allocated_reserve(std::string* reserve);
   private:
-  int _internal_ports_size() const;
+  const std::string& _internal_reserve() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reserve(const std::string& value);
+  std::string* _internal_mutable_reserve();
   public:
-  void clear_ports();
-  ::ns3_proto::SwitchPortConfig* mutable_ports(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SwitchPortConfig >*
-      mutable_ports();
+
+  // string headroom = 2;
+  void clear_headroom();
+  const std::string& headroom() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_headroom(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_headroom();
+  PROTOBUF_NODISCARD std::string* release_headroom();
+  void set_allocated_headroom(std::string* headroom);
   private:
-  const ::ns3_proto::SwitchPortConfig& _internal_ports(int index) const;
-  ::ns3_proto::SwitchPortConfig* _internal_add_ports();
+  const std::string& _internal_headroom() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_headroom(const std::string& value);
+  std::string* _internal_mutable_headroom();
   public:
-  const ::ns3_proto::SwitchPortConfig& ports(int index) const;
-  ::ns3_proto::SwitchPortConfig* add_ports();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SwitchPortConfig >&
-      ports() const;
 
-  // string bufferSize = 3;
-  void clear_buffersize();
-  const std::string& buffersize() const;
+  // string xonOffset = 4;
+  void clear_xonoffset();
+  const std::string& xonoffset() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_buffersize(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_buffersize();
-  PROTOBUF_NODISCARD std::string* release_buffersize();
-  void set_allocated_buffersize(std::string* buffersize);
+  void set_xonoffset(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_xonoffset();
+  PROTOBUF_NODISCARD std::string* release_xonoffset();
+  void set_allocated_xonoffset(std::string* xonoffset);
   private:
-  const std::string& _internal_buffersize() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_buffersize(const std::string& value);
-  std::string* _internal_mutable_buffersize();
+  const std::string& _internal_xonoffset() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_xonoffset(const std::string& value);
+  std::string* _internal_mutable_xonoffset();
   public:
 
-  // uint32 nodesNum = 1;
-  void clear_nodesnum();
-  uint32_t nodesnum() const;
-  void set_nodesnum(uint32_t value);
+  // double pfcAlpha = 3;
+  void clear_pfcalpha();
+  double pfcalpha() const;
+  void set_pfcalpha(double value);
   private:
-  uint32_t _internal_nodesnum() const;
-  void _internal_set_nodesnum(uint32_t value);
+  double _internal_pfcalpha() const;
+  void _internal_set_pfcalpha(double value);
   public:
 
-  // uint32 baseIndex = 2;
-  void clear_baseindex();
-  uint32_t baseindex() const;
-  void set_baseindex(uint32_t value);
+  // optional double ecnAlpha = 5;
+  bool has_ecnalpha() const;
   private:
-  uint32_t _internal_baseindex() const;
-  void _internal_set_baseindex(uint32_t value);
+  bool _internal_has_ecnalpha() const;
   public:
-
-  // uint32 queueNum = 4;
-  void clear_queuenum();
-  uint32_t queuenum() const;
-  void set_queuenum(uint32_t value);
+  void clear_ecnalpha();
+  double ecnalpha() const;
+  void set_ecnalpha(double value);
   private:
-  uint32_t _internal_queuenum() const;
-  void _internal_set_queuenum(uint32_t value);
+  double _internal_ecnalpha() const;
+  void _internal_set_ecnalpha(double value);
   public:
 
-  // @@protoc_insertion_point(class_scope:ns3_proto.SwitchGroup)
+  // @@protoc_insertion_point(class_scope:ns3_proto.SharedBufferConfig)
  private:
   class _Internal;
 
@@ -1187,36 +1271,37 @@ class SwitchGroup final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SwitchPortConfig > ports_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr buffersize_;
-    uint32_t nodesnum_;
-    uint32_t baseindex_;
-    uint32_t queuenum_;
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reserve_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr headroom_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr xonoffset_;
+    double pfcalpha_;
+    double ecnalpha_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_configurations_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AllNodes final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.AllNodes) */ {
+class LoadBalanceConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.LoadBalanceConfig) */ {
  public:
-  inline AllNodes() : AllNodes(nullptr) {}
-  ~AllNodes() override;
-  explicit PROTOBUF_CONSTEXPR AllNodes(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline LoadBalanceConfig() : LoadBalanceConfig(nullptr) {}
+  ~LoadBalanceConfig() override;
+  explicit PROTOBUF_CONSTEXPR LoadBalanceConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AllNodes(const AllNodes& from);
-  AllNodes(AllNodes&& from) noexcept
-    : AllNodes() {
+  LoadBalanceConfig(const LoadBalanceConfig& from);
+  LoadBalanceConfig(LoadBalanceConfig&& from) noexcept
+    : LoadBalanceConfig() {
     *this = ::std::move(from);
   }
 
-  inline AllNodes& operator=(const AllNodes& from) {
+  inline LoadBalanceConfig& operator=(const LoadBalanceConfig& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AllNodes& operator=(AllNodes&& from) noexcept {
+  inline LoadBalanceConfig& operator=(LoadBalanceConfig&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1239,20 +1324,20 @@ class AllNodes final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const AllNodes& default_instance() {
+  static const LoadBalanceConfig& default_instance() {
     return *internal_default_instance();
   }
-  static inline const AllNodes* internal_default_instance() {
-    return reinterpret_cast<const AllNodes*>(
-               &_AllNodes_default_instance_);
+  static inline const LoadBalanceConfig* internal_default_instance() {
+    return reinterpret_cast<const LoadBalanceConfig*>(
+               &_LoadBalanceConfig_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     6;
 
-  friend void swap(AllNodes& a, AllNodes& b) {
+  friend void swap(LoadBalanceConfig& a, LoadBalanceConfig& b) {
     a.Swap(&b);
   }
-  inline void Swap(AllNodes* other) {
+  inline void Swap(LoadBalanceConfig* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1265,7 +1350,7 @@ class AllNodes final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AllNodes* other) {
+  void UnsafeArenaSwap(LoadBalanceConfig* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1273,14 +1358,14 @@ class AllNodes final :
 
   // implements Message ----------------------------------------------
 
-  AllNodes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<AllNodes>(arena);
+  LoadBalanceConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LoadBalanceConfig>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const AllNodes& from);
+  void CopyFrom(const LoadBalanceConfig& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const AllNodes& from) {
-    AllNodes::MergeImpl(*this, from);
+  void MergeFrom( const LoadBalanceConfig& from) {
+    LoadBalanceConfig::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1298,15 +1383,15 @@ class AllNodes final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(AllNodes* other);
+  void InternalSwap(LoadBalanceConfig* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "ns3_proto.AllNodes";
+    return "ns3_proto.LoadBalanceConfig";
   }
   protected:
-  explicit AllNodes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit LoadBalanceConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1317,59 +1402,70 @@ class AllNodes final :
 
   // nested types ----------------------------------------------------
 
+  typedef LoadBalanceConfig_Mode Mode;
+  static constexpr Mode ECMP =
+    LoadBalanceConfig_Mode_ECMP;
+  static constexpr Mode PACKET_SPRAY =
+    LoadBalanceConfig_Mode_PACKET_SPRAY;
+  static constexpr Mode FLOWLET =
+    LoadBalanceConfig_Mode_FLOWLET;
+  static constexpr Mode CONGESTION_AWARE =
+    LoadBalanceConfig_Mode_CONGESTION_AWARE;
+  static inline bool Mode_IsValid(int value) {
+    return LoadBalanceConfig_Mode_IsValid(value);
+  }
+  static constexpr Mode Mode_MIN =
+    LoadBalanceConfig_Mode_Mode_MIN;
+  static constexpr Mode Mode_MAX =
+    LoadBalanceConfig_Mode_Mode_MAX;
+  static constexpr int Mode_ARRAYSIZE =
+    LoadBalanceConfig_Mode_Mode_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Mode_descriptor() {
+    return LoadBalanceConfig_Mode_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Mode_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Mode>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Mode_Name.");
+    return LoadBalanceConfig_Mode_Name(enum_t_value);
+  }
+  static inline bool Mode_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Mode* value) {
+    return LoadBalanceConfig_Mode_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kHostGroupsFieldNumber = 2,
-    kSwitchGroupsFieldNumber = 3,
-    kNumFieldNumber = 1,
+    kFlowletGapFieldNumber = 2,
+    kModeFieldNumber = 1,
   };
-  // repeated .ns3_proto.HostGroup hostGroups = 2;
-  int hostgroups_size() const;
-  private:
-  int _internal_hostgroups_size() const;
-  public:
-  void clear_hostgroups();
-  ::ns3_proto::HostGroup* mutable_hostgroups(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::HostGroup >*
-      mutable_hostgroups();
-  private:
-  const ::ns3_proto::HostGroup& _internal_hostgroups(int index) const;
-  ::ns3_proto::HostGroup* _internal_add_hostgroups();
-  public:
-  const ::ns3_proto::HostGroup& hostgroups(int index) const;
-  ::ns3_proto::HostGroup* add_hostgroups();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::HostGroup >&
-      hostgroups() const;
-
-  // repeated .ns3_proto.SwitchGroup switchGroups = 3;
-  int switchgroups_size() const;
-  private:
-  int _internal_switchgroups_size() const;
-  public:
-  void clear_switchgroups();
-  ::ns3_proto::SwitchGroup* mutable_switchgroups(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SwitchGroup >*
-      mutable_switchgroups();
+  // string flowletGap = 2;
+  void clear_flowletgap();
+  const std::string& flowletgap() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_flowletgap(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_flowletgap();
+  PROTOBUF_NODISCARD std::string* release_flowletgap();
+  void set_allocated_flowletgap(std::string* flowletgap);
   private:
-  const ::ns3_proto::SwitchGroup& _internal_switchgroups(int index) const;
-  ::ns3_proto::SwitchGroup* _internal_add_switchgroups();
+  const std::string& _internal_flowletgap() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_flowletgap(const std::string& value);
+  std::string* _internal_mutable_flowletgap();
   public:
-  const ::ns3_proto::SwitchGroup& switchgroups(int index) const;
-  ::ns3_proto::SwitchGroup* add_switchgroups();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SwitchGroup >&
-      switchgroups() const;
 
-  // uint32 num = 1;
-  void clear_num();
-  uint32_t num() const;
-  void set_num(uint32_t value);
+  // .ns3_proto.LoadBalanceConfig.Mode mode = 1;
+  void clear_mode();
+  ::ns3_proto::LoadBalanceConfig_Mode mode() const;
+  void set_mode(::ns3_proto::LoadBalanceConfig_Mode value);
   private:
-  uint32_t _internal_num() const;
-  void _internal_set_num(uint32_t value);
+  ::ns3_proto::LoadBalanceConfig_Mode _internal_mode() const;
+  void _internal_set_mode(::ns3_proto::LoadBalanceConfig_Mode value);
   public:
 
-  // @@protoc_insertion_point(class_scope:ns3_proto.AllNodes)
+  // @@protoc_insertion_point(class_scope:ns3_proto.LoadBalanceConfig)
  private:
   class _Internal;
 
@@ -1377,9 +1473,8 @@ class AllNodes final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::HostGroup > hostgroups_;
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SwitchGroup > switchgroups_;
-    uint32_t num_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr flowletgap_;
+    int mode_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1387,24 +1482,24 @@ class AllNodes final :
 };
 // -------------------------------------------------------------------
 
-class Link final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.Link) */ {
+class SwitchGroup final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.SwitchGroup) */ {
  public:
-  inline Link() : Link(nullptr) {}
-  ~Link() override;
-  explicit PROTOBUF_CONSTEXPR Link(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SwitchGroup() : SwitchGroup(nullptr) {}
+  ~SwitchGroup() override;
+  explicit PROTOBUF_CONSTEXPR SwitchGroup(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Link(const Link& from);
-  Link(Link&& from) noexcept
-    : Link() {
+  SwitchGroup(const SwitchGroup& from);
+  SwitchGroup(SwitchGroup&& from) noexcept
+    : SwitchGroup() {
     *this = ::std::move(from);
   }
 
-  inline Link& operator=(const Link& from) {
+  inline SwitchGroup& operator=(const SwitchGroup& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Link& operator=(Link&& from) noexcept {
+  inline SwitchGroup& operator=(SwitchGroup&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1427,20 +1522,20 @@ class Link final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Link& default_instance() {
+  static const SwitchGroup& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Link* internal_default_instance() {
-    return reinterpret_cast<const Link*>(
-               &_Link_default_instance_);
+  static inline const SwitchGroup* internal_default_instance() {
+    return reinterpret_cast<const SwitchGroup*>(
+               &_SwitchGroup_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     7;
 
-  friend void swap(Link& a, Link& b) {
+  friend void swap(SwitchGroup& a, SwitchGroup& b) {
     a.Swap(&b);
   }
-  inline void Swap(Link* other) {
+  inline void Swap(SwitchGroup* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1453,7 +1548,7 @@ class Link final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Link* other) {
+  void UnsafeArenaSwap(SwitchGroup* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1461,14 +1556,14 @@ class Link final :
 
   // implements Message ----------------------------------------------
 
-  Link* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Link>(arena);
+  SwitchGroup* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SwitchGroup>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Link& from);
+  void CopyFrom(const SwitchGroup& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Link& from) {
-    Link::MergeImpl(*this, from);
+  void MergeFrom( const SwitchGroup& from) {
+    SwitchGroup::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1486,15 +1581,15 @@ class Link final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Link* other);
+  void InternalSwap(SwitchGroup* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "ns3_proto.Link";
+    return "ns3_proto.SwitchGroup";
   }
   protected:
-  explicit Link(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SwitchGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1508,78 +1603,120 @@ class Link final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kRateFieldNumber = 5,
-    kDelayFieldNumber = 6,
-    kNode1FieldNumber = 1,
-    kNode2FieldNumber = 2,
-    kPort1FieldNumber = 3,
-    kPort2FieldNumber = 4,
+    kPortsFieldNumber = 5,
+    kBufferSizeFieldNumber = 3,
+    kSharedBufferFieldNumber = 6,
+    kLoadBalanceFieldNumber = 7,
+    kNodesNumFieldNumber = 1,
+    kBaseIndexFieldNumber = 2,
+    kQueueNumFieldNumber = 4,
+    kIntEnabledFieldNumber = 8,
   };
-  // string rate = 5;
-  void clear_rate();
-  const std::string& rate() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_rate(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_rate();
-  PROTOBUF_NODISCARD std::string* release_rate();
-  void set_allocated_rate(std::string* rate);
+  // repeated .ns3_proto.SwitchPortConfig ports = 5;
+  int ports_size() const;
   private:
-  const std::string& _internal_rate() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rate(const std::string& value);
-  std::string* _internal_mutable_rate();
+  int _internal_ports_size() const;
+  public:
+  void clear_ports();
+  ::ns3_proto::SwitchPortConfig* mutable_ports(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SwitchPortConfig >*
+      mutable_ports();
+  private:
+  const ::ns3_proto::SwitchPortConfig& _internal_ports(int index) const;
+  ::ns3_proto::SwitchPortConfig* _internal_add_ports();
   public:
+  const ::ns3_proto::SwitchPortConfig& ports(int index) const;
+  ::ns3_proto::SwitchPortConfig* add_ports();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SwitchPortConfig >&
+      ports() const;
 
-  // string delay = 6;
-  void clear_delay();
-  const std::string& delay() const;
+  // string bufferSize = 3;
+  void clear_buffersize();
+  const std::string& buffersize() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_delay(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_delay();
-  PROTOBUF_NODISCARD std::string* release_delay();
-  void set_allocated_delay(std::string* delay);
+  void set_buffersize(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_buffersize();
+  PROTOBUF_NODISCARD std::string* release_buffersize();
+  void set_allocated_buffersize(std::string* buffersize);
   private:
-  const std::string& _internal_delay() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_delay(const std::string& value);
-  std::string* _internal_mutable_delay();
+  const std::string& _internal_buffersize() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_buffersize(const std::string& value);
+  std::string* _internal_mutable_buffersize();
   public:
 
-  // uint32 node1 = 1;
-  void clear_node1();
-  uint32_t node1() const;
-  void set_node1(uint32_t value);
+  // .ns3_proto.SharedBufferConfig sharedBuffer = 6;
+  bool has_sharedbuffer() const;
   private:
-  uint32_t _internal_node1() const;
-  void _internal_set_node1(uint32_t value);
+  bool _internal_has_sharedbuffer() const;
+  public:
+  void clear_sharedbuffer();
+  const ::ns3_proto::SharedBufferConfig& sharedbuffer() const;
+  PROTOBUF_NODISCARD ::ns3_proto::SharedBufferConfig* release_sharedbuffer();
+  ::ns3_proto::SharedBufferConfig* mutable_sharedbuffer();
+  void set_allocated_sharedbuffer(::ns3_proto::SharedBufferConfig* sharedbuffer);
+  private:
+  const ::ns3_proto::SharedBufferConfig& _internal_sharedbuffer() const;
+  ::ns3_proto::SharedBufferConfig* _internal_mutable_sharedbuffer();
   public:
+  void unsafe_arena_set_allocated_sharedbuffer(
+      ::ns3_proto::SharedBufferConfig* sharedbuffer);
+  ::ns3_proto::SharedBufferConfig* unsafe_arena_release_sharedbuffer();
 
-  // uint32 node2 = 2;
-  void clear_node2();
-  uint32_t node2() const;
-  void set_node2(uint32_t value);
+  // .ns3_proto.LoadBalanceConfig loadBalance = 7;
+  bool has_loadbalance() const;
   private:
-  uint32_t _internal_node2() const;
-  void _internal_set_node2(uint32_t value);
+  bool _internal_has_loadbalance() const;
+  public:
+  void clear_loadbalance();
+  const ::ns3_proto::LoadBalanceConfig& loadbalance() const;
+  PROTOBUF_NODISCARD ::ns3_proto::LoadBalanceConfig* release_loadbalance();
+  ::ns3_proto::LoadBalanceConfig* mutable_loadbalance();
+  void set_allocated_loadbalance(::ns3_proto::LoadBalanceConfig* loadbalance);
+  private:
+  const ::ns3_proto::LoadBalanceConfig& _internal_loadbalance() const;
+  ::ns3_proto::LoadBalanceConfig* _internal_mutable_loadbalance();
   public:
+  void unsafe_arena_set_allocated_loadbalance(
+      ::ns3_proto::LoadBalanceConfig* loadbalance);
+  ::ns3_proto::LoadBalanceConfig* unsafe_arena_release_loadbalance();
 
-  // uint32 port1 = 3;
-  void clear_port1();
-  uint32_t port1() const;
-  void set_port1(uint32_t value);
+  // uint32 nodesNum = 1;
+  void clear_nodesnum();
+  uint32_t nodesnum() const;
+  void set_nodesnum(uint32_t value);
   private:
-  uint32_t _internal_port1() const;
-  void _internal_set_port1(uint32_t value);
+  uint32_t _internal_nodesnum() const;
+  void _internal_set_nodesnum(uint32_t value);
   public:
 
-  // uint32 port2 = 4;
-  void clear_port2();
-  uint32_t port2() const;
-  void set_port2(uint32_t value);
+  // uint32 baseIndex = 2;
+  void clear_baseindex();
+  uint32_t baseindex() const;
+  void set_baseindex(uint32_t value);
   private:
-  uint32_t _internal_port2() const;
-  void _internal_set_port2(uint32_t value);
+  uint32_t _internal_baseindex() const;
+  void _internal_set_baseindex(uint32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:ns3_proto.Link)
+  // uint32 queueNum = 4;
+  void clear_queuenum();
+  uint32_t queuenum() const;
+  void set_queuenum(uint32_t value);
+  private:
+  uint32_t _internal_queuenum() const;
+  void _internal_set_queuenum(uint32_t value);
+  public:
+
+  // bool intEnabled = 8;
+  void clear_intenabled();
+  bool intenabled() const;
+  void set_intenabled(bool value);
+  private:
+  bool _internal_intenabled() const;
+  void _internal_set_intenabled(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3_proto.SwitchGroup)
  private:
   class _Internal;
 
@@ -1587,12 +1724,14 @@ class Link final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rate_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr delay_;
-    uint32_t node1_;
-    uint32_t node2_;
-    uint32_t port1_;
-    uint32_t port2_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SwitchPortConfig > ports_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr buffersize_;
+    ::ns3_proto::SharedBufferConfig* sharedbuffer_;
+    ::ns3_proto::LoadBalanceConfig* loadbalance_;
+    uint32_t nodesnum_;
+    uint32_t baseindex_;
+    uint32_t queuenum_;
+    bool intenabled_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1600,24 +1739,24 @@ class Link final :
 };
 // -------------------------------------------------------------------
 
-class Application final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.Application) */ {
+class AllNodes final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.AllNodes) */ {
  public:
-  inline Application() : Application(nullptr) {}
-  ~Application() override;
-  explicit PROTOBUF_CONSTEXPR Application(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline AllNodes() : AllNodes(nullptr) {}
+  ~AllNodes() override;
+  explicit PROTOBUF_CONSTEXPR AllNodes(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Application(const Application& from);
-  Application(Application&& from) noexcept
-    : Application() {
+  AllNodes(const AllNodes& from);
+  AllNodes(AllNodes&& from) noexcept
+    : AllNodes() {
     *this = ::std::move(from);
   }
 
-  inline Application& operator=(const Application& from) {
+  inline AllNodes& operator=(const AllNodes& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Application& operator=(Application&& from) noexcept {
+  inline AllNodes& operator=(AllNodes&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1640,20 +1779,20 @@ class Application final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Application& default_instance() {
+  static const AllNodes& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Application* internal_default_instance() {
-    return reinterpret_cast<const Application*>(
-               &_Application_default_instance_);
+  static inline const AllNodes* internal_default_instance() {
+    return reinterpret_cast<const AllNodes*>(
+               &_AllNodes_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     8;
 
-  friend void swap(Application& a, Application& b) {
+  friend void swap(AllNodes& a, AllNodes& b) {
     a.Swap(&b);
   }
-  inline void Swap(Application* other) {
+  inline void Swap(AllNodes* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1666,7 +1805,7 @@ class Application final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Application* other) {
+  void UnsafeArenaSwap(AllNodes* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1674,14 +1813,14 @@ class Application final :
 
   // implements Message ----------------------------------------------
 
-  Application* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Application>(arena);
+  AllNodes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AllNodes>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Application& from);
+  void CopyFrom(const AllNodes& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Application& from) {
-    Application::MergeImpl(*this, from);
+  void MergeFrom( const AllNodes& from) {
+    AllNodes::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1699,15 +1838,15 @@ class Application final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Application* other);
+  void InternalSwap(AllNodes* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "ns3_proto.Application";
+    return "ns3_proto.AllNodes";
   }
   protected:
-  explicit Application(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit AllNodes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1721,142 +1860,79 @@ class Application final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kNodeIndicesFieldNumber = 1,
-    kAppNameFieldNumber = 2,
-    kProtocolGroupFieldNumber = 3,
-    kArgFieldNumber = 4,
-    kStartTimeFieldNumber = 6,
-    kStopTimeFieldNumber = 7,
-    kLoadFieldNumber = 5,
-    kDestFieldNumber = 8,
+    kHostGroupsFieldNumber = 2,
+    kSwitchGroupsFieldNumber = 3,
+    kSystemIdsFieldNumber = 4,
+    kNumFieldNumber = 1,
   };
-  // repeated uint32 nodeIndices = 1;
-  int nodeindices_size() const;
-  private:
-  int _internal_nodeindices_size() const;
-  public:
-  void clear_nodeindices();
+  // repeated .ns3_proto.HostGroup hostGroups = 2;
+  int hostgroups_size() const;
   private:
-  uint32_t _internal_nodeindices(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
-      _internal_nodeindices() const;
-  void _internal_add_nodeindices(uint32_t value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
-      _internal_mutable_nodeindices();
+  int _internal_hostgroups_size() const;
   public:
-  uint32_t nodeindices(int index) const;
-  void set_nodeindices(int index, uint32_t value);
-  void add_nodeindices(uint32_t value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
-      nodeindices() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
-      mutable_nodeindices();
-
-  // string appName = 2;
-  void clear_appname();
-  const std::string& appname() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_appname(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_appname();
-  PROTOBUF_NODISCARD std::string* release_appname();
-  void set_allocated_appname(std::string* appname);
+  void clear_hostgroups();
+  ::ns3_proto::HostGroup* mutable_hostgroups(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::HostGroup >*
+      mutable_hostgroups();
   private:
-  const std::string& _internal_appname() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_appname(const std::string& value);
-  std::string* _internal_mutable_appname();
+  const ::ns3_proto::HostGroup& _internal_hostgroups(int index) const;
+  ::ns3_proto::HostGroup* _internal_add_hostgroups();
   public:
+  const ::ns3_proto::HostGroup& hostgroups(int index) const;
+  ::ns3_proto::HostGroup* add_hostgroups();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::HostGroup >&
+      hostgroups() const;
 
-  // optional string protocolGroup = 3;
-  bool has_protocolgroup() const;
+  // repeated .ns3_proto.SwitchGroup switchGroups = 3;
+  int switchgroups_size() const;
   private:
-  bool _internal_has_protocolgroup() const;
+  int _internal_switchgroups_size() const;
   public:
-  void clear_protocolgroup();
-  const std::string& protocolgroup() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_protocolgroup(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_protocolgroup();
-  PROTOBUF_NODISCARD std::string* release_protocolgroup();
-  void set_allocated_protocolgroup(std::string* protocolgroup);
+  void clear_switchgroups();
+  ::ns3_proto::SwitchGroup* mutable_switchgroups(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SwitchGroup >*
+      mutable_switchgroups();
   private:
-  const std::string& _internal_protocolgroup() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_protocolgroup(const std::string& value);
-  std::string* _internal_mutable_protocolgroup();
+  const ::ns3_proto::SwitchGroup& _internal_switchgroups(int index) const;
+  ::ns3_proto::SwitchGroup* _internal_add_switchgroups();
   public:
+  const ::ns3_proto::SwitchGroup& switchgroups(int index) const;
+  ::ns3_proto::SwitchGroup* add_switchgroups();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SwitchGroup >&
+      switchgroups() const;
 
-  // optional string arg = 4;
-  bool has_arg() const;
+  // repeated uint32 systemIds = 4;
+  int systemids_size() const;
   private:
-  bool _internal_has_arg() const;
+  int _internal_systemids_size() const;
   public:
-  void clear_arg();
-  const std::string& arg() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_arg(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_arg();
-  PROTOBUF_NODISCARD std::string* release_arg();
-  void set_allocated_arg(std::string* arg);
+  void clear_systemids();
   private:
-  const std::string& _internal_arg() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_arg(const std::string& value);
-  std::string* _internal_mutable_arg();
+  uint32_t _internal_systemids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_systemids() const;
+  void _internal_add_systemids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_systemids();
   public:
+  uint32_t systemids(int index) const;
+  void set_systemids(int index, uint32_t value);
+  void add_systemids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      systemids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_systemids();
 
-  // string startTime = 6;
-  void clear_starttime();
-  const std::string& starttime() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_starttime(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_starttime();
-  PROTOBUF_NODISCARD std::string* release_starttime();
-  void set_allocated_starttime(std::string* starttime);
+  // uint32 num = 1;
+  void clear_num();
+  uint32_t num() const;
+  void set_num(uint32_t value);
   private:
-  const std::string& _internal_starttime() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_starttime(const std::string& value);
-  std::string* _internal_mutable_starttime();
+  uint32_t _internal_num() const;
+  void _internal_set_num(uint32_t value);
   public:
 
-  // string stopTime = 7;
-  void clear_stoptime();
-  const std::string& stoptime() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_stoptime(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_stoptime();
-  PROTOBUF_NODISCARD std::string* release_stoptime();
-  void set_allocated_stoptime(std::string* stoptime);
-  private:
-  const std::string& _internal_stoptime() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stoptime(const std::string& value);
-  std::string* _internal_mutable_stoptime();
-  public:
-
-  // optional double load = 5;
-  bool has_load() const;
-  private:
-  bool _internal_has_load() const;
-  public:
-  void clear_load();
-  double load() const;
-  void set_load(double value);
-  private:
-  double _internal_load() const;
-  void _internal_set_load(double value);
-  public:
-
-  // optional uint32 dest = 8;
-  bool has_dest() const;
-  private:
-  bool _internal_has_dest() const;
-  public:
-  void clear_dest();
-  uint32_t dest() const;
-  void set_dest(uint32_t value);
-  private:
-  uint32_t _internal_dest() const;
-  void _internal_set_dest(uint32_t value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:ns3_proto.Application)
+  // @@protoc_insertion_point(class_scope:ns3_proto.AllNodes)
  private:
   class _Internal;
 
@@ -1864,41 +1940,36 @@ class Application final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::HostGroup > hostgroups_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SwitchGroup > switchgroups_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > systemids_;
+    mutable std::atomic<int> _systemids_cached_byte_size_;
+    uint32_t num_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > nodeindices_;
-    mutable std::atomic<int> _nodeindices_cached_byte_size_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr appname_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr protocolgroup_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr arg_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr starttime_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stoptime_;
-    double load_;
-    uint32_t dest_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_configurations_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Topology final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.Topology) */ {
+class Link final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.Link) */ {
  public:
-  inline Topology() : Topology(nullptr) {}
-  ~Topology() override;
-  explicit PROTOBUF_CONSTEXPR Topology(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline Link() : Link(nullptr) {}
+  ~Link() override;
+  explicit PROTOBUF_CONSTEXPR Link(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Topology(const Topology& from);
-  Topology(Topology&& from) noexcept
-    : Topology() {
+  Link(const Link& from);
+  Link(Link&& from) noexcept
+    : Link() {
     *this = ::std::move(from);
   }
 
-  inline Topology& operator=(const Topology& from) {
+  inline Link& operator=(const Link& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Topology& operator=(Topology&& from) noexcept {
+  inline Link& operator=(Link&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1921,20 +1992,20 @@ class Topology final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Topology& default_instance() {
+  static const Link& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Topology* internal_default_instance() {
-    return reinterpret_cast<const Topology*>(
-               &_Topology_default_instance_);
+  static inline const Link* internal_default_instance() {
+    return reinterpret_cast<const Link*>(
+               &_Link_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     9;
 
-  friend void swap(Topology& a, Topology& b) {
+  friend void swap(Link& a, Link& b) {
     a.Swap(&b);
   }
-  inline void Swap(Topology* other) {
+  inline void Swap(Link* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1947,7 +2018,7 @@ class Topology final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Topology* other) {
+  void UnsafeArenaSwap(Link* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1955,14 +2026,14 @@ class Topology final :
 
   // implements Message ----------------------------------------------
 
-  Topology* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Topology>(arena);
+  Link* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Link>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Topology& from);
+  void CopyFrom(const Link& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Topology& from) {
-    Topology::MergeImpl(*this, from);
+  void MergeFrom( const Link& from) {
+    Link::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1980,15 +2051,15 @@ class Topology final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Topology* other);
+  void InternalSwap(Link* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "ns3_proto.Topology";
+    return "ns3_proto.Link";
   }
   protected:
-  explicit Topology(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit Link(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2002,46 +2073,78 @@ class Topology final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kLinksFieldNumber = 2,
-    kNodesFieldNumber = 1,
+    kRateFieldNumber = 5,
+    kDelayFieldNumber = 6,
+    kNode1FieldNumber = 1,
+    kNode2FieldNumber = 2,
+    kPort1FieldNumber = 3,
+    kPort2FieldNumber = 4,
   };
-  // repeated .ns3_proto.Link links = 2;
-  int links_size() const;
+  // string rate = 5;
+  void clear_rate();
+  const std::string& rate() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rate(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rate();
+  PROTOBUF_NODISCARD std::string* release_rate();
+  void set_allocated_rate(std::string* rate);
   private:
-  int _internal_links_size() const;
+  const std::string& _internal_rate() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rate(const std::string& value);
+  std::string* _internal_mutable_rate();
   public:
-  void clear_links();
-  ::ns3_proto::Link* mutable_links(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Link >*
-      mutable_links();
+
+  // string delay = 6;
+  void clear_delay();
+  const std::string& delay() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_delay(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_delay();
+  PROTOBUF_NODISCARD std::string* release_delay();
+  void set_allocated_delay(std::string* delay);
   private:
-  const ::ns3_proto::Link& _internal_links(int index) const;
-  ::ns3_proto::Link* _internal_add_links();
+  const std::string& _internal_delay() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_delay(const std::string& value);
+  std::string* _internal_mutable_delay();
   public:
-  const ::ns3_proto::Link& links(int index) const;
-  ::ns3_proto::Link* add_links();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Link >&
-      links() const;
 
-  // .ns3_proto.AllNodes nodes = 1;
-  bool has_nodes() const;
+  // uint32 node1 = 1;
+  void clear_node1();
+  uint32_t node1() const;
+  void set_node1(uint32_t value);
   private:
-  bool _internal_has_nodes() const;
+  uint32_t _internal_node1() const;
+  void _internal_set_node1(uint32_t value);
   public:
-  void clear_nodes();
-  const ::ns3_proto::AllNodes& nodes() const;
-  PROTOBUF_NODISCARD ::ns3_proto::AllNodes* release_nodes();
-  ::ns3_proto::AllNodes* mutable_nodes();
-  void set_allocated_nodes(::ns3_proto::AllNodes* nodes);
+
+  // uint32 node2 = 2;
+  void clear_node2();
+  uint32_t node2() const;
+  void set_node2(uint32_t value);
   private:
-  const ::ns3_proto::AllNodes& _internal_nodes() const;
-  ::ns3_proto::AllNodes* _internal_mutable_nodes();
+  uint32_t _internal_node2() const;
+  void _internal_set_node2(uint32_t value);
   public:
-  void unsafe_arena_set_allocated_nodes(
-      ::ns3_proto::AllNodes* nodes);
-  ::ns3_proto::AllNodes* unsafe_arena_release_nodes();
 
-  // @@protoc_insertion_point(class_scope:ns3_proto.Topology)
+  // uint32 port1 = 3;
+  void clear_port1();
+  uint32_t port1() const;
+  void set_port1(uint32_t value);
+  private:
+  uint32_t _internal_port1() const;
+  void _internal_set_port1(uint32_t value);
+  public:
+
+  // uint32 port2 = 4;
+  void clear_port2();
+  uint32_t port2() const;
+  void set_port2(uint32_t value);
+  private:
+  uint32_t _internal_port2() const;
+  void _internal_set_port2(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3_proto.Link)
  private:
   class _Internal;
 
@@ -2049,8 +2152,12 @@ class Topology final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Link > links_;
-    ::ns3_proto::AllNodes* nodes_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rate_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr delay_;
+    uint32_t node1_;
+    uint32_t node2_;
+    uint32_t port1_;
+    uint32_t port2_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2058,24 +2165,24 @@ class Topology final :
 };
 // -------------------------------------------------------------------
 
-class Configurations final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.Configurations) */ {
+class Application final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.Application) */ {
  public:
-  inline Configurations() : Configurations(nullptr) {}
-  ~Configurations() override;
-  explicit PROTOBUF_CONSTEXPR Configurations(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline Application() : Application(nullptr) {}
+  ~Application() override;
+  explicit PROTOBUF_CONSTEXPR Application(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Configurations(const Configurations& from);
-  Configurations(Configurations&& from) noexcept
-    : Configurations() {
+  Application(const Application& from);
+  Application(Application&& from) noexcept
+    : Application() {
     *this = ::std::move(from);
   }
 
-  inline Configurations& operator=(const Configurations& from) {
+  inline Application& operator=(const Application& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Configurations& operator=(Configurations&& from) noexcept {
+  inline Application& operator=(Application&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2098,20 +2205,20 @@ class Configurations final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Configurations& default_instance() {
+  static const Application& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Configurations* internal_default_instance() {
-    return reinterpret_cast<const Configurations*>(
-               &_Configurations_default_instance_);
+  static inline const Application* internal_default_instance() {
+    return reinterpret_cast<const Application*>(
+               &_Application_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     10;
 
-  friend void swap(Configurations& a, Configurations& b) {
+  friend void swap(Application& a, Application& b) {
     a.Swap(&b);
   }
-  inline void Swap(Configurations* other) {
+  inline void Swap(Application* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2124,7 +2231,7 @@ class Configurations final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Configurations* other) {
+  void UnsafeArenaSwap(Application* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2132,14 +2239,14 @@ class Configurations final :
 
   // implements Message ----------------------------------------------
 
-  Configurations* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Configurations>(arena);
+  Application* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Application>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Configurations& from);
+  void CopyFrom(const Application& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Configurations& from) {
-    Configurations::MergeImpl(*this, from);
+  void MergeFrom( const Application& from) {
+    Application::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2157,15 +2264,15 @@ class Configurations final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Configurations* other);
+  void InternalSwap(Application* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "ns3_proto.Configurations";
+    return "ns3_proto.Application";
   }
   protected:
-  explicit Configurations(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit Application(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2179,65 +2286,1001 @@ class Configurations final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kApplicationsFieldNumber = 3,
-    kGlobalConfigFieldNumber = 1,
-    kTopologyFieldNumber = 2,
-  };
-  // repeated .ns3_proto.Application applications = 3;
-  int applications_size() const;
-  private:
-  int _internal_applications_size() const;
-  public:
+    kNodeIndicesFieldNumber = 1,
+    kAppNameFieldNumber = 2,
+    kProtocolGroupFieldNumber = 3,
+    kArgFieldNumber = 4,
+    kStartTimeFieldNumber = 6,
+    kStopTimeFieldNumber = 7,
+    kFileNameFieldNumber = 9,
+    kLoadFieldNumber = 5,
+    kDestFieldNumber = 8,
+  };
+  // repeated uint32 nodeIndices = 1;
+  int nodeindices_size() const;
+  private:
+  int _internal_nodeindices_size() const;
+  public:
+  void clear_nodeindices();
+  private:
+  uint32_t _internal_nodeindices(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_nodeindices() const;
+  void _internal_add_nodeindices(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_nodeindices();
+  public:
+  uint32_t nodeindices(int index) const;
+  void set_nodeindices(int index, uint32_t value);
+  void add_nodeindices(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      nodeindices() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_nodeindices();
+
+  // string appName = 2;
+  void clear_appname();
+  const std::string& appname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_appname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_appname();
+  PROTOBUF_NODISCARD std::string* release_appname();
+  void set_allocated_appname(std::string* appname);
+  private:
+  const std::string& _internal_appname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_appname(const std::string& value);
+  std::string* _internal_mutable_appname();
+  public:
+
+  // optional string protocolGroup = 3;
+  bool has_protocolgroup() const;
+  private:
+  bool _internal_has_protocolgroup() const;
+  public:
+  void clear_protocolgroup();
+  const std::string& protocolgroup() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_protocolgroup(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_protocolgroup();
+  PROTOBUF_NODISCARD std::string* release_protocolgroup();
+  void set_allocated_protocolgroup(std::string* protocolgroup);
+  private:
+  const std::string& _internal_protocolgroup() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_protocolgroup(const std::string& value);
+  std::string* _internal_mutable_protocolgroup();
+  public:
+
+  // optional string arg = 4;
+  bool has_arg() const;
+  private:
+  bool _internal_has_arg() const;
+  public:
+  void clear_arg();
+  const std::string& arg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_arg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_arg();
+  PROTOBUF_NODISCARD std::string* release_arg();
+  void set_allocated_arg(std::string* arg);
+  private:
+  const std::string& _internal_arg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_arg(const std::string& value);
+  std::string* _internal_mutable_arg();
+  public:
+
+  // string startTime = 6;
+  void clear_starttime();
+  const std::string& starttime() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_starttime(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_starttime();
+  PROTOBUF_NODISCARD std::string* release_starttime();
+  void set_allocated_starttime(std::string* starttime);
+  private:
+  const std::string& _internal_starttime() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_starttime(const std::string& value);
+  std::string* _internal_mutable_starttime();
+  public:
+
+  // string stopTime = 7;
+  void clear_stoptime();
+  const std::string& stoptime() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_stoptime(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_stoptime();
+  PROTOBUF_NODISCARD std::string* release_stoptime();
+  void set_allocated_stoptime(std::string* stoptime);
+  private:
+  const std::string& _internal_stoptime() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stoptime(const std::string& value);
+  std::string* _internal_mutable_stoptime();
+  public:
+
+  // optional string fileName = 9;
+  bool has_filename() const;
+  private:
+  bool _internal_has_filename() const;
+  public:
+  void clear_filename();
+  const std::string& filename() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_filename(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_filename();
+  PROTOBUF_NODISCARD std::string* release_filename();
+  void set_allocated_filename(std::string* filename);
+  private:
+  const std::string& _internal_filename() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_filename(const std::string& value);
+  std::string* _internal_mutable_filename();
+  public:
+
+  // optional double load = 5;
+  bool has_load() const;
+  private:
+  bool _internal_has_load() const;
+  public:
+  void clear_load();
+  double load() const;
+  void set_load(double value);
+  private:
+  double _internal_load() const;
+  void _internal_set_load(double value);
+  public:
+
+  // optional uint32 dest = 8;
+  bool has_dest() const;
+  private:
+  bool _internal_has_dest() const;
+  public:
+  void clear_dest();
+  uint32_t dest() const;
+  void set_dest(uint32_t value);
+  private:
+  uint32_t _internal_dest() const;
+  void _internal_set_dest(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3_proto.Application)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > nodeindices_;
+    mutable std::atomic<int> _nodeindices_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr appname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr protocolgroup_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr arg_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr starttime_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stoptime_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filename_;
+    double load_;
+    uint32_t dest_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_configurations_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Topology final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.Topology) */ {
+ public:
+  inline Topology() : Topology(nullptr) {}
+  ~Topology() override;
+  explicit PROTOBUF_CONSTEXPR Topology(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Topology(const Topology& from);
+  Topology(Topology&& from) noexcept
+    : Topology() {
+    *this = ::std::move(from);
+  }
+
+  inline Topology& operator=(const Topology& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Topology& operator=(Topology&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Topology& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Topology* internal_default_instance() {
+    return reinterpret_cast<const Topology*>(
+               &_Topology_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(Topology& a, Topology& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Topology* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Topology* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Topology* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Topology>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Topology& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Topology& from) {
+    Topology::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Topology* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3_proto.Topology";
+  }
+  protected:
+  explicit Topology(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLinksFieldNumber = 2,
+    kNodesFieldNumber = 1,
+  };
+  // repeated .ns3_proto.Link links = 2;
+  int links_size() const;
+  private:
+  int _internal_links_size() const;
+  public:
+  void clear_links();
+  ::ns3_proto::Link* mutable_links(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Link >*
+      mutable_links();
+  private:
+  const ::ns3_proto::Link& _internal_links(int index) const;
+  ::ns3_proto::Link* _internal_add_links();
+  public:
+  const ::ns3_proto::Link& links(int index) const;
+  ::ns3_proto::Link* add_links();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Link >&
+      links() const;
+
+  // .ns3_proto.AllNodes nodes = 1;
+  bool has_nodes() const;
+  private:
+  bool _internal_has_nodes() const;
+  public:
+  void clear_nodes();
+  const ::ns3_proto::AllNodes& nodes() const;
+  PROTOBUF_NODISCARD ::ns3_proto::AllNodes* release_nodes();
+  ::ns3_proto::AllNodes* mutable_nodes();
+  void set_allocated_nodes(::ns3_proto::AllNodes* nodes);
+  private:
+  const ::ns3_proto::AllNodes& _internal_nodes() const;
+  ::ns3_proto::AllNodes* _internal_mutable_nodes();
+  public:
+  void unsafe_arena_set_allocated_nodes(
+      ::ns3_proto::AllNodes* nodes);
+  ::ns3_proto::AllNodes* unsafe_arena_release_nodes();
+
+  // @@protoc_insertion_point(class_scope:ns3_proto.Topology)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Link > links_;
+    ::ns3_proto::AllNodes* nodes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_configurations_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Configurations final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.Configurations) */ {
+ public:
+  inline Configurations() : Configurations(nullptr) {}
+  ~Configurations() override;
+  explicit PROTOBUF_CONSTEXPR Configurations(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Configurations(const Configurations& from);
+  Configurations(Configurations&& from) noexcept
+    : Configurations() {
+    *this = ::std::move(from);
+  }
+
+  inline Configurations& operator=(const Configurations& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Configurations& operator=(Configurations&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Configurations& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Configurations* internal_default_instance() {
+    return reinterpret_cast<const Configurations*>(
+               &_Configurations_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(Configurations& a, Configurations& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Configurations* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Configurations* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Configurations* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Configurations>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Configurations& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Configurations& from) {
+    Configurations::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Configurations* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3_proto.Configurations";
+  }
+  protected:
+  explicit Configurations(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kApplicationsFieldNumber = 3,
+    kGlobalConfigFieldNumber = 1,
+    kTopologyFieldNumber = 2,
+  };
+  // repeated .ns3_proto.Application applications = 3;
+  int applications_size() const;
+  private:
+  int _internal_applications_size() const;
+  public:
   void clear_applications();
   ::ns3_proto::Application* mutable_applications(int index);
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Application >*
       mutable_applications();
   private:
-  const ::ns3_proto::Application& _internal_applications(int index) const;
-  ::ns3_proto::Application* _internal_add_applications();
+  const ::ns3_proto::Application& _internal_applications(int index) const;
+  ::ns3_proto::Application* _internal_add_applications();
+  public:
+  const ::ns3_proto::Application& applications(int index) const;
+  ::ns3_proto::Application* add_applications();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Application >&
+      applications() const;
+
+  // .ns3_proto.GlobalConfig globalConfig = 1;
+  bool has_globalconfig() const;
+  private:
+  bool _internal_has_globalconfig() const;
+  public:
+  void clear_globalconfig();
+  const ::ns3_proto::GlobalConfig& globalconfig() const;
+  PROTOBUF_NODISCARD ::ns3_proto::GlobalConfig* release_globalconfig();
+  ::ns3_proto::GlobalConfig* mutable_globalconfig();
+  void set_allocated_globalconfig(::ns3_proto::GlobalConfig* globalconfig);
+  private:
+  const ::ns3_proto::GlobalConfig& _internal_globalconfig() const;
+  ::ns3_proto::GlobalConfig* _internal_mutable_globalconfig();
+  public:
+  void unsafe_arena_set_allocated_globalconfig(
+      ::ns3_proto::GlobalConfig* globalconfig);
+  ::ns3_proto::GlobalConfig* unsafe_arena_release_globalconfig();
+
+  // .ns3_proto.Topology topology = 2;
+  bool has_topology() const;
+  private:
+  bool _internal_has_topology() const;
+  public:
+  void clear_topology();
+  const ::ns3_proto::Topology& topology() const;
+  PROTOBUF_NODISCARD ::ns3_proto::Topology* release_topology();
+  ::ns3_proto::Topology* mutable_topology();
+  void set_allocated_topology(::ns3_proto::Topology* topology);
+  private:
+  const ::ns3_proto::Topology& _internal_topology() const;
+  ::ns3_proto::Topology* _internal_mutable_topology();
+  public:
+  void unsafe_arena_set_allocated_topology(
+      ::ns3_proto::Topology* topology);
+  ::ns3_proto::Topology* unsafe_arena_release_topology();
+
+  // @@protoc_insertion_point(class_scope:ns3_proto.Configurations)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Application > applications_;
+    ::ns3_proto::GlobalConfig* globalconfig_;
+    ::ns3_proto::Topology* topology_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_configurations_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SweepParameter final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.SweepParameter) */ {
+ public:
+  inline SweepParameter() : SweepParameter(nullptr) {}
+  ~SweepParameter() override;
+  explicit PROTOBUF_CONSTEXPR SweepParameter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SweepParameter(const SweepParameter& from);
+  SweepParameter(SweepParameter&& from) noexcept
+    : SweepParameter() {
+    *this = ::std::move(from);
+  }
+
+  inline SweepParameter& operator=(const SweepParameter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SweepParameter& operator=(SweepParameter&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SweepParameter& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SweepParameter* internal_default_instance() {
+    return reinterpret_cast<const SweepParameter*>(
+               &_SweepParameter_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(SweepParameter& a, SweepParameter& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SweepParameter* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SweepParameter* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SweepParameter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SweepParameter>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SweepParameter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SweepParameter& from) {
+    SweepParameter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SweepParameter* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3_proto.SweepParameter";
+  }
+  protected:
+  explicit SweepParameter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  const ::ns3_proto::Application& applications(int index) const;
-  ::ns3_proto::Application* add_applications();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Application >&
-      applications() const;
 
-  // .ns3_proto.GlobalConfig globalConfig = 1;
-  bool has_globalconfig() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValuesFieldNumber = 2,
+    kNameFieldNumber = 1,
+  };
+  // repeated string values = 2;
+  int values_size() const;
   private:
-  bool _internal_has_globalconfig() const;
+  int _internal_values_size() const;
   public:
-  void clear_globalconfig();
-  const ::ns3_proto::GlobalConfig& globalconfig() const;
-  PROTOBUF_NODISCARD ::ns3_proto::GlobalConfig* release_globalconfig();
-  ::ns3_proto::GlobalConfig* mutable_globalconfig();
-  void set_allocated_globalconfig(::ns3_proto::GlobalConfig* globalconfig);
+  void clear_values();
+  const std::string& values(int index) const;
+  std::string* mutable_values(int index);
+  void set_values(int index, const std::string& value);
+  void set_values(int index, std::string&& value);
+  void set_values(int index, const char* value);
+  void set_values(int index, const char* value, size_t size);
+  std::string* add_values();
+  void add_values(const std::string& value);
+  void add_values(std::string&& value);
+  void add_values(const char* value);
+  void add_values(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& values() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_values();
   private:
-  const ::ns3_proto::GlobalConfig& _internal_globalconfig() const;
-  ::ns3_proto::GlobalConfig* _internal_mutable_globalconfig();
+  const std::string& _internal_values(int index) const;
+  std::string* _internal_add_values();
   public:
-  void unsafe_arena_set_allocated_globalconfig(
-      ::ns3_proto::GlobalConfig* globalconfig);
-  ::ns3_proto::GlobalConfig* unsafe_arena_release_globalconfig();
 
-  // .ns3_proto.Topology topology = 2;
-  bool has_topology() const;
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
   private:
-  bool _internal_has_topology() const;
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
   public:
-  void clear_topology();
-  const ::ns3_proto::Topology& topology() const;
-  PROTOBUF_NODISCARD ::ns3_proto::Topology* release_topology();
-  ::ns3_proto::Topology* mutable_topology();
-  void set_allocated_topology(::ns3_proto::Topology* topology);
+
+  // @@protoc_insertion_point(class_scope:ns3_proto.SweepParameter)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> values_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_configurations_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Sweep final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3_proto.Sweep) */ {
+ public:
+  inline Sweep() : Sweep(nullptr) {}
+  ~Sweep() override;
+  explicit PROTOBUF_CONSTEXPR Sweep(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Sweep(const Sweep& from);
+  Sweep(Sweep&& from) noexcept
+    : Sweep() {
+    *this = ::std::move(from);
+  }
+
+  inline Sweep& operator=(const Sweep& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Sweep& operator=(Sweep&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Sweep& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Sweep* internal_default_instance() {
+    return reinterpret_cast<const Sweep*>(
+               &_Sweep_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(Sweep& a, Sweep& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Sweep* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Sweep* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Sweep* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Sweep>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Sweep& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Sweep& from) {
+    Sweep::MergeImpl(*this, from);
+  }
   private:
-  const ::ns3_proto::Topology& _internal_topology() const;
-  ::ns3_proto::Topology* _internal_mutable_topology();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  void unsafe_arena_set_allocated_topology(
-      ::ns3_proto::Topology* topology);
-  ::ns3_proto::Topology* unsafe_arena_release_topology();
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  // @@protoc_insertion_point(class_scope:ns3_proto.Configurations)
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Sweep* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3_proto.Sweep";
+  }
+  protected:
+  explicit Sweep(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kParametersFieldNumber = 2,
+    kFctSizeBinsFieldNumber = 8,
+    kOutputDirFieldNumber = 4,
+    kStopTimeFieldNumber = 5,
+    kLineRateFieldNumber = 6,
+    kBaseRttFieldNumber = 7,
+    kBaseFieldNumber = 1,
+    kRunsFieldNumber = 3,
+  };
+  // repeated .ns3_proto.SweepParameter parameters = 2;
+  int parameters_size() const;
+  private:
+  int _internal_parameters_size() const;
+  public:
+  void clear_parameters();
+  ::ns3_proto::SweepParameter* mutable_parameters(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SweepParameter >*
+      mutable_parameters();
+  private:
+  const ::ns3_proto::SweepParameter& _internal_parameters(int index) const;
+  ::ns3_proto::SweepParameter* _internal_add_parameters();
+  public:
+  const ::ns3_proto::SweepParameter& parameters(int index) const;
+  ::ns3_proto::SweepParameter* add_parameters();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SweepParameter >&
+      parameters() const;
+
+  // repeated uint64 fctSizeBins = 8;
+  int fctsizebins_size() const;
+  private:
+  int _internal_fctsizebins_size() const;
+  public:
+  void clear_fctsizebins();
+  private:
+  uint64_t _internal_fctsizebins(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_fctsizebins() const;
+  void _internal_add_fctsizebins(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_fctsizebins();
+  public:
+  uint64_t fctsizebins(int index) const;
+  void set_fctsizebins(int index, uint64_t value);
+  void add_fctsizebins(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      fctsizebins() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_fctsizebins();
+
+  // string outputDir = 4;
+  void clear_outputdir();
+  const std::string& outputdir() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_outputdir(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_outputdir();
+  PROTOBUF_NODISCARD std::string* release_outputdir();
+  void set_allocated_outputdir(std::string* outputdir);
+  private:
+  const std::string& _internal_outputdir() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_outputdir(const std::string& value);
+  std::string* _internal_mutable_outputdir();
+  public:
+
+  // string stopTime = 5;
+  void clear_stoptime();
+  const std::string& stoptime() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_stoptime(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_stoptime();
+  PROTOBUF_NODISCARD std::string* release_stoptime();
+  void set_allocated_stoptime(std::string* stoptime);
+  private:
+  const std::string& _internal_stoptime() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stoptime(const std::string& value);
+  std::string* _internal_mutable_stoptime();
+  public:
+
+  // optional string lineRate = 6;
+  bool has_linerate() const;
+  private:
+  bool _internal_has_linerate() const;
+  public:
+  void clear_linerate();
+  const std::string& linerate() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_linerate(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_linerate();
+  PROTOBUF_NODISCARD std::string* release_linerate();
+  void set_allocated_linerate(std::string* linerate);
+  private:
+  const std::string& _internal_linerate() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_linerate(const std::string& value);
+  std::string* _internal_mutable_linerate();
+  public:
+
+  // optional string baseRtt = 7;
+  bool has_basertt() const;
+  private:
+  bool _internal_has_basertt() const;
+  public:
+  void clear_basertt();
+  const std::string& basertt() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_basertt(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_basertt();
+  PROTOBUF_NODISCARD std::string* release_basertt();
+  void set_allocated_basertt(std::string* basertt);
+  private:
+  const std::string& _internal_basertt() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_basertt(const std::string& value);
+  std::string* _internal_mutable_basertt();
+  public:
+
+  // .ns3_proto.Configurations base = 1;
+  bool has_base() const;
+  private:
+  bool _internal_has_base() const;
+  public:
+  void clear_base();
+  const ::ns3_proto::Configurations& base() const;
+  PROTOBUF_NODISCARD ::ns3_proto::Configurations* release_base();
+  ::ns3_proto::Configurations* mutable_base();
+  void set_allocated_base(::ns3_proto::Configurations* base);
+  private:
+  const ::ns3_proto::Configurations& _internal_base() const;
+  ::ns3_proto::Configurations* _internal_mutable_base();
+  public:
+  void unsafe_arena_set_allocated_base(
+      ::ns3_proto::Configurations* base);
+  ::ns3_proto::Configurations* unsafe_arena_release_base();
+
+  // uint32 runs = 3;
+  void clear_runs();
+  uint32_t runs() const;
+  void set_runs(uint32_t value);
+  private:
+  uint32_t _internal_runs() const;
+  void _internal_set_runs(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3_proto.Sweep)
  private:
   class _Internal;
 
@@ -2245,10 +3288,17 @@ class Configurations final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Application > applications_;
-    ::ns3_proto::GlobalConfig* globalconfig_;
-    ::ns3_proto::Topology* topology_;
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SweepParameter > parameters_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > fctsizebins_;
+    mutable std::atomic<int> _fctsizebins_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr outputdir_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stoptime_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr linerate_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr basertt_;
+    ::ns3_proto::Configurations* base_;
+    uint32_t runs_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_configurations_2eproto;
@@ -2323,13 +3373,81 @@ inline void GlobalConfig::set_allocated_outputfct(std::string* outputfct) {
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.outputfct_.SetAllocated(outputfct, GetArenaForAllocation());
+  _impl_.outputfct_.SetAllocated(outputfct, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.outputfct_.IsDefault()) {
+    _impl_.outputfct_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.GlobalConfig.outputFct)
+}
+
+// optional string binaryTrace = 2;
+inline bool GlobalConfig::_internal_has_binarytrace() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GlobalConfig::has_binarytrace() const {
+  return _internal_has_binarytrace();
+}
+inline void GlobalConfig::clear_binarytrace() {
+  _impl_.binarytrace_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& GlobalConfig::binarytrace() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.GlobalConfig.binaryTrace)
+  return _internal_binarytrace();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GlobalConfig::set_binarytrace(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.binarytrace_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3_proto.GlobalConfig.binaryTrace)
+}
+inline std::string* GlobalConfig::mutable_binarytrace() {
+  std::string* _s = _internal_mutable_binarytrace();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.GlobalConfig.binaryTrace)
+  return _s;
+}
+inline const std::string& GlobalConfig::_internal_binarytrace() const {
+  return _impl_.binarytrace_.Get();
+}
+inline void GlobalConfig::_internal_set_binarytrace(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.binarytrace_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GlobalConfig::_internal_mutable_binarytrace() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.binarytrace_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GlobalConfig::release_binarytrace() {
+  // @@protoc_insertion_point(field_release:ns3_proto.GlobalConfig.binaryTrace)
+  if (!_internal_has_binarytrace()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.binarytrace_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.binarytrace_.IsDefault()) {
+    _impl_.binarytrace_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GlobalConfig::set_allocated_binarytrace(std::string* binarytrace) {
+  if (binarytrace != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.binarytrace_.SetAllocated(binarytrace, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.outputfct_.IsDefault()) {
-    _impl_.outputfct_.Set("", GetArenaForAllocation());
+  if (_impl_.binarytrace_.IsDefault()) {
+    _impl_.binarytrace_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:ns3_proto.GlobalConfig.outputFct)
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.GlobalConfig.binaryTrace)
 }
 
 // -------------------------------------------------------------------
@@ -2744,6 +3862,34 @@ inline void PortQueueConfig::set_ecnpmax(double value) {
   // @@protoc_insertion_point(field_set:ns3_proto.PortQueueConfig.ecnPMax)
 }
 
+// optional uint32 etsWeight = 7;
+inline bool PortQueueConfig::_internal_has_etsweight() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool PortQueueConfig::has_etsweight() const {
+  return _internal_has_etsweight();
+}
+inline void PortQueueConfig::clear_etsweight() {
+  _impl_.etsweight_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t PortQueueConfig::_internal_etsweight() const {
+  return _impl_.etsweight_;
+}
+inline uint32_t PortQueueConfig::etsweight() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.PortQueueConfig.etsWeight)
+  return _internal_etsweight();
+}
+inline void PortQueueConfig::_internal_set_etsweight(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.etsweight_ = value;
+}
+inline void PortQueueConfig::set_etsweight(uint32_t value) {
+  _internal_set_etsweight(value);
+  // @@protoc_insertion_point(field_set:ns3_proto.PortQueueConfig.etsWeight)
+}
+
 // -------------------------------------------------------------------
 
 // SwitchPortConfig
@@ -2830,6 +3976,282 @@ SwitchPortConfig::queues() const {
 
 // -------------------------------------------------------------------
 
+// SharedBufferConfig
+
+// string reserve = 1;
+inline void SharedBufferConfig::clear_reserve() {
+  _impl_.reserve_.ClearToEmpty();
+}
+inline const std::string& SharedBufferConfig::reserve() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.SharedBufferConfig.reserve)
+  return _internal_reserve();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SharedBufferConfig::set_reserve(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.reserve_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3_proto.SharedBufferConfig.reserve)
+}
+inline std::string* SharedBufferConfig::mutable_reserve() {
+  std::string* _s = _internal_mutable_reserve();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.SharedBufferConfig.reserve)
+  return _s;
+}
+inline const std::string& SharedBufferConfig::_internal_reserve() const {
+  return _impl_.reserve_.Get();
+}
+inline void SharedBufferConfig::_internal_set_reserve(const std::string& value) {
+  
+  _impl_.reserve_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SharedBufferConfig::_internal_mutable_reserve() {
+  
+  return _impl_.reserve_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SharedBufferConfig::release_reserve() {
+  // @@protoc_insertion_point(field_release:ns3_proto.SharedBufferConfig.reserve)
+  return _impl_.reserve_.Release();
+}
+inline void SharedBufferConfig::set_allocated_reserve(std::string* reserve) {
+  if (reserve != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.reserve_.SetAllocated(reserve, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reserve_.IsDefault()) {
+    _impl_.reserve_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.SharedBufferConfig.reserve)
+}
+
+// string headroom = 2;
+inline void SharedBufferConfig::clear_headroom() {
+  _impl_.headroom_.ClearToEmpty();
+}
+inline const std::string& SharedBufferConfig::headroom() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.SharedBufferConfig.headroom)
+  return _internal_headroom();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SharedBufferConfig::set_headroom(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.headroom_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3_proto.SharedBufferConfig.headroom)
+}
+inline std::string* SharedBufferConfig::mutable_headroom() {
+  std::string* _s = _internal_mutable_headroom();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.SharedBufferConfig.headroom)
+  return _s;
+}
+inline const std::string& SharedBufferConfig::_internal_headroom() const {
+  return _impl_.headroom_.Get();
+}
+inline void SharedBufferConfig::_internal_set_headroom(const std::string& value) {
+  
+  _impl_.headroom_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SharedBufferConfig::_internal_mutable_headroom() {
+  
+  return _impl_.headroom_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SharedBufferConfig::release_headroom() {
+  // @@protoc_insertion_point(field_release:ns3_proto.SharedBufferConfig.headroom)
+  return _impl_.headroom_.Release();
+}
+inline void SharedBufferConfig::set_allocated_headroom(std::string* headroom) {
+  if (headroom != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.headroom_.SetAllocated(headroom, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.headroom_.IsDefault()) {
+    _impl_.headroom_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.SharedBufferConfig.headroom)
+}
+
+// double pfcAlpha = 3;
+inline void SharedBufferConfig::clear_pfcalpha() {
+  _impl_.pfcalpha_ = 0;
+}
+inline double SharedBufferConfig::_internal_pfcalpha() const {
+  return _impl_.pfcalpha_;
+}
+inline double SharedBufferConfig::pfcalpha() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.SharedBufferConfig.pfcAlpha)
+  return _internal_pfcalpha();
+}
+inline void SharedBufferConfig::_internal_set_pfcalpha(double value) {
+  
+  _impl_.pfcalpha_ = value;
+}
+inline void SharedBufferConfig::set_pfcalpha(double value) {
+  _internal_set_pfcalpha(value);
+  // @@protoc_insertion_point(field_set:ns3_proto.SharedBufferConfig.pfcAlpha)
+}
+
+// string xonOffset = 4;
+inline void SharedBufferConfig::clear_xonoffset() {
+  _impl_.xonoffset_.ClearToEmpty();
+}
+inline const std::string& SharedBufferConfig::xonoffset() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.SharedBufferConfig.xonOffset)
+  return _internal_xonoffset();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SharedBufferConfig::set_xonoffset(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.xonoffset_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3_proto.SharedBufferConfig.xonOffset)
+}
+inline std::string* SharedBufferConfig::mutable_xonoffset() {
+  std::string* _s = _internal_mutable_xonoffset();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.SharedBufferConfig.xonOffset)
+  return _s;
+}
+inline const std::string& SharedBufferConfig::_internal_xonoffset() const {
+  return _impl_.xonoffset_.Get();
+}
+inline void SharedBufferConfig::_internal_set_xonoffset(const std::string& value) {
+  
+  _impl_.xonoffset_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SharedBufferConfig::_internal_mutable_xonoffset() {
+  
+  return _impl_.xonoffset_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SharedBufferConfig::release_xonoffset() {
+  // @@protoc_insertion_point(field_release:ns3_proto.SharedBufferConfig.xonOffset)
+  return _impl_.xonoffset_.Release();
+}
+inline void SharedBufferConfig::set_allocated_xonoffset(std::string* xonoffset) {
+  if (xonoffset != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.xonoffset_.SetAllocated(xonoffset, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.xonoffset_.IsDefault()) {
+    _impl_.xonoffset_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.SharedBufferConfig.xonOffset)
+}
+
+// optional double ecnAlpha = 5;
+inline bool SharedBufferConfig::_internal_has_ecnalpha() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SharedBufferConfig::has_ecnalpha() const {
+  return _internal_has_ecnalpha();
+}
+inline void SharedBufferConfig::clear_ecnalpha() {
+  _impl_.ecnalpha_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double SharedBufferConfig::_internal_ecnalpha() const {
+  return _impl_.ecnalpha_;
+}
+inline double SharedBufferConfig::ecnalpha() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.SharedBufferConfig.ecnAlpha)
+  return _internal_ecnalpha();
+}
+inline void SharedBufferConfig::_internal_set_ecnalpha(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.ecnalpha_ = value;
+}
+inline void SharedBufferConfig::set_ecnalpha(double value) {
+  _internal_set_ecnalpha(value);
+  // @@protoc_insertion_point(field_set:ns3_proto.SharedBufferConfig.ecnAlpha)
+}
+
+// -------------------------------------------------------------------
+
+// LoadBalanceConfig
+
+// .ns3_proto.LoadBalanceConfig.Mode mode = 1;
+inline void LoadBalanceConfig::clear_mode() {
+  _impl_.mode_ = 0;
+}
+inline ::ns3_proto::LoadBalanceConfig_Mode LoadBalanceConfig::_internal_mode() const {
+  return static_cast< ::ns3_proto::LoadBalanceConfig_Mode >(_impl_.mode_);
+}
+inline ::ns3_proto::LoadBalanceConfig_Mode LoadBalanceConfig::mode() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.LoadBalanceConfig.mode)
+  return _internal_mode();
+}
+inline void LoadBalanceConfig::_internal_set_mode(::ns3_proto::LoadBalanceConfig_Mode value) {
+  
+  _impl_.mode_ = value;
+}
+inline void LoadBalanceConfig::set_mode(::ns3_proto::LoadBalanceConfig_Mode value) {
+  _internal_set_mode(value);
+  // @@protoc_insertion_point(field_set:ns3_proto.LoadBalanceConfig.mode)
+}
+
+// string flowletGap = 2;
+inline void LoadBalanceConfig::clear_flowletgap() {
+  _impl_.flowletgap_.ClearToEmpty();
+}
+inline const std::string& LoadBalanceConfig::flowletgap() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.LoadBalanceConfig.flowletGap)
+  return _internal_flowletgap();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoadBalanceConfig::set_flowletgap(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.flowletgap_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3_proto.LoadBalanceConfig.flowletGap)
+}
+inline std::string* LoadBalanceConfig::mutable_flowletgap() {
+  std::string* _s = _internal_mutable_flowletgap();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.LoadBalanceConfig.flowletGap)
+  return _s;
+}
+inline const std::string& LoadBalanceConfig::_internal_flowletgap() const {
+  return _impl_.flowletgap_.Get();
+}
+inline void LoadBalanceConfig::_internal_set_flowletgap(const std::string& value) {
+  
+  _impl_.flowletgap_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LoadBalanceConfig::_internal_mutable_flowletgap() {
+  
+  return _impl_.flowletgap_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LoadBalanceConfig::release_flowletgap() {
+  // @@protoc_insertion_point(field_release:ns3_proto.LoadBalanceConfig.flowletGap)
+  return _impl_.flowletgap_.Release();
+}
+inline void LoadBalanceConfig::set_allocated_flowletgap(std::string* flowletgap) {
+  if (flowletgap != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.flowletgap_.SetAllocated(flowletgap, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.flowletgap_.IsDefault()) {
+    _impl_.flowletgap_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.LoadBalanceConfig.flowletGap)
+}
+
+// -------------------------------------------------------------------
+
 // SwitchGroup
 
 // uint32 nodesNum = 1;
@@ -2982,6 +4404,206 @@ SwitchGroup::ports() const {
   return _impl_.ports_;
 }
 
+// .ns3_proto.SharedBufferConfig sharedBuffer = 6;
+inline bool SwitchGroup::_internal_has_sharedbuffer() const {
+  return this != internal_default_instance() && _impl_.sharedbuffer_ != nullptr;
+}
+inline bool SwitchGroup::has_sharedbuffer() const {
+  return _internal_has_sharedbuffer();
+}
+inline void SwitchGroup::clear_sharedbuffer() {
+  if (GetArenaForAllocation() == nullptr && _impl_.sharedbuffer_ != nullptr) {
+    delete _impl_.sharedbuffer_;
+  }
+  _impl_.sharedbuffer_ = nullptr;
+}
+inline const ::ns3_proto::SharedBufferConfig& SwitchGroup::_internal_sharedbuffer() const {
+  const ::ns3_proto::SharedBufferConfig* p = _impl_.sharedbuffer_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ns3_proto::SharedBufferConfig&>(
+      ::ns3_proto::_SharedBufferConfig_default_instance_);
+}
+inline const ::ns3_proto::SharedBufferConfig& SwitchGroup::sharedbuffer() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.SwitchGroup.sharedBuffer)
+  return _internal_sharedbuffer();
+}
+inline void SwitchGroup::unsafe_arena_set_allocated_sharedbuffer(
+    ::ns3_proto::SharedBufferConfig* sharedbuffer) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sharedbuffer_);
+  }
+  _impl_.sharedbuffer_ = sharedbuffer;
+  if (sharedbuffer) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3_proto.SwitchGroup.sharedBuffer)
+}
+inline ::ns3_proto::SharedBufferConfig* SwitchGroup::release_sharedbuffer() {
+  
+  ::ns3_proto::SharedBufferConfig* temp = _impl_.sharedbuffer_;
+  _impl_.sharedbuffer_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ns3_proto::SharedBufferConfig* SwitchGroup::unsafe_arena_release_sharedbuffer() {
+  // @@protoc_insertion_point(field_release:ns3_proto.SwitchGroup.sharedBuffer)
+  
+  ::ns3_proto::SharedBufferConfig* temp = _impl_.sharedbuffer_;
+  _impl_.sharedbuffer_ = nullptr;
+  return temp;
+}
+inline ::ns3_proto::SharedBufferConfig* SwitchGroup::_internal_mutable_sharedbuffer() {
+  
+  if (_impl_.sharedbuffer_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ns3_proto::SharedBufferConfig>(GetArenaForAllocation());
+    _impl_.sharedbuffer_ = p;
+  }
+  return _impl_.sharedbuffer_;
+}
+inline ::ns3_proto::SharedBufferConfig* SwitchGroup::mutable_sharedbuffer() {
+  ::ns3_proto::SharedBufferConfig* _msg = _internal_mutable_sharedbuffer();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.SwitchGroup.sharedBuffer)
+  return _msg;
+}
+inline void SwitchGroup::set_allocated_sharedbuffer(::ns3_proto::SharedBufferConfig* sharedbuffer) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.sharedbuffer_;
+  }
+  if (sharedbuffer) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sharedbuffer);
+    if (message_arena != submessage_arena) {
+      sharedbuffer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sharedbuffer, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.sharedbuffer_ = sharedbuffer;
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.SwitchGroup.sharedBuffer)
+}
+
+// .ns3_proto.LoadBalanceConfig loadBalance = 7;
+inline bool SwitchGroup::_internal_has_loadbalance() const {
+  return this != internal_default_instance() && _impl_.loadbalance_ != nullptr;
+}
+inline bool SwitchGroup::has_loadbalance() const {
+  return _internal_has_loadbalance();
+}
+inline void SwitchGroup::clear_loadbalance() {
+  if (GetArenaForAllocation() == nullptr && _impl_.loadbalance_ != nullptr) {
+    delete _impl_.loadbalance_;
+  }
+  _impl_.loadbalance_ = nullptr;
+}
+inline const ::ns3_proto::LoadBalanceConfig& SwitchGroup::_internal_loadbalance() const {
+  const ::ns3_proto::LoadBalanceConfig* p = _impl_.loadbalance_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ns3_proto::LoadBalanceConfig&>(
+      ::ns3_proto::_LoadBalanceConfig_default_instance_);
+}
+inline const ::ns3_proto::LoadBalanceConfig& SwitchGroup::loadbalance() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.SwitchGroup.loadBalance)
+  return _internal_loadbalance();
+}
+inline void SwitchGroup::unsafe_arena_set_allocated_loadbalance(
+    ::ns3_proto::LoadBalanceConfig* loadbalance) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.loadbalance_);
+  }
+  _impl_.loadbalance_ = loadbalance;
+  if (loadbalance) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3_proto.SwitchGroup.loadBalance)
+}
+inline ::ns3_proto::LoadBalanceConfig* SwitchGroup::release_loadbalance() {
+  
+  ::ns3_proto::LoadBalanceConfig* temp = _impl_.loadbalance_;
+  _impl_.loadbalance_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ns3_proto::LoadBalanceConfig* SwitchGroup::unsafe_arena_release_loadbalance() {
+  // @@protoc_insertion_point(field_release:ns3_proto.SwitchGroup.loadBalance)
+  
+  ::ns3_proto::LoadBalanceConfig* temp = _impl_.loadbalance_;
+  _impl_.loadbalance_ = nullptr;
+  return temp;
+}
+inline ::ns3_proto::LoadBalanceConfig* SwitchGroup::_internal_mutable_loadbalance() {
+  
+  if (_impl_.loadbalance_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ns3_proto::LoadBalanceConfig>(GetArenaForAllocation());
+    _impl_.loadbalance_ = p;
+  }
+  return _impl_.loadbalance_;
+}
+inline ::ns3_proto::LoadBalanceConfig* SwitchGroup::mutable_loadbalance() {
+  ::ns3_proto::LoadBalanceConfig* _msg = _internal_mutable_loadbalance();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.SwitchGroup.loadBalance)
+  return _msg;
+}
+inline void SwitchGroup::set_allocated_loadbalance(::ns3_proto::LoadBalanceConfig* loadbalance) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.loadbalance_;
+  }
+  if (loadbalance) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(loadbalance);
+    if (message_arena != submessage_arena) {
+      loadbalance = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, loadbalance, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.loadbalance_ = loadbalance;
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.SwitchGroup.loadBalance)
+}
+
+// bool intEnabled = 8;
+inline void SwitchGroup::clear_intenabled() {
+  _impl_.intenabled_ = false;
+}
+inline bool SwitchGroup::_internal_intenabled() const {
+  return _impl_.intenabled_;
+}
+inline bool SwitchGroup::intenabled() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.SwitchGroup.intEnabled)
+  return _internal_intenabled();
+}
+inline void SwitchGroup::_internal_set_intenabled(bool value) {
+  
+  _impl_.intenabled_ = value;
+}
+inline void SwitchGroup::set_intenabled(bool value) {
+  _internal_set_intenabled(value);
+  // @@protoc_insertion_point(field_set:ns3_proto.SwitchGroup.intEnabled)
+}
+
 // -------------------------------------------------------------------
 
 // AllNodes
@@ -3072,18 +4694,65 @@ inline const ::ns3_proto::SwitchGroup& AllNodes::switchgroups(int index) const {
   // @@protoc_insertion_point(field_get:ns3_proto.AllNodes.switchGroups)
   return _internal_switchgroups(index);
 }
-inline ::ns3_proto::SwitchGroup* AllNodes::_internal_add_switchgroups() {
-  return _impl_.switchgroups_.Add();
+inline ::ns3_proto::SwitchGroup* AllNodes::_internal_add_switchgroups() {
+  return _impl_.switchgroups_.Add();
+}
+inline ::ns3_proto::SwitchGroup* AllNodes::add_switchgroups() {
+  ::ns3_proto::SwitchGroup* _add = _internal_add_switchgroups();
+  // @@protoc_insertion_point(field_add:ns3_proto.AllNodes.switchGroups)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SwitchGroup >&
+AllNodes::switchgroups() const {
+  // @@protoc_insertion_point(field_list:ns3_proto.AllNodes.switchGroups)
+  return _impl_.switchgroups_;
+}
+
+// repeated uint32 systemIds = 4;
+inline int AllNodes::_internal_systemids_size() const {
+  return _impl_.systemids_.size();
+}
+inline int AllNodes::systemids_size() const {
+  return _internal_systemids_size();
+}
+inline void AllNodes::clear_systemids() {
+  _impl_.systemids_.Clear();
+}
+inline uint32_t AllNodes::_internal_systemids(int index) const {
+  return _impl_.systemids_.Get(index);
+}
+inline uint32_t AllNodes::systemids(int index) const {
+  // @@protoc_insertion_point(field_get:ns3_proto.AllNodes.systemIds)
+  return _internal_systemids(index);
+}
+inline void AllNodes::set_systemids(int index, uint32_t value) {
+  _impl_.systemids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ns3_proto.AllNodes.systemIds)
+}
+inline void AllNodes::_internal_add_systemids(uint32_t value) {
+  _impl_.systemids_.Add(value);
+}
+inline void AllNodes::add_systemids(uint32_t value) {
+  _internal_add_systemids(value);
+  // @@protoc_insertion_point(field_add:ns3_proto.AllNodes.systemIds)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+AllNodes::_internal_systemids() const {
+  return _impl_.systemids_;
 }
-inline ::ns3_proto::SwitchGroup* AllNodes::add_switchgroups() {
-  ::ns3_proto::SwitchGroup* _add = _internal_add_switchgroups();
-  // @@protoc_insertion_point(field_add:ns3_proto.AllNodes.switchGroups)
-  return _add;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+AllNodes::systemids() const {
+  // @@protoc_insertion_point(field_list:ns3_proto.AllNodes.systemIds)
+  return _internal_systemids();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SwitchGroup >&
-AllNodes::switchgroups() const {
-  // @@protoc_insertion_point(field_list:ns3_proto.AllNodes.switchGroups)
-  return _impl_.switchgroups_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+AllNodes::_internal_mutable_systemids() {
+  return &_impl_.systemids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+AllNodes::mutable_systemids() {
+  // @@protoc_insertion_point(field_mutable_list:ns3_proto.AllNodes.systemIds)
+  return _internal_mutable_systemids();
 }
 
 // -------------------------------------------------------------------
@@ -3509,7 +5178,7 @@ inline void Application::set_allocated_arg(std::string* arg) {
 
 // optional double load = 5;
 inline bool Application::_internal_has_load() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
 inline bool Application::has_load() const {
@@ -3517,7 +5186,7 @@ inline bool Application::has_load() const {
 }
 inline void Application::clear_load() {
   _impl_.load_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000004u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline double Application::_internal_load() const {
   return _impl_.load_;
@@ -3527,7 +5196,7 @@ inline double Application::load() const {
   return _internal_load();
 }
 inline void Application::_internal_set_load(double value) {
-  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_._has_bits_[0] |= 0x00000008u;
   _impl_.load_ = value;
 }
 inline void Application::set_load(double value) {
@@ -3637,7 +5306,7 @@ inline void Application::set_allocated_stoptime(std::string* stoptime) {
 
 // optional uint32 dest = 8;
 inline bool Application::_internal_has_dest() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
   return value;
 }
 inline bool Application::has_dest() const {
@@ -3645,7 +5314,7 @@ inline bool Application::has_dest() const {
 }
 inline void Application::clear_dest() {
   _impl_.dest_ = 0u;
-  _impl_._has_bits_[0] &= ~0x00000008u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
 inline uint32_t Application::_internal_dest() const {
   return _impl_.dest_;
@@ -3655,7 +5324,7 @@ inline uint32_t Application::dest() const {
   return _internal_dest();
 }
 inline void Application::_internal_set_dest(uint32_t value) {
-  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_._has_bits_[0] |= 0x00000010u;
   _impl_.dest_ = value;
 }
 inline void Application::set_dest(uint32_t value) {
@@ -3663,6 +5332,74 @@ inline void Application::set_dest(uint32_t value) {
   // @@protoc_insertion_point(field_set:ns3_proto.Application.dest)
 }
 
+// optional string fileName = 9;
+inline bool Application::_internal_has_filename() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Application::has_filename() const {
+  return _internal_has_filename();
+}
+inline void Application::clear_filename() {
+  _impl_.filename_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Application::filename() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.Application.fileName)
+  return _internal_filename();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Application::set_filename(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.filename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3_proto.Application.fileName)
+}
+inline std::string* Application::mutable_filename() {
+  std::string* _s = _internal_mutable_filename();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.Application.fileName)
+  return _s;
+}
+inline const std::string& Application::_internal_filename() const {
+  return _impl_.filename_.Get();
+}
+inline void Application::_internal_set_filename(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.filename_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Application::_internal_mutable_filename() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.filename_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Application::release_filename() {
+  // @@protoc_insertion_point(field_release:ns3_proto.Application.fileName)
+  if (!_internal_has_filename()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.filename_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.filename_.IsDefault()) {
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Application::set_allocated_filename(std::string* filename) {
+  if (filename != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.filename_.SetAllocated(filename, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.filename_.IsDefault()) {
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.Application.fileName)
+}
+
 // -------------------------------------------------------------------
 
 // Topology
@@ -3871,65 +5608,328 @@ inline ::ns3_proto::GlobalConfig* Configurations::mutable_globalconfig() {
   // @@protoc_insertion_point(field_mutable:ns3_proto.Configurations.globalConfig)
   return _msg;
 }
-inline void Configurations::set_allocated_globalconfig(::ns3_proto::GlobalConfig* globalconfig) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.globalconfig_;
-  }
-  if (globalconfig) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(globalconfig);
-    if (message_arena != submessage_arena) {
-      globalconfig = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, globalconfig, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.globalconfig_ = globalconfig;
-  // @@protoc_insertion_point(field_set_allocated:ns3_proto.Configurations.globalConfig)
+inline void Configurations::set_allocated_globalconfig(::ns3_proto::GlobalConfig* globalconfig) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.globalconfig_;
+  }
+  if (globalconfig) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(globalconfig);
+    if (message_arena != submessage_arena) {
+      globalconfig = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, globalconfig, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.globalconfig_ = globalconfig;
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.Configurations.globalConfig)
+}
+
+// .ns3_proto.Topology topology = 2;
+inline bool Configurations::_internal_has_topology() const {
+  return this != internal_default_instance() && _impl_.topology_ != nullptr;
+}
+inline bool Configurations::has_topology() const {
+  return _internal_has_topology();
+}
+inline void Configurations::clear_topology() {
+  if (GetArenaForAllocation() == nullptr && _impl_.topology_ != nullptr) {
+    delete _impl_.topology_;
+  }
+  _impl_.topology_ = nullptr;
+}
+inline const ::ns3_proto::Topology& Configurations::_internal_topology() const {
+  const ::ns3_proto::Topology* p = _impl_.topology_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ns3_proto::Topology&>(
+      ::ns3_proto::_Topology_default_instance_);
+}
+inline const ::ns3_proto::Topology& Configurations::topology() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.Configurations.topology)
+  return _internal_topology();
+}
+inline void Configurations::unsafe_arena_set_allocated_topology(
+    ::ns3_proto::Topology* topology) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.topology_);
+  }
+  _impl_.topology_ = topology;
+  if (topology) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3_proto.Configurations.topology)
+}
+inline ::ns3_proto::Topology* Configurations::release_topology() {
+  
+  ::ns3_proto::Topology* temp = _impl_.topology_;
+  _impl_.topology_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ns3_proto::Topology* Configurations::unsafe_arena_release_topology() {
+  // @@protoc_insertion_point(field_release:ns3_proto.Configurations.topology)
+  
+  ::ns3_proto::Topology* temp = _impl_.topology_;
+  _impl_.topology_ = nullptr;
+  return temp;
+}
+inline ::ns3_proto::Topology* Configurations::_internal_mutable_topology() {
+  
+  if (_impl_.topology_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ns3_proto::Topology>(GetArenaForAllocation());
+    _impl_.topology_ = p;
+  }
+  return _impl_.topology_;
+}
+inline ::ns3_proto::Topology* Configurations::mutable_topology() {
+  ::ns3_proto::Topology* _msg = _internal_mutable_topology();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.Configurations.topology)
+  return _msg;
+}
+inline void Configurations::set_allocated_topology(::ns3_proto::Topology* topology) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.topology_;
+  }
+  if (topology) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(topology);
+    if (message_arena != submessage_arena) {
+      topology = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, topology, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.topology_ = topology;
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.Configurations.topology)
+}
+
+// repeated .ns3_proto.Application applications = 3;
+inline int Configurations::_internal_applications_size() const {
+  return _impl_.applications_.size();
+}
+inline int Configurations::applications_size() const {
+  return _internal_applications_size();
+}
+inline void Configurations::clear_applications() {
+  _impl_.applications_.Clear();
+}
+inline ::ns3_proto::Application* Configurations::mutable_applications(int index) {
+  // @@protoc_insertion_point(field_mutable:ns3_proto.Configurations.applications)
+  return _impl_.applications_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Application >*
+Configurations::mutable_applications() {
+  // @@protoc_insertion_point(field_mutable_list:ns3_proto.Configurations.applications)
+  return &_impl_.applications_;
+}
+inline const ::ns3_proto::Application& Configurations::_internal_applications(int index) const {
+  return _impl_.applications_.Get(index);
+}
+inline const ::ns3_proto::Application& Configurations::applications(int index) const {
+  // @@protoc_insertion_point(field_get:ns3_proto.Configurations.applications)
+  return _internal_applications(index);
+}
+inline ::ns3_proto::Application* Configurations::_internal_add_applications() {
+  return _impl_.applications_.Add();
+}
+inline ::ns3_proto::Application* Configurations::add_applications() {
+  ::ns3_proto::Application* _add = _internal_add_applications();
+  // @@protoc_insertion_point(field_add:ns3_proto.Configurations.applications)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Application >&
+Configurations::applications() const {
+  // @@protoc_insertion_point(field_list:ns3_proto.Configurations.applications)
+  return _impl_.applications_;
+}
+
+// -------------------------------------------------------------------
+
+// SweepParameter
+
+// string name = 1;
+inline void SweepParameter::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& SweepParameter::name() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.SweepParameter.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SweepParameter::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3_proto.SweepParameter.name)
+}
+inline std::string* SweepParameter::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.SweepParameter.name)
+  return _s;
+}
+inline const std::string& SweepParameter::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SweepParameter::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SweepParameter::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SweepParameter::release_name() {
+  // @@protoc_insertion_point(field_release:ns3_proto.SweepParameter.name)
+  return _impl_.name_.Release();
+}
+inline void SweepParameter::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.SweepParameter.name)
+}
+
+// repeated string values = 2;
+inline int SweepParameter::_internal_values_size() const {
+  return _impl_.values_.size();
+}
+inline int SweepParameter::values_size() const {
+  return _internal_values_size();
+}
+inline void SweepParameter::clear_values() {
+  _impl_.values_.Clear();
+}
+inline std::string* SweepParameter::add_values() {
+  std::string* _s = _internal_add_values();
+  // @@protoc_insertion_point(field_add_mutable:ns3_proto.SweepParameter.values)
+  return _s;
+}
+inline const std::string& SweepParameter::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
+}
+inline const std::string& SweepParameter::values(int index) const {
+  // @@protoc_insertion_point(field_get:ns3_proto.SweepParameter.values)
+  return _internal_values(index);
+}
+inline std::string* SweepParameter::mutable_values(int index) {
+  // @@protoc_insertion_point(field_mutable:ns3_proto.SweepParameter.values)
+  return _impl_.values_.Mutable(index);
+}
+inline void SweepParameter::set_values(int index, const std::string& value) {
+  _impl_.values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ns3_proto.SweepParameter.values)
+}
+inline void SweepParameter::set_values(int index, std::string&& value) {
+  _impl_.values_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ns3_proto.SweepParameter.values)
+}
+inline void SweepParameter::set_values(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ns3_proto.SweepParameter.values)
+}
+inline void SweepParameter::set_values(int index, const char* value, size_t size) {
+  _impl_.values_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ns3_proto.SweepParameter.values)
+}
+inline std::string* SweepParameter::_internal_add_values() {
+  return _impl_.values_.Add();
+}
+inline void SweepParameter::add_values(const std::string& value) {
+  _impl_.values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ns3_proto.SweepParameter.values)
+}
+inline void SweepParameter::add_values(std::string&& value) {
+  _impl_.values_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ns3_proto.SweepParameter.values)
+}
+inline void SweepParameter::add_values(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ns3_proto.SweepParameter.values)
+}
+inline void SweepParameter::add_values(const char* value, size_t size) {
+  _impl_.values_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ns3_proto.SweepParameter.values)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SweepParameter::values() const {
+  // @@protoc_insertion_point(field_list:ns3_proto.SweepParameter.values)
+  return _impl_.values_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SweepParameter::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:ns3_proto.SweepParameter.values)
+  return &_impl_.values_;
 }
 
-// .ns3_proto.Topology topology = 2;
-inline bool Configurations::_internal_has_topology() const {
-  return this != internal_default_instance() && _impl_.topology_ != nullptr;
+// -------------------------------------------------------------------
+
+// Sweep
+
+// .ns3_proto.Configurations base = 1;
+inline bool Sweep::_internal_has_base() const {
+  return this != internal_default_instance() && _impl_.base_ != nullptr;
 }
-inline bool Configurations::has_topology() const {
-  return _internal_has_topology();
+inline bool Sweep::has_base() const {
+  return _internal_has_base();
 }
-inline void Configurations::clear_topology() {
-  if (GetArenaForAllocation() == nullptr && _impl_.topology_ != nullptr) {
-    delete _impl_.topology_;
+inline void Sweep::clear_base() {
+  if (GetArenaForAllocation() == nullptr && _impl_.base_ != nullptr) {
+    delete _impl_.base_;
   }
-  _impl_.topology_ = nullptr;
+  _impl_.base_ = nullptr;
 }
-inline const ::ns3_proto::Topology& Configurations::_internal_topology() const {
-  const ::ns3_proto::Topology* p = _impl_.topology_;
-  return p != nullptr ? *p : reinterpret_cast<const ::ns3_proto::Topology&>(
-      ::ns3_proto::_Topology_default_instance_);
+inline const ::ns3_proto::Configurations& Sweep::_internal_base() const {
+  const ::ns3_proto::Configurations* p = _impl_.base_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ns3_proto::Configurations&>(
+      ::ns3_proto::_Configurations_default_instance_);
 }
-inline const ::ns3_proto::Topology& Configurations::topology() const {
-  // @@protoc_insertion_point(field_get:ns3_proto.Configurations.topology)
-  return _internal_topology();
+inline const ::ns3_proto::Configurations& Sweep::base() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.Sweep.base)
+  return _internal_base();
 }
-inline void Configurations::unsafe_arena_set_allocated_topology(
-    ::ns3_proto::Topology* topology) {
+inline void Sweep::unsafe_arena_set_allocated_base(
+    ::ns3_proto::Configurations* base) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.topology_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.base_);
   }
-  _impl_.topology_ = topology;
-  if (topology) {
+  _impl_.base_ = base;
+  if (base) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3_proto.Configurations.topology)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3_proto.Sweep.base)
 }
-inline ::ns3_proto::Topology* Configurations::release_topology() {
+inline ::ns3_proto::Configurations* Sweep::release_base() {
   
-  ::ns3_proto::Topology* temp = _impl_.topology_;
-  _impl_.topology_ = nullptr;
+  ::ns3_proto::Configurations* temp = _impl_.base_;
+  _impl_.base_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -3941,84 +5941,387 @@ inline ::ns3_proto::Topology* Configurations::release_topology() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::ns3_proto::Topology* Configurations::unsafe_arena_release_topology() {
-  // @@protoc_insertion_point(field_release:ns3_proto.Configurations.topology)
+inline ::ns3_proto::Configurations* Sweep::unsafe_arena_release_base() {
+  // @@protoc_insertion_point(field_release:ns3_proto.Sweep.base)
   
-  ::ns3_proto::Topology* temp = _impl_.topology_;
-  _impl_.topology_ = nullptr;
+  ::ns3_proto::Configurations* temp = _impl_.base_;
+  _impl_.base_ = nullptr;
   return temp;
 }
-inline ::ns3_proto::Topology* Configurations::_internal_mutable_topology() {
+inline ::ns3_proto::Configurations* Sweep::_internal_mutable_base() {
   
-  if (_impl_.topology_ == nullptr) {
-    auto* p = CreateMaybeMessage<::ns3_proto::Topology>(GetArenaForAllocation());
-    _impl_.topology_ = p;
+  if (_impl_.base_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ns3_proto::Configurations>(GetArenaForAllocation());
+    _impl_.base_ = p;
   }
-  return _impl_.topology_;
+  return _impl_.base_;
 }
-inline ::ns3_proto::Topology* Configurations::mutable_topology() {
-  ::ns3_proto::Topology* _msg = _internal_mutable_topology();
-  // @@protoc_insertion_point(field_mutable:ns3_proto.Configurations.topology)
+inline ::ns3_proto::Configurations* Sweep::mutable_base() {
+  ::ns3_proto::Configurations* _msg = _internal_mutable_base();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.Sweep.base)
   return _msg;
 }
-inline void Configurations::set_allocated_topology(::ns3_proto::Topology* topology) {
+inline void Sweep::set_allocated_base(::ns3_proto::Configurations* base) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.topology_;
+    delete _impl_.base_;
   }
-  if (topology) {
+  if (base) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(topology);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(base);
     if (message_arena != submessage_arena) {
-      topology = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, topology, submessage_arena);
+      base = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, base, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.topology_ = topology;
-  // @@protoc_insertion_point(field_set_allocated:ns3_proto.Configurations.topology)
+  _impl_.base_ = base;
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.Sweep.base)
 }
 
-// repeated .ns3_proto.Application applications = 3;
-inline int Configurations::_internal_applications_size() const {
-  return _impl_.applications_.size();
+// repeated .ns3_proto.SweepParameter parameters = 2;
+inline int Sweep::_internal_parameters_size() const {
+  return _impl_.parameters_.size();
 }
-inline int Configurations::applications_size() const {
-  return _internal_applications_size();
+inline int Sweep::parameters_size() const {
+  return _internal_parameters_size();
 }
-inline void Configurations::clear_applications() {
-  _impl_.applications_.Clear();
+inline void Sweep::clear_parameters() {
+  _impl_.parameters_.Clear();
 }
-inline ::ns3_proto::Application* Configurations::mutable_applications(int index) {
-  // @@protoc_insertion_point(field_mutable:ns3_proto.Configurations.applications)
-  return _impl_.applications_.Mutable(index);
+inline ::ns3_proto::SweepParameter* Sweep::mutable_parameters(int index) {
+  // @@protoc_insertion_point(field_mutable:ns3_proto.Sweep.parameters)
+  return _impl_.parameters_.Mutable(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Application >*
-Configurations::mutable_applications() {
-  // @@protoc_insertion_point(field_mutable_list:ns3_proto.Configurations.applications)
-  return &_impl_.applications_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SweepParameter >*
+Sweep::mutable_parameters() {
+  // @@protoc_insertion_point(field_mutable_list:ns3_proto.Sweep.parameters)
+  return &_impl_.parameters_;
 }
-inline const ::ns3_proto::Application& Configurations::_internal_applications(int index) const {
-  return _impl_.applications_.Get(index);
+inline const ::ns3_proto::SweepParameter& Sweep::_internal_parameters(int index) const {
+  return _impl_.parameters_.Get(index);
 }
-inline const ::ns3_proto::Application& Configurations::applications(int index) const {
-  // @@protoc_insertion_point(field_get:ns3_proto.Configurations.applications)
-  return _internal_applications(index);
+inline const ::ns3_proto::SweepParameter& Sweep::parameters(int index) const {
+  // @@protoc_insertion_point(field_get:ns3_proto.Sweep.parameters)
+  return _internal_parameters(index);
 }
-inline ::ns3_proto::Application* Configurations::_internal_add_applications() {
-  return _impl_.applications_.Add();
+inline ::ns3_proto::SweepParameter* Sweep::_internal_add_parameters() {
+  return _impl_.parameters_.Add();
 }
-inline ::ns3_proto::Application* Configurations::add_applications() {
-  ::ns3_proto::Application* _add = _internal_add_applications();
-  // @@protoc_insertion_point(field_add:ns3_proto.Configurations.applications)
+inline ::ns3_proto::SweepParameter* Sweep::add_parameters() {
+  ::ns3_proto::SweepParameter* _add = _internal_add_parameters();
+  // @@protoc_insertion_point(field_add:ns3_proto.Sweep.parameters)
   return _add;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::Application >&
-Configurations::applications() const {
-  // @@protoc_insertion_point(field_list:ns3_proto.Configurations.applications)
-  return _impl_.applications_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3_proto::SweepParameter >&
+Sweep::parameters() const {
+  // @@protoc_insertion_point(field_list:ns3_proto.Sweep.parameters)
+  return _impl_.parameters_;
+}
+
+// uint32 runs = 3;
+inline void Sweep::clear_runs() {
+  _impl_.runs_ = 0u;
+}
+inline uint32_t Sweep::_internal_runs() const {
+  return _impl_.runs_;
+}
+inline uint32_t Sweep::runs() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.Sweep.runs)
+  return _internal_runs();
+}
+inline void Sweep::_internal_set_runs(uint32_t value) {
+  
+  _impl_.runs_ = value;
+}
+inline void Sweep::set_runs(uint32_t value) {
+  _internal_set_runs(value);
+  // @@protoc_insertion_point(field_set:ns3_proto.Sweep.runs)
+}
+
+// string outputDir = 4;
+inline void Sweep::clear_outputdir() {
+  _impl_.outputdir_.ClearToEmpty();
+}
+inline const std::string& Sweep::outputdir() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.Sweep.outputDir)
+  return _internal_outputdir();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Sweep::set_outputdir(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.outputdir_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3_proto.Sweep.outputDir)
+}
+inline std::string* Sweep::mutable_outputdir() {
+  std::string* _s = _internal_mutable_outputdir();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.Sweep.outputDir)
+  return _s;
+}
+inline const std::string& Sweep::_internal_outputdir() const {
+  return _impl_.outputdir_.Get();
+}
+inline void Sweep::_internal_set_outputdir(const std::string& value) {
+  
+  _impl_.outputdir_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Sweep::_internal_mutable_outputdir() {
+  
+  return _impl_.outputdir_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Sweep::release_outputdir() {
+  // @@protoc_insertion_point(field_release:ns3_proto.Sweep.outputDir)
+  return _impl_.outputdir_.Release();
+}
+inline void Sweep::set_allocated_outputdir(std::string* outputdir) {
+  if (outputdir != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.outputdir_.SetAllocated(outputdir, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.outputdir_.IsDefault()) {
+    _impl_.outputdir_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.Sweep.outputDir)
+}
+
+// string stopTime = 5;
+inline void Sweep::clear_stoptime() {
+  _impl_.stoptime_.ClearToEmpty();
+}
+inline const std::string& Sweep::stoptime() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.Sweep.stopTime)
+  return _internal_stoptime();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Sweep::set_stoptime(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.stoptime_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3_proto.Sweep.stopTime)
+}
+inline std::string* Sweep::mutable_stoptime() {
+  std::string* _s = _internal_mutable_stoptime();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.Sweep.stopTime)
+  return _s;
+}
+inline const std::string& Sweep::_internal_stoptime() const {
+  return _impl_.stoptime_.Get();
+}
+inline void Sweep::_internal_set_stoptime(const std::string& value) {
+  
+  _impl_.stoptime_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Sweep::_internal_mutable_stoptime() {
+  
+  return _impl_.stoptime_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Sweep::release_stoptime() {
+  // @@protoc_insertion_point(field_release:ns3_proto.Sweep.stopTime)
+  return _impl_.stoptime_.Release();
+}
+inline void Sweep::set_allocated_stoptime(std::string* stoptime) {
+  if (stoptime != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.stoptime_.SetAllocated(stoptime, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.stoptime_.IsDefault()) {
+    _impl_.stoptime_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.Sweep.stopTime)
+}
+
+// optional string lineRate = 6;
+inline bool Sweep::_internal_has_linerate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Sweep::has_linerate() const {
+  return _internal_has_linerate();
+}
+inline void Sweep::clear_linerate() {
+  _impl_.linerate_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Sweep::linerate() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.Sweep.lineRate)
+  return _internal_linerate();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Sweep::set_linerate(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.linerate_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3_proto.Sweep.lineRate)
+}
+inline std::string* Sweep::mutable_linerate() {
+  std::string* _s = _internal_mutable_linerate();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.Sweep.lineRate)
+  return _s;
+}
+inline const std::string& Sweep::_internal_linerate() const {
+  return _impl_.linerate_.Get();
+}
+inline void Sweep::_internal_set_linerate(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.linerate_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Sweep::_internal_mutable_linerate() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.linerate_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Sweep::release_linerate() {
+  // @@protoc_insertion_point(field_release:ns3_proto.Sweep.lineRate)
+  if (!_internal_has_linerate()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.linerate_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.linerate_.IsDefault()) {
+    _impl_.linerate_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Sweep::set_allocated_linerate(std::string* linerate) {
+  if (linerate != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.linerate_.SetAllocated(linerate, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.linerate_.IsDefault()) {
+    _impl_.linerate_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.Sweep.lineRate)
+}
+
+// optional string baseRtt = 7;
+inline bool Sweep::_internal_has_basertt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Sweep::has_basertt() const {
+  return _internal_has_basertt();
+}
+inline void Sweep::clear_basertt() {
+  _impl_.basertt_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Sweep::basertt() const {
+  // @@protoc_insertion_point(field_get:ns3_proto.Sweep.baseRtt)
+  return _internal_basertt();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Sweep::set_basertt(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.basertt_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3_proto.Sweep.baseRtt)
+}
+inline std::string* Sweep::mutable_basertt() {
+  std::string* _s = _internal_mutable_basertt();
+  // @@protoc_insertion_point(field_mutable:ns3_proto.Sweep.baseRtt)
+  return _s;
+}
+inline const std::string& Sweep::_internal_basertt() const {
+  return _impl_.basertt_.Get();
+}
+inline void Sweep::_internal_set_basertt(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.basertt_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Sweep::_internal_mutable_basertt() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.basertt_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Sweep::release_basertt() {
+  // @@protoc_insertion_point(field_release:ns3_proto.Sweep.baseRtt)
+  if (!_internal_has_basertt()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.basertt_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.basertt_.IsDefault()) {
+    _impl_.basertt_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Sweep::set_allocated_basertt(std::string* basertt) {
+  if (basertt != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.basertt_.SetAllocated(basertt, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.basertt_.IsDefault()) {
+    _impl_.basertt_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3_proto.Sweep.baseRtt)
+}
+
+// repeated uint64 fctSizeBins = 8;
+inline int Sweep::_internal_fctsizebins_size() const {
+  return _impl_.fctsizebins_.size();
+}
+inline int Sweep::fctsizebins_size() const {
+  return _internal_fctsizebins_size();
+}
+inline void Sweep::clear_fctsizebins() {
+  _impl_.fctsizebins_.Clear();
+}
+inline uint64_t Sweep::_internal_fctsizebins(int index) const {
+  return _impl_.fctsizebins_.Get(index);
+}
+inline uint64_t Sweep::fctsizebins(int index) const {
+  // @@protoc_insertion_point(field_get:ns3_proto.Sweep.fctSizeBins)
+  return _internal_fctsizebins(index);
+}
+inline void Sweep::set_fctsizebins(int index, uint64_t value) {
+  _impl_.fctsizebins_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ns3_proto.Sweep.fctSizeBins)
+}
+inline void Sweep::_internal_add_fctsizebins(uint64_t value) {
+  _impl_.fctsizebins_.Add(value);
+}
+inline void Sweep::add_fctsizebins(uint64_t value) {
+  _internal_add_fctsizebins(value);
+  // @@protoc_insertion_point(field_add:ns3_proto.Sweep.fctSizeBins)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Sweep::_internal_fctsizebins() const {
+  return _impl_.fctsizebins_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Sweep::fctsizebins() const {
+  // @@protoc_insertion_point(field_list:ns3_proto.Sweep.fctSizeBins)
+  return _internal_fctsizebins();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Sweep::_internal_mutable_fctsizebins() {
+  return &_impl_.fctsizebins_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Sweep::mutable_fctsizebins() {
+  // @@protoc_insertion_point(field_mutable_list:ns3_proto.Sweep.fctSizeBins)
+  return _internal_mutable_fctsizebins();
 }
 
 #ifdef __GNUC__
@@ -4044,11 +6347,29 @@ Configurations::applications() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace ns3_proto
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::ns3_proto::LoadBalanceConfig_Mode> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ns3_proto::LoadBalanceConfig_Mode>() {
+  return ::ns3_proto::LoadBalanceConfig_Mode_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
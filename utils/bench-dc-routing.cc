@@ -0,0 +1,204 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+// This program measures the startup time of route population on a k-ary
+// fat-tree: the BFS of DcRoutingHelper against the SPF of
+// Ipv4GlobalRoutingHelper, and checks that both find the same ECMP groups
+// towards every host.
+// Sample usage:  ./ns3 run 'bench-dc-routing --k=16'
+//                ./ns3 run 'bench-dc-routing --k=32 --global=false'
+
+#include "ns3/command-line.h"
+#include "ns3/dc-routing-helper.h"
+#include "ns3/dc-topology.h"
+#include "ns3/global-route-manager.h"
+#include "ns3/global-router-interface.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv4-global-routing.h"
+#include "ns3/ipv4-global-routing-helper.h"
+#include "ns3/point-to-point-helper.h"
+#include "ns3/system-wall-clock-ms.h"
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <vector>
+
+using namespace ns3;
+
+typedef std::map<Ipv4Address, std::vector<uint32_t>> EcmpGroups;
+
+/**
+ * Build a k-ary fat-tree, hosts first then switches as the protobuf loader
+ * does, with all interfaces numbered from one /8.
+ */
+static Ptr<DcTopology>
+BuildFatTree (uint32_t k, std::vector<Ipv4Address> &hostAddresses)
+{
+  const uint32_t half = k / 2;
+  const uint32_t nHosts = k * half * half;
+  const uint32_t nEdges = k * half;
+  const uint32_t nAggs = k * half;
+  const uint32_t nCores = half * half;
+  const uint32_t edgeBase = nHosts;
+  const uint32_t aggBase = edgeBase + nEdges;
+  const uint32_t coreBase = aggBase + nAggs;
+  Ptr<DcTopology> topology = CreateObject<DcTopology> (coreBase + nCores);
+
+  NodeContainer nodes;
+  nodes.Create (coreBase + nCores);
+  InternetStackHelper stack;
+  stack.Install (nodes);
+  for (uint32_t i = 0; i < nodes.GetN (); i++)
+    {
+      DcTopology::TopoNode node{i < nHosts ? DcTopology::TopoNode::HOST
+                                           : DcTopology::TopoNode::SWITCH,
+                                nodes.Get (i)};
+      topology->InstallNode (i, node);
+    }
+
+  PointToPointHelper p2p;
+  Ipv4AddressHelper address ("10.0.0.0", "255.0.0.0");
+  auto connect = [&] (uint32_t a, uint32_t b) {
+    NetDeviceContainer devices = p2p.Install (nodes.Get (a), nodes.Get (b));
+    Ipv4InterfaceContainer interfaces = address.Assign (devices);
+    topology->InstallLink (a, b);
+    return interfaces.GetAddress (0);
+  };
+  for (uint32_t pod = 0; pod < k; pod++)
+    {
+      for (uint32_t e = 0; e < half; e++)
+        {
+          const uint32_t edge = edgeBase + pod * half + e;
+          for (uint32_t h = 0; h < half; h++)
+            {
+              hostAddresses.push_back (connect ((pod * half + e) * half + h, edge));
+            }
+          for (uint32_t a = 0; a < half; a++)
+            {
+              connect (edge, aggBase + pod * half + a);
+            }
+        }
+      for (uint32_t a = 0; a < half; a++)
+        {
+          for (uint32_t c = 0; c < half; c++)
+            {
+              connect (aggBase + pod * half + a, coreBase + a * half + c);
+            }
+        }
+    }
+  return topology;
+}
+
+/**
+ * Get the ECMP groups towards hosts of every switch, with the interfaces
+ * sorted since the two methods install the routes in different orders.
+ */
+static std::vector<EcmpGroups>
+GetSwitchGroups (Ptr<DcTopology> topology, const std::vector<Ipv4Address> &hostAddresses)
+{
+  std::vector<EcmpGroups> groups;
+  for (uint32_t i = 0; i < topology->GetNNodes (); i++)
+    {
+      if (topology->IsHost (i))
+        {
+          continue;
+        }
+      Ptr<GlobalRouter> router = topology->GetNode (i)->GetObject<GlobalRouter> ();
+      EcmpGroups all = router->GetRoutingProtocol ()->GetHostRouteInterfaces ();
+      groups.emplace_back ();
+      for (const Ipv4Address &addr : hostAddresses)
+        {
+          std::vector<uint32_t> &group = groups.back ()[addr];
+          group = all[addr];
+          std::sort (group.begin (), group.end ());
+        }
+    }
+  return groups;
+}
+
+static uint32_t
+CountRoutes (Ptr<DcTopology> topology)
+{
+  uint32_t n = 0;
+  for (uint32_t i = 0; i < topology->GetNNodes (); i++)
+    {
+      Ptr<GlobalRouter> router = topology->GetNode (i)->GetObject<GlobalRouter> ();
+      n += router->GetRoutingProtocol ()->GetNRoutes ();
+    }
+  return n;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t k = 8;
+  bool global = true;
+
+  CommandLine cmd (__FILE__);
+  cmd.Usage ("Benchmark route population on a k-ary fat-tree");
+  cmd.AddValue ("k", "number of ports of each switch of the fat-tree", k);
+  cmd.AddValue ("global", "also run Ipv4GlobalRoutingHelper and compare the routes", global);
+  cmd.Parse (argc, argv);
+
+  if (k < 2 || k % 2 != 0)
+    {
+      std::cerr << "Error-- k must be an even number of at least 2, e.g., --k=16" << std::endl;
+      return 1;
+    }
+
+  SystemWallClockMs time;
+  time.Start ();
+  std::vector<Ipv4Address> hostAddresses;
+  Ptr<DcTopology> topology = BuildFatTree (k, hostAddresses);
+  uint64_t buildMs = time.End ();
+  std::cout << "Running bench-dc-routing with k=" << k << " (" << hostAddresses.size ()
+            << " hosts, " << topology->GetNNodes () << " nodes)" << std::endl
+            << buildMs << " ms\ttopology built" << std::endl;
+
+  time.Start ();
+  DcRoutingHelper::PopulateRoutingTables (topology);
+  uint64_t bfsMs = time.End ();
+  std::cout << bfsMs << " ms\tDcRoutingHelper (" << CountRoutes (topology) << " routes)"
+            << std::endl;
+
+  if (global)
+    {
+      std::vector<EcmpGroups> bfsGroups = GetSwitchGroups (topology, hostAddresses);
+      GlobalRouteManager::DeleteGlobalRoutes ();
+
+      time.Start ();
+      Ipv4GlobalRoutingHelper::PopulateRoutingTables ();
+      uint64_t spfMs = time.End ();
+      std::cout << spfMs << " ms\tIpv4GlobalRoutingHelper (" << CountRoutes (topology)
+                << " routes)" << std::endl;
+
+      std::vector<EcmpGroups> spfGroups = GetSwitchGroups (topology, hostAddresses);
+      uint32_t mismatches = 0;
+      for (std::size_t i = 0; i < bfsGroups.size (); i++)
+        {
+          for (const auto &group : bfsGroups[i])
+            {
+              mismatches += group.second != spfGroups[i][group.first];
+            }
+        }
+      std::cout << mismatches << " of " << bfsGroups.size () * hostAddresses.size ()
+                << " switch ECMP groups towards hosts differ" << std::endl;
+    }
+
+  return 0;
+}
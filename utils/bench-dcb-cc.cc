@@ -0,0 +1,191 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+// This program compares the congestion controls of RoCEv2 on one Protobuf
+// configurations, e.g., generated by config/dumbell_topo.py or
+// config/fat-tree.py: each congestion control runs the same configurations in
+// a forked process, which reports the FCT of all flows and the simulator
+// events per second.  The FCT summary by flow size of each run is written
+// into the output directory as <congestion control>-fct.csv.
+// Sample usage:  ./ns3 run 'bench-dcb-cc --conf=config/configurations.bin'
+//                ./ns3 run 'bench-dcb-cc --cc=ns3::DcqcnCongestionOps,ns3::SwiftCongestionOps'
+
+#include "ns3/command-line.h"
+#include "ns3/config.h"
+#include "ns3/configurations-loader.h"
+#include "ns3/fct-statistics.h"
+#include "ns3/rocev2-socket.h"
+#include "ns3/simulator.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/tracer-extension.h"
+#include "ns3/type-id.h"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace ns3;
+
+/**
+ * Run the configurations with one congestion control and print a row of results.
+ */
+static void
+RunOne (const ns3_proto::Configurations &conf, const std::string &cc, const std::string &outDir,
+        Time baseRtt)
+{
+  Config::SetDefault ("ns3::RoCEv2Socket::CongestionControl",
+                      TypeIdValue (TypeId::LookupByName (cc)));
+
+  std::vector<uint64_t> sizeBins;
+  Time stopTime;
+  for (const ns3_proto::Application &app : conf.applications ())
+    {
+      TraceApplication::TraceCdf *cdf =
+          app.has_arg () ? configurations::GetTraceCdf (app.arg ()) : nullptr;
+      if (cdf && sizeBins.empty ())
+        {
+          sizeBins = FctStatistics::GetSizeBins (*cdf);
+        }
+      stopTime = std::max (stopTime, Time (app.stoptime ()));
+    }
+  if (conf.topology ().links_size () == 0)
+    {
+      NS_FATAL_ERROR ("The configurations have no link to get the line rate from");
+    }
+  const DataRate lineRate (conf.topology ().links (0).rate ());
+  const std::string summaryName = cc.substr (cc.find_last_of (':') + 1) + "-fct.csv";
+
+  SystemWallClockMs time;
+  time.Start ();
+  Ptr<DcTopology> topology = configurations::LoadTopology (conf);
+  tracer_extension::ConfigOutputDirectory (outDir);
+  configurations::InstallApplications (conf, topology);
+  if (baseRtt.IsStrictlyPositive ())
+    {
+      tracer_extension::ConfigFctStatistics (tracer_extension::Protocol::RoCEv2, summaryName,
+                                             sizeBins, lineRate, baseRtt);
+    }
+  else
+    {
+      tracer_extension::ConfigFctStatistics (tracer_extension::Protocol::RoCEv2, summaryName,
+                                             sizeBins, lineRate,
+                                             configurations::GetPathBaseRtt (conf, topology));
+    }
+  tracer_extension::ConfigStopTime (stopTime);
+  const int64_t loadMs = time.End ();
+
+  time.Start ();
+  Simulator::Stop (stopTime);
+  Simulator::Run ();
+  const int64_t runMs = time.End ();
+  const uint64_t events = Simulator::GetEventCount ();
+  Simulator::Destroy ();
+  tracer_extension::CleanTracers ();
+
+  // The last row of the summary is of all flows
+  std::ifstream summary (outDir + "/" + summaryName);
+  std::string line, all = "all,0";
+  while (std::getline (summary, line))
+    {
+      all = line;
+    }
+  std::istringstream fields (all.substr (all.find (',') + 1));
+  std::vector<std::string> values;
+  while (std::getline (fields, line, ','))
+    {
+      values.push_back (line);
+    }
+  values.resize (11, "-");
+
+  std::cout << std::left << std::setw (28) << cc << std::right << std::setw (10) << values[0]
+            << std::setw (12) << values[1] << std::setw (12) << values[4] << std::setw (12)
+            << values[6] << std::setw (12) << values[9] << std::setw (10) << loadMs
+            << std::setw (10) << runMs << std::setw (14) << events << std::setw (14)
+            << (runMs ? events * 1000 / runMs : 0) << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  std::string confFile = configurations::protoBinaryName;
+  std::string ccList = "ns3::DcqcnCongestionOps,ns3::HpccCongestionOps,"
+                       "ns3::TimelyCongestionOps,ns3::SwiftCongestionOps";
+  std::string outDir = "data";
+  Time baseRtt;
+
+  CommandLine cmd (__FILE__);
+  cmd.Usage ("Compare the FCT and simulation speed of RoCEv2 congestion controls");
+  cmd.AddValue ("conf", "the Protobuf configurations to run", confFile);
+  cmd.AddValue ("cc", "comma-separated TypeIds of the congestion controls", ccList);
+  cmd.AddValue ("outputDir", "directory of the FCT summaries", outDir);
+  cmd.AddValue ("baseRtt",
+                "RTT without queuing for the slowdown of all flows, that of each path if zero",
+                baseRtt);
+  cmd.Parse (argc, argv);
+
+  ns3_proto::Configurations conf = configurations::LoadConfigurations (confFile);
+  // Only the switches with INT enabled write the hops HPCC needs.  They do it
+  // only for the packets with an INT trailer, so the others run as before.
+  for (ns3_proto::SwitchGroup &group :
+       *conf.mutable_topology ()->mutable_nodes ()->mutable_switchgroups ())
+    {
+      group.set_intenabled (true);
+    }
+  std::cout << "Running bench-dcb-cc with " << conf.topology ().nodes ().num () << " nodes and "
+            << conf.topology ().links_size () << " links" << std::endl
+            << std::left << std::setw (28) << "congestion control" << std::right << std::setw (10)
+            << "flows" << std::setw (12) << "fct mean" << std::setw (12) << "fct p99"
+            << std::setw (12) << "slow mean" << std::setw (12) << "slow p99" << std::setw (10)
+            << "load ms" << std::setw (10) << "run ms" << std::setw (14) << "events"
+            << std::setw (14) << "events/s" << std::endl;
+
+  std::istringstream ccs (ccList);
+  std::string cc;
+  while (std::getline (ccs, cc, ','))
+    {
+      TypeId tid;
+      if (!TypeId::LookupByNameFailSafe (cc, &tid) ||
+          !tid.IsChildOf (RoCEv2CongestionOps::GetTypeId ()))
+        {
+          std::cerr << "Error-- " << cc << " is not a RoCEv2CongestionOps" << std::endl;
+          return 1;
+        }
+      // A process per run so that every run starts from the same state
+      std::cout.flush ();
+      const pid_t pid = fork ();
+      if (pid < 0)
+        {
+          std::cerr << "Error-- cannot fork" << std::endl;
+          return 1;
+        }
+      if (pid == 0)
+        {
+          RunOne (conf, cc, outDir, baseRtt);
+          std::cout.flush ();
+          _exit (0);
+        }
+      int status;
+      waitpid (pid, &status, 0);
+      if (!WIFEXITED (status) || WEXITSTATUS (status) != 0)
+        {
+          std::cerr << "Error-- the run of " << cc << " failed" << std::endl;
+        }
+    }
+  return 0;
+}
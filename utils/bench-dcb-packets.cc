@@ -0,0 +1,413 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+// This program measures the per-hop packet cost of a DCB switch pipeline
+// (channel copy, Ethernet header removal, priority and ingress port
+// bookkeeping, IPv4 header peek, Ethernet header re-add) for different
+// payload kinds, and for packet tags against the switch metadata slot.
+// It also measures the forwarding of a real switch with host routes to
+// --routes destinations, through Ipv4L3Protocol and through the fast path of
+// DcbTrafficControl.
+// Sample usage:  ./ns3 run 'bench-dcb-packets --n=100000 --hops=6 --routes=1024'
+
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/dcb-channel.h"
+#include "ns3/dcb-net-device.h"
+#include "ns3/dcb-switch-stack-helper.h"
+#include "ns3/dcb-traffic-control.h"
+#include "ns3/drop-tail-queue.h"
+#include "ns3/ethernet-header.h"
+#include "ns3/global-router-interface.h"
+#include "ns3/ipv4-global-routing.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/ipv4-l3-protocol.h"
+#include "ns3/ipv4.h"
+#include "ns3/packet.h"
+#include "ns3/rocev2-header.h"
+#include "ns3/simulator.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/tag.h"
+#include "ns3/udp-header.h"
+#include "ns3/udp-l4-protocol.h"
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+using namespace ns3;
+
+/// A fixed-size header standing for the IPv4 + UDP + RoCEv2 headers
+template <int N>
+class BenchHeader : public Header
+{
+public:
+  static TypeId GetTypeId (void) {
+    std::ostringstream oss;
+    oss << "ns3::BenchDcbHeader<" << N << ">";
+    static TypeId tid = TypeId (oss.str ())
+      .SetParent<Header> ()
+      .SetGroupName ("Utils")
+      .HideFromDocumentation ()
+      .AddConstructor<BenchHeader<N> > ()
+      ;
+    return tid;
+  }
+  virtual TypeId GetInstanceTypeId (void) const {
+    return GetTypeId ();
+  }
+  virtual void Print (std::ostream &os) const {
+    os << "N=" << N;
+  }
+  virtual uint32_t GetSerializedSize (void) const {
+    return N;
+  }
+  virtual void Serialize (Buffer::Iterator start) const {
+    start.WriteU8 (N, N);
+  }
+  virtual uint32_t Deserialize (Buffer::Iterator start) {
+    start.Next (N);
+    return N;
+  }
+};
+
+/// A packet tag standing for the former CoSTag and DeviceIndexTag
+template <int N>
+class BenchTag : public Tag
+{
+public:
+  static TypeId GetTypeId (void) {
+    std::ostringstream oss;
+    oss << "anon::BenchDcbTag<" << N << ">";
+    static TypeId tid = TypeId (oss.str ())
+      .SetParent<Tag> ()
+      .SetGroupName ("Utils")
+      .HideFromDocumentation ()
+      .AddConstructor<BenchTag<N> > ()
+      ;
+    return tid;
+  }
+  virtual TypeId GetInstanceTypeId (void) const {
+    return GetTypeId ();
+  }
+  virtual uint32_t GetSerializedSize (void) const {
+    return N;
+  }
+  virtual void Serialize (TagBuffer buf) const {
+    for (uint32_t i = 0; i < N; ++i)
+      {
+        buf.WriteU8 (N);
+      }
+  }
+  virtual void Deserialize (TagBuffer buf) {
+    for (uint32_t i = 0; i < N; ++i)
+      {
+        buf.ReadU8 ();
+      }
+  }
+  virtual void Print (std::ostream &os) const {
+    os << "N=" << N;
+  }
+};
+
+static const uint32_t PAYLOAD_SIZE = 1000; // TraceApplication::MSS
+static uint32_t g_hops = 6;                // host - ToR - Agg - Core - Agg - ToR - host
+static uint32_t g_routes = 1024;           // hosts of a k=16 fat-tree
+static const uint32_t SWITCH_PORTS = 8;
+static const uint32_t HOST_BASE = 0x0a000001; // 10.0.0.1, the first destination
+static Ptr<Node> g_switch;
+
+/**
+ * One hop through a DCB switch.
+ * \param p the packet on the wire, with Ethernet header
+ * \param rxCopy whether DcbNetDevice copies the packet for its MacRx trace
+ * \param tags whether the priority and ingress port are carried by packet tags
+ *        rather than by Packet::SwitchMetadata
+ * \return the packet sent to the next hop
+ */
+static Ptr<Packet>
+Hop (Ptr<Packet> p, bool rxCopy, bool tags)
+{
+  EthernetHeader eth;
+  BenchHeader<20 + 8 + 12> ipUdpRoce;
+  BenchTag<1> cosTag;
+  BenchTag<4> devTag;
+
+  Ptr<Packet> rx = p->Copy (); // DcbChannel::TransmitStart
+  if (rxCopy)
+    {
+      Ptr<Packet> traced = rx->Copy (); // DcbNetDevice::Receive, before the change
+    }
+  rx->RemoveHeader (eth);
+  if (tags)
+    {
+      rx->AddPacketTag (cosTag); // DcbTrafficControl::Receive
+      rx->AddPacketTag (devTag);
+      rx->PeekHeader (ipUdpRoce); // IPv4 forwarding
+      rx->RemovePacketTag (cosTag); // PausableQueueDisc::DoEnqueue
+      rx->RemovePacketTag (devTag); // DcbTrafficControl::EgressProcess
+    }
+  else
+    {
+      Packet::SwitchMetadata metadata; // DcbTrafficControl::Receive
+      metadata.ingressPort = 1;
+      metadata.priority = 3;
+      metadata.valid = true;
+      rx->SetSwitchMetadata (metadata);
+      rx->PeekHeader (ipUdpRoce); // IPv4 forwarding
+      metadata = rx->GetSwitchMetadata (); // PausableQueueDisc::DoEnqueue
+      metadata.valid = false; // DcbTrafficControl::EgressProcess
+      rx->SetSwitchMetadata (metadata);
+    }
+  rx->AddHeader (eth); // DcbNetDevice::Send
+  return rx;
+}
+
+static Ptr<Packet>
+NewPacket (bool materialized)
+{
+  static std::vector<uint8_t> bytes (PAYLOAD_SIZE, 0);
+  Ptr<Packet> p = materialized ? Create<Packet> (bytes.data (), PAYLOAD_SIZE)
+                               : Create<Packet> (PAYLOAD_SIZE);
+  p->AddHeader (BenchHeader<20 + 8 + 12> ());
+  p->AddHeader (EthernetHeader ());
+  return p;
+}
+
+static void
+benchMaterialized (uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++)
+    {
+      Ptr<Packet> p = NewPacket (true);
+      for (uint32_t h = 0; h < g_hops; h++)
+        {
+          p = Hop (p, true, true);
+        }
+    }
+}
+
+static void
+benchVirtual (uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++)
+    {
+      Ptr<Packet> p = NewPacket (false);
+      for (uint32_t h = 0; h < g_hops; h++)
+        {
+          p = Hop (p, true, true);
+        }
+    }
+}
+
+static void
+benchVirtualNoRxCopy (uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++)
+    {
+      Ptr<Packet> p = NewPacket (false);
+      for (uint32_t h = 0; h < g_hops; h++)
+        {
+          p = Hop (p, false, true);
+        }
+    }
+}
+
+static void
+benchVirtualMetadata (uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++)
+    {
+      Ptr<Packet> p = NewPacket (false);
+      for (uint32_t h = 0; h < g_hops; h++)
+        {
+          p = Hop (p, false, false);
+        }
+    }
+}
+
+/**
+ * Create a switch whose port 0 receives the packets and whose other ports
+ * reach each destination through two equal-cost routes.  The other ports are
+ * linked to a sink node without protocols, which discards the packets.
+ */
+static void
+SetupSwitch (void)
+{
+  g_switch = CreateObject<Node> ();
+  for (uint32_t i = 0; i < SWITCH_PORTS; i++)
+    {
+      Ptr<DcbNetDevice> dev = CreateObject<DcbNetDevice> ();
+      dev->SetAddress (Mac48Address::Allocate ());
+      dev->SetQueue (CreateObject<DropTailQueue<Packet>> ());
+      g_switch->AddDevice (dev);
+    }
+  DcbSwitchStackHelper switchStack;
+  switchStack.Install (g_switch);
+
+  Ptr<Ipv4> ipv4 = g_switch->GetObject<Ipv4> ();
+  for (uint32_t i = 0; i < SWITCH_PORTS; i++)
+    {
+      int32_t interface = ipv4->GetInterfaceForDevice (g_switch->GetDevice (i));
+      if (interface == -1)
+        {
+          interface = ipv4->AddInterface (g_switch->GetDevice (i));
+        }
+      ipv4->AddAddress (interface, Ipv4InterfaceAddress (Ipv4Address (0x0b000001 + i), "255.0.0.0"));
+      ipv4->SetUp (interface);
+    }
+  Ptr<Ipv4GlobalRouting> routing = g_switch->GetObject<GlobalRouter> ()->GetRoutingProtocol ();
+  for (uint32_t r = 0; r < g_routes; r++)
+    {
+      // interface 0 is the loopback, and interface 1 the ingress port
+      routing->AddHostRouteTo (Ipv4Address (HOST_BASE + r), 2 + r % (SWITCH_PORTS - 1));
+      routing->AddHostRouteTo (Ipv4Address (HOST_BASE + r), 2 + (r + 1) % (SWITCH_PORTS - 1));
+    }
+  g_switch->GetObject<DcbTrafficControl> ()->BuildForwardingTable ();
+
+  Ptr<Node> sink = CreateObject<Node> ();
+  for (uint32_t i = 1; i < SWITCH_PORTS; i++)
+    {
+      Ptr<DcbNetDevice> dev = CreateObject<DcbNetDevice> ();
+      dev->SetAddress (Mac48Address::Allocate ());
+      dev->SetQueue (CreateObject<DropTailQueue<Packet>> ());
+      sink->AddDevice (dev);
+      Ptr<DcbChannel> channel = CreateObject<DcbChannel> ();
+      StaticCast<DcbNetDevice> (g_switch->GetDevice (i))->Attach (channel);
+      dev->Attach (channel);
+    }
+  g_switch->Initialize ();
+  sink->Initialize ();
+}
+
+/**
+ * Forward RoCEv2 packets of different flows and destinations through the
+ * switch, and run the simulator to transmit them after every g_hops packets.
+ */
+static void
+Forward (uint32_t n, bool fast)
+{
+  Ptr<DcbTrafficControl> tc = g_switch->GetObject<DcbTrafficControl> ();
+  tc->SetAttribute ("FastForwarding", BooleanValue (fast));
+  Ptr<NetDevice> ingress = g_switch->GetDevice (0);
+  const Mac48Address from = Mac48Address::Allocate ();
+  uint32_t k = 0;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      for (uint32_t h = 0; h < g_hops; h++, k++)
+        {
+          Ptr<Packet> p = Create<Packet> (PAYLOAD_SIZE);
+          RoCEv2Header roce;
+          roce.SetOpcode (RoCEv2Header::Opcode::RC_SEND_MIDDLE);
+          roce.SetSrcQP (k % 4096);
+          roce.SetDestQP (100);
+          p->AddHeader (roce);
+          UdpHeader udp;
+          udp.SetSourcePort (4791); // RoCEv2L4Protocol::PROT_NUMBER
+          udp.SetDestinationPort (4791);
+          p->AddHeader (udp);
+          Ipv4Header ip;
+          ip.SetSource (Ipv4Address (0x0a100001));
+          ip.SetDestination (Ipv4Address (HOST_BASE + (k * 7919) % g_routes));
+          ip.SetProtocol (UdpL4Protocol::PROT_NUMBER);
+          ip.SetTtl (64);
+          ip.SetPayloadSize (p->GetSize ());
+          p->AddHeader (ip);
+          tc->Receive (ingress, p, Ipv4L3Protocol::PROT_NUMBER, from, ingress->GetAddress (),
+                       NetDevice::PACKET_HOST);
+        }
+      Simulator::Run ();
+    }
+}
+
+static void
+benchForwardIpv4 (uint32_t n)
+{
+  Forward (n, false);
+}
+
+static void
+benchForwardFast (uint32_t n)
+{
+  Forward (n, true);
+}
+
+static uint64_t
+runBenchOneIteration (void (*bench) (uint32_t), uint32_t n)
+{
+  SystemWallClockMs time;
+  time.Start ();
+  (*bench) (n);
+  uint64_t deltaMs = time.End ();
+  return deltaMs;
+}
+
+static void
+runBench (void (*bench) (uint32_t), uint32_t n, uint32_t minIterations, char const *name)
+{
+  uint64_t minDelay = std::numeric_limits<uint64_t>::max ();
+  for (uint32_t i = 0; i < minIterations; i++)
+    {
+      uint64_t delay = runBenchOneIteration (bench, n);
+      minDelay = std::min (minDelay, delay);
+    }
+  minDelay = std::max<uint64_t> (minDelay, 1);
+  double nsPerHop = minDelay * 1e6 / (static_cast<double> (n) * g_hops);
+  std::cout << nsPerHop << " ns/hop"
+            << " (" << minDelay << " ms elapsed)\t"
+            << name
+            << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t n = 0;
+  uint32_t minIterations = 1;
+
+  CommandLine cmd (__FILE__);
+  cmd.Usage ("Benchmark the per-hop packet cost of the DCB pipeline");
+  cmd.AddValue ("n", "number of packets", n);
+  cmd.AddValue ("hops", "number of hops of each packet", g_hops);
+  cmd.AddValue ("routes", "number of host routes of the forwarding switch", g_routes);
+  cmd.AddValue ("min-iterations", "number of subiterations to minimize iteration time over", minIterations);
+  cmd.Parse (argc, argv);
+
+  if (n == 0 || g_hops == 0 || g_routes == 0)
+    {
+      std::cerr << "Error-- number of packets, hops and routes must be positive, "
+                << "e.g., --n=100000 --hops=6 --routes=1024" << std::endl;
+      return 1;
+    }
+  std::cout << "Running bench-dcb-packets with n=" << n << " hops=" << g_hops
+            << " routes=" << g_routes << std::endl;
+
+  runBench (&benchMaterialized, n, minIterations, "Materialized payload, MacRx copy");
+  runBench (&benchVirtual, n, minIterations, "Virtual payload, MacRx copy");
+  runBench (&benchVirtualNoRxCopy, n, minIterations, "Virtual payload, no MacRx copy, tags");
+  runBench (&benchVirtualMetadata, n, minIterations,
+            "Virtual payload, no MacRx copy, switch metadata");
+
+  SetupSwitch ();
+  runBench (&benchForwardIpv4, n, minIterations, "Switch forwarding through Ipv4L3Protocol");
+  runBench (&benchForwardFast, n, minIterations, "Switch forwarding through the fast path");
+  g_switch = nullptr;
+  Simulator::Destroy ();
+
+  return 0;
+}
@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+// This program profiles the startup of a DCB simulation: it loads a k-ary
+// fat-tree with the protobuf topology loader, configured like
+// config/fat-tree.py, and reports the time of each phase.
+// Sample usage:  ./ns3 run 'bench-dcb-topology --k=16'
+//                ./ns3 run 'bench-dcb-topology --conf=config/configurations.bin'
+
+#include "ns3/command-line.h"
+#include "ns3/configurations-loader.h"
+#include "ns3/protobuf-topology-loader.h"
+#include "ns3/simulator.h"
+#include "ns3/system-wall-clock-ms.h"
+#include <iostream>
+
+using namespace ns3;
+
+static ns3_proto::SwitchGroup
+MakeSwitchGroup (uint32_t k, uint32_t baseIndex, uint32_t num)
+{
+  ns3_proto::SwitchGroup group;
+  group.set_nodesnum (num);
+  group.set_baseindex (baseIndex);
+  group.set_buffersize ("13180KB");
+  group.set_queuenum (8);
+  for (uint32_t p = 0; p < k; p++)
+    {
+      ns3_proto::SwitchPortConfig *port = group.add_ports ();
+      port->set_pfcenabled (true);
+      port->set_ecnenabled (true);
+      for (uint32_t q = 0; q < 8; q++)
+        {
+          ns3_proto::PortQueueConfig *queue = port->add_queues ();
+          queue->set_pfcreserve ("60KiB");
+          queue->set_pfcxon ("50KiB");
+          queue->set_ecnkmin ("40KiB");
+          queue->set_ecnkmax ("60KiB");
+          queue->set_ecnpmax (0.6);
+        }
+    }
+  return group;
+}
+
+/**
+ * Build the configurations of a k-ary fat-tree with one group per tier, hosts
+ * first then switches, as FattreeGenerator does.
+ */
+static ns3_proto::Configurations
+MakeFatTree (uint32_t k)
+{
+  const uint32_t half = k / 2;
+  const uint32_t nHosts = k * half * half;
+  const uint32_t edgeBase = nHosts;
+  const uint32_t aggBase = edgeBase + k * half;
+  const uint32_t coreBase = aggBase + k * half;
+
+  ns3_proto::Configurations conf;
+  ns3_proto::AllNodes *nodes = conf.mutable_topology ()->mutable_nodes ();
+  nodes->set_num (coreBase + half * half);
+  ns3_proto::HostGroup *hosts = nodes->add_hostgroups ();
+  hosts->set_nodesnum (nHosts);
+  hosts->set_baseindex (0);
+  hosts->add_ports ();
+  *nodes->add_switchgroups () = MakeSwitchGroup (k, edgeBase, k * half);
+  *nodes->add_switchgroups () = MakeSwitchGroup (k, aggBase, k * half);
+  *nodes->add_switchgroups () = MakeSwitchGroup (k, coreBase, half * half);
+
+  std::vector<uint32_t> nextPort (coreBase + half * half, 0);
+  auto connect = [&] (uint32_t a, uint32_t b) {
+    ns3_proto::Link *link = conf.mutable_topology ()->add_links ();
+    link->set_node1 (a);
+    link->set_node2 (b);
+    link->set_port1 (nextPort[a]++);
+    link->set_port2 (nextPort[b]++);
+    link->set_rate ("100Gbps");
+    link->set_delay ("1us");
+  };
+  for (uint32_t pod = 0; pod < k; pod++)
+    {
+      for (uint32_t e = 0; e < half; e++)
+        {
+          const uint32_t edge = edgeBase + pod * half + e;
+          for (uint32_t h = 0; h < half; h++)
+            {
+              connect ((pod * half + e) * half + h, edge);
+            }
+          for (uint32_t a = 0; a < half; a++)
+            {
+              connect (edge, aggBase + pod * half + a);
+            }
+        }
+      for (uint32_t a = 0; a < half; a++)
+        {
+          for (uint32_t c = 0; c < half; c++)
+            {
+              connect (aggBase + pod * half + a, coreBase + a * half + c);
+            }
+        }
+    }
+  return conf;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t k = 8;
+  std::string confFile;
+
+  CommandLine cmd (__FILE__);
+  cmd.Usage ("Profile the phases of loading a DCB topology");
+  cmd.AddValue ("k", "number of ports of each switch of the fat-tree", k);
+  cmd.AddValue ("conf", "load this Protobuf configurations instead of a fat-tree", confFile);
+  cmd.Parse (argc, argv);
+
+  if (confFile.empty () && (k < 2 || k % 2 != 0))
+    {
+      std::cerr << "Error-- k must be an even number of at least 2, e.g., --k=16" << std::endl;
+      return 1;
+    }
+
+  SystemWallClockMs time;
+  time.Start ();
+  const ns3_proto::Configurations conf =
+      confFile.empty () ? MakeFatTree (k) : configurations::LoadConfigurations (confFile);
+  const uint64_t confMs = time.End ();
+  std::cout << "Running bench-dcb-topology with " << conf.topology ().nodes ().num ()
+            << " nodes and " << conf.topology ().links_size () << " links" << std::endl
+            << confMs << " ms\tconfigurations" << std::endl;
+
+  topology::LoadPhaseTimes phases;
+  topology::LoadTopology (conf, &phases);
+  int64_t total = 0;
+  for (const auto &[name, ms] : phases)
+    {
+      std::cout << ms << " ms\t" << name << std::endl;
+      total += ms;
+    }
+  std::cout << total << " ms\ttotal of LoadTopology" << std::endl;
+
+  Simulator::Destroy ();
+  return 0;
+}
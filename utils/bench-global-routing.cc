@@ -0,0 +1,207 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Pavinberg <pavin0702@gmail.com>
+ */
+
+// This program measures Ipv4GlobalRouting lookups on the switches of a
+// k-ary fat-tree whose interfaces are all numbered from one /8, like the
+// topologies built by the protobuf-loader module.
+// Sample usage:  ./ns3 run 'bench-global-routing --k=16 --n=1000000'
+
+#include "ns3/command-line.h"
+#include "ns3/config.h"
+#include "ns3/global-router-interface.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv4-global-routing.h"
+#include "ns3/ipv4-global-routing-helper.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/node-container.h"
+#include "ns3/packet.h"
+#include "ns3/point-to-point-helper.h"
+#include "ns3/socket.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/udp-header.h"
+#include "ns3/uinteger.h"
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+struct FatTree
+{
+  NodeContainer hosts;
+  NodeContainer edges;
+  NodeContainer aggs;
+  NodeContainer cores;
+  std::vector<Ipv4Address> hostAddresses;
+};
+
+static void
+Connect (Ptr<Node> a, Ptr<Node> b, PointToPointHelper &p2p, Ipv4AddressHelper &address,
+         Ipv4Address *aAddress = nullptr)
+{
+  NetDeviceContainer devices = p2p.Install (a, b);
+  Ipv4InterfaceContainer interfaces = address.Assign (devices);
+  if (aAddress)
+    {
+      *aAddress = interfaces.GetAddress (0);
+    }
+}
+
+static FatTree
+BuildFatTree (uint32_t k)
+{
+  FatTree ft;
+  const uint32_t half = k / 2;
+  ft.hosts.Create (k * half * half);
+  ft.edges.Create (k * half);
+  ft.aggs.Create (k * half);
+  ft.cores.Create (half * half);
+
+  InternetStackHelper stack;
+  stack.Install (ft.hosts);
+  stack.Install (ft.edges);
+  stack.Install (ft.aggs);
+  stack.Install (ft.cores);
+
+  PointToPointHelper p2p;
+  Ipv4AddressHelper address ("10.0.0.0", "255.0.0.0");
+  for (uint32_t pod = 0; pod < k; pod++)
+    {
+      for (uint32_t e = 0; e < half; e++)
+        {
+          Ptr<Node> edge = ft.edges.Get (pod * half + e);
+          for (uint32_t h = 0; h < half; h++)
+            {
+              Ipv4Address hostAddress;
+              Connect (ft.hosts.Get ((pod * half + e) * half + h), edge, p2p, address,
+                       &hostAddress);
+              ft.hostAddresses.push_back (hostAddress);
+            }
+          for (uint32_t a = 0; a < half; a++)
+            {
+              Connect (edge, ft.aggs.Get (pod * half + a), p2p, address);
+            }
+        }
+      for (uint32_t a = 0; a < half; a++)
+        {
+          for (uint32_t c = 0; c < half; c++)
+            {
+              Connect (ft.aggs.Get (pod * half + a), ft.cores.Get (a * half + c), p2p, address);
+            }
+        }
+    }
+  return ft;
+}
+
+/**
+ * Look up routes to random hosts on every switch of a tier.
+ * \return the wall-clock time in milliseconds
+ */
+static uint64_t
+BenchTier (const NodeContainer &switches, const std::vector<Ipv4Address> &dests, uint32_t n)
+{
+  std::vector<Ptr<Ipv4GlobalRouting>> routings;
+  for (NodeContainer::Iterator i = switches.Begin (); i != switches.End (); ++i)
+    {
+      routings.push_back ((*i)->GetObject<GlobalRouter> ()->GetRoutingProtocol ());
+    }
+
+  Ptr<Packet> packet = Create<Packet> (1000);
+  UdpHeader udp;
+  udp.SetSourcePort (10000);
+  udp.SetDestinationPort (100);
+  packet->AddHeader (udp);
+  Ipv4Header header;
+  header.SetSource (dests[0]);
+  header.SetProtocol (0x11); // UdpL4Protocol::PROT_NUMBER
+  Socket::SocketErrno err;
+
+  uint32_t found = 0;
+  SystemWallClockMs time;
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      header.SetDestination (dests[(i * 2654435761u) % dests.size ()]);
+      if (routings[i % routings.size ()]->RouteOutput (packet, header, 0, err))
+        {
+          found++;
+        }
+    }
+  uint64_t deltaMs = time.End ();
+  if (found != n)
+    {
+      std::cerr << "Warning: " << n - found << " lookups found no route" << std::endl;
+    }
+  return deltaMs;
+}
+
+static void
+Report (const char *name, uint64_t ms, uint32_t n, const NodeContainer &switches)
+{
+  Ptr<GlobalRouter> router = switches.Get (0)->GetObject<GlobalRouter> ();
+  uint32_t routes = router->GetRoutingProtocol ()->GetNRoutes ();
+  std::cout << (ms * 1e6 / n) << " ns/lookup"
+            << " (" << ms << " ms elapsed, " << routes << " routes per switch)\t"
+            << name
+            << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t k = 8;
+  uint32_t n = 1000000;
+
+  CommandLine cmd (__FILE__);
+  cmd.Usage ("Benchmark Ipv4GlobalRouting lookups on a k-ary fat-tree");
+  cmd.AddValue ("k", "number of ports of each switch of the fat-tree", k);
+  cmd.AddValue ("n", "number of lookups per tier", n);
+  cmd.Parse (argc, argv);
+
+  if (k < 2 || k % 2 != 0 || n == 0)
+    {
+      std::cerr << "Error-- k must be an even number of at least 2 and n positive, "
+                << "e.g., --k=16 --n=1000000" << std::endl;
+      return 1;
+    }
+
+  Config::SetDefault ("ns3::Ipv4GlobalRouting::RandomEcmpRouting",
+                      UintegerValue (Ipv4GlobalRouting::EcmpMode::PER_FLOW_ECMP));
+
+  SystemWallClockMs time;
+  time.Start ();
+  FatTree ft = BuildFatTree (k);
+  uint64_t buildMs = time.End ();
+  time.Start ();
+  Ipv4GlobalRoutingHelper::PopulateRoutingTables ();
+  uint64_t populateMs = time.End ();
+  std::cout << "Running bench-global-routing with k=" << k << " (" << ft.hosts.GetN ()
+            << " hosts), n=" << n << std::endl
+            << "topology built in " << buildMs << " ms, routes populated in " << populateMs
+            << " ms" << std::endl;
+
+  // The first lookup of each switch builds its index; keep it out of the timing.
+  BenchTier (ft.edges, ft.hostAddresses, ft.edges.GetN ());
+  BenchTier (ft.aggs, ft.hostAddresses, ft.aggs.GetN ());
+  BenchTier (ft.cores, ft.hostAddresses, ft.cores.GetN ());
+
+  Report ("edge", BenchTier (ft.edges, ft.hostAddresses, n), n, ft.edges);
+  Report ("aggregation", BenchTier (ft.aggs, ft.hostAddresses, n), n, ft.aggs);
+  Report ("core", BenchTier (ft.cores, ft.hostAddresses, n), n, ft.cores);
+
+  return 0;
+}
@@ -205,6 +205,7 @@ int main (int argc, char *argv[])
 
   bool schedCal           = false;
   bool schedHeap          = false;
+  bool schedLadder        = false;
   bool schedList          = false;
   bool schedMap           = true;
   bool schedPriorityQueue = false;
@@ -223,10 +224,15 @@ int main (int argc, char *argv[])
              "  an ascii file, given by the --file=\"<filename>\" argument,\n"
              "  or standard input, by the argument --file=\"-\"\n"
              "In the case of either --file form, the input is expected\n"
-             "to be ascii, giving the relative event times in ns.");
+             "to be ascii, giving the relative event times in seconds.\n"
+             "utils/bench-simulator-dcb.txt has event times like those of a\n"
+             "packet-level data center simulation at 100Gbps: mostly packet\n"
+             "serialization and link delays of up to a microsecond, with some\n"
+             "timers of tens of microseconds and a few of milliseconds.");
   cmd.AddValue ("cal",   "use CalendarSheduler",          schedCal);
   cmd.AddValue ("calrev", "reverse ordering in the CalendarScheduler", calRev);
   cmd.AddValue ("heap",  "use HeapScheduler",             schedHeap);
+  cmd.AddValue ("ladder", "use LadderScheduler",          schedLadder);
   cmd.AddValue ("list",  "use ListSheduler",              schedList);
   cmd.AddValue ("map",   "use MapScheduler (default)",    schedMap);
   cmd.AddValue ("pri",   "use PriorityQueue",             schedPriorityQueue);
@@ -250,6 +256,10 @@ int main (int argc, char *argv[])
     {
       factory.SetTypeId ("ns3::HeapScheduler");
     }
+  if (schedLadder)
+    {
+      factory.SetTypeId ("ns3::LadderScheduler");
+    }
   if (schedList)
     {
       factory.SetTypeId ("ns3::ListScheduler");
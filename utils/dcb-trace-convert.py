@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+## -*- Mode: python; py-indent-offset: 4; indent-tabs-mode: nil; coding: utf-8; -*-
+"""
+Convert a binary trace written by ns3::BinaryTraceWriter (see
+tracer_extension::ConfigBinaryTrace) into one file per stream, named after
+the stream: CSV files with the same content as the text tracers write, or
+Parquet files with --format=parquet, which needs pyarrow.
+
+Sample usage:  ./utils/dcb-trace-convert.py data/trace.bin data/
+               ./utils/dcb-trace-convert.py --format=parquet data/trace.bin data/
+"""
+
+import argparse
+import os
+import socket
+import struct
+import sys
+
+MAGIC = b"DCBTRACE"
+VERSION = 1
+# ColumnType -> struct format character
+COLUMN_FORMATS = {0: "I", 1: "Q", 2: "q", 3: "d"}
+ID = struct.Struct("=I")
+F64 = 3
+# the columns of IPv4 addresses, which the text tracers write in dotted form
+ADDRESS_COLUMNS = {"bufferoverflow-": ("src", "dst")}
+
+
+class Stream:
+    def __init__(self, name, columns):
+        self.name = name
+        self.columnNames = [c[0] for c in columns]
+        self.columnTypes = [c[1] for c in columns]
+        self.row = struct.Struct("=" + "".join(COLUMN_FORMATS[c[1]] for c in columns))
+        self.rows = []
+
+
+def readString(data, offset):
+    (length,) = ID.unpack_from(data, offset)
+    offset += ID.size
+    return data[offset:offset + length].decode(), offset + length
+
+
+def parse(data):
+    if data[:len(MAGIC)] != MAGIC:
+        raise ValueError("not a DCB binary trace")
+    (version,) = ID.unpack_from(data, len(MAGIC))
+    if version != VERSION:
+        raise ValueError(f"unsupported trace version {version}")
+    streams = {}
+    offset = len(MAGIC) + ID.size
+    while offset < len(data):
+        (sid,) = ID.unpack_from(data, offset)
+        offset += ID.size
+        if sid == 0:  # stream declaration
+            (sid,) = ID.unpack_from(data, offset)
+            name, offset = readString(data, offset + ID.size)
+            (ncolumns,) = ID.unpack_from(data, offset)
+            offset += ID.size
+            columns = []
+            for _ in range(ncolumns):
+                ctype = data[offset]
+                cname, offset = readString(data, offset + 1)
+                columns.append((cname, ctype))
+            streams[sid] = Stream(name, columns)
+        else:
+            stream = streams[sid]
+            if offset + stream.row.size > len(data):
+                print(f"Warning: trace truncated in a row of {stream.name}", file=sys.stderr)
+                break
+            stream.rows.append(stream.row.unpack_from(data, offset))
+            offset += stream.row.size
+    return streams.values()
+
+
+def formatAddress(v):
+    return socket.inet_ntoa(struct.pack("!I", v))
+
+
+def formatDouble(v):
+    # the default precision of std::ostream
+    return f"{v:.6g}"
+
+
+def csvFormatters(stream):
+    addresses = ()
+    for prefix, names in ADDRESS_COLUMNS.items():
+        if stream.name.startswith(prefix):
+            addresses = names
+    formatters = []
+    for name, ctype in zip(stream.columnNames, stream.columnTypes):
+        if name in addresses:
+            formatters.append(formatAddress)
+        elif ctype == F64:
+            formatters.append(formatDouble)
+        else:
+            formatters.append(str)
+    return formatters
+
+
+def writeCsv(stream, outputDir):
+    formatters = csvFormatters(stream)
+    with open(os.path.join(outputDir, stream.name + ".csv"), "w") as fp:
+        for row in stream.rows:
+            fp.write(",".join(f(v) for f, v in zip(formatters, row)))
+            fp.write("\n")
+
+
+def writeParquet(stream, outputDir):
+    import pyarrow as pa
+    import pyarrow.parquet as pq
+    columns = list(zip(*stream.rows)) if stream.rows else [[] for _ in stream.columnNames]
+    table = pa.table({name: list(col) for name, col in zip(stream.columnNames, columns)})
+    pq.write_table(table, os.path.join(outputDir, stream.name + ".parquet"))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a DCB binary trace")
+    parser.add_argument("trace", help="the binary trace file")
+    parser.add_argument("outputDir", help="the directory of the converted files")
+    parser.add_argument("--format", choices=["csv", "parquet"], default="csv")
+    args = parser.parse_args()
+
+    with open(args.trace, "rb") as fp:
+        data = fp.read()
+    os.makedirs(args.outputDir, exist_ok=True)
+    write = writeCsv if args.format == "csv" else writeParquet
+    for stream in parse(data):
+        write(stream, args.outputDir)
+        print(f"{stream.name}: {len(stream.rows)} rows")
+
+
+if __name__ == "__main__":
+    main()